@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+
+#include <libcgp/mgr/object_mgr.hpp>
+#include <libcgp/mgr/resource_mgr.hpp>
+#include <libcgp/mgr/settings_mgr.hpp>
+#include <libcgp/window/window.hpp>
+
+#include <cstdlib>
+
+using namespace LibGcp;
+
+/* Managers need the GL context, so a hidden window is created before any benchmark runs */
+int main(int argc, char **argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return EXIT_FAILURE;
+    }
+
+    SettingsMgr::InitInstance();
+    Window::InitInstance().Init(true);
+    ResourceMgr::InitInstance().InitContext();
+    ObjectMgr::InitInstance();
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    ObjectMgr::DeleteInstance();
+    ResourceMgr::DeleteInstance();
+    Window::DeleteInstance();
+    SettingsMgr::DeleteInstance();
+
+    return EXIT_SUCCESS;
+}
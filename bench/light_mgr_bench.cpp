@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+
+#include <libcgp/engine/light_mgr.hpp>
+#include <libcgp/engine/lights.hpp>
+#include <libcgp/intf.hpp>
+#include <libcgp/mgr/object_mgr.hpp>
+#include <libcgp/mgr/resource_mgr.hpp>
+#include <libcgp/primitives/model.hpp>
+#include <libcgp/primitives/shader.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace LibGcp;
+
+/* Every object carries one point and one spot light, so the count stays below the shader limits */
+static void BM_LightMgrPrepareLights(benchmark::State &state)
+{
+    const auto shader = ResourceMgr::GetInstance().GetShader({
+        .paths           = {"deferred_shading", "deferred_shading"},
+        .type            = ResourceType::kShader,
+        .load_type       = LoadType::kMemory,
+        .is_serializable = false,
+    });
+
+    const auto model = std::make_shared<Model>(std::vector<std::shared_ptr<Mesh>>{});
+    LightMgr::AddLight(*model, kDefaultPointLight);
+    LightMgr::AddLight(*model, kDefaultSpotLight);
+
+    auto &objects = ObjectMgr::GetInstance().GetStaticObjects();
+    for (int64_t idx = 0; idx < state.range(0); ++idx) {
+        const auto step = static_cast<float>(idx);
+        objects.emplace_back(
+            ObjectPosition{.position = {step, 1.0F, -step}, .rotation = {}, .scale = {1.0F, 1.0F, 1.0F}}, model
+        );
+    }
+
+    const LightMgr light_mgr{};
+    shader->Activate();
+
+    for (auto _ : state) {
+        light_mgr.PrepareLights(*shader);
+    }
+
+    objects.Clear();
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+BENCHMARK(BM_LightMgrPrepareLights)->Arg(1)->Arg(8)->Arg(31);
@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+
+#include <libcgp/primitives/model.hpp>
+
+#include <assimp/scene.h>
+
+#include <array>
+#include <vector>
+
+using namespace LibGcp;
+
+/* Grid of quads shaped the way assimp delivers triangulated meshes, arrays are released by aiMesh */
+static void FillGridMesh(aiMesh &mesh, const unsigned side)
+{
+    mesh.mNumVertices      = side * side;
+    mesh.mVertices         = new aiVector3D[mesh.mNumVertices];
+    mesh.mNormals          = new aiVector3D[mesh.mNumVertices];
+    mesh.mTangents         = new aiVector3D[mesh.mNumVertices];
+    mesh.mTextureCoords[0] = new aiVector3D[mesh.mNumVertices];
+
+    for (unsigned idx = 0; idx < mesh.mNumVertices; ++idx) {
+        const auto x = static_cast<float>(idx % side);
+        const auto z = static_cast<float>(idx / side);
+
+        mesh.mVertices[idx]         = aiVector3D(x, 0.0F, z);
+        mesh.mNormals[idx]          = aiVector3D(0.0F, 1.0F, 0.0F);
+        mesh.mTangents[idx]         = aiVector3D(1.0F, 0.0F, 0.0F);
+        mesh.mTextureCoords[0][idx] = aiVector3D(x / side, z / side, 0.0F);
+    }
+
+    mesh.mNumFaces = 2 * (side - 1) * (side - 1);
+    mesh.mFaces    = new aiFace[mesh.mNumFaces];
+
+    unsigned face = 0;
+    for (unsigned row = 0; row + 1 < side; ++row) {
+        for (unsigned col = 0; col + 1 < side; ++col) {
+            const unsigned corner = row * side + col;
+
+            for (const auto &triangle : {std::array{corner, corner + side, corner + 1},
+                                         std::array{corner + 1, corner + side, corner + side + 1}}) {
+                mesh.mFaces[face].mNumIndices = 3;
+                mesh.mFaces[face].mIndices    = new unsigned[3]{triangle[0], triangle[1], triangle[2]};
+                ++face;
+            }
+        }
+    }
+}
+
+static void BM_ModelConvertMeshGeometry(benchmark::State &state)
+{
+    aiMesh mesh{};
+    FillGridMesh(mesh, static_cast<unsigned>(state.range(0)));
+
+    std::vector<Vertex> vertices{};
+    std::vector<GLuint> indices{};
+
+    for (auto _ : state) {
+        ModelSerializer::ConvertMeshGeometry(&mesh, vertices, indices);
+        benchmark::DoNotOptimize(vertices.data());
+        benchmark::DoNotOptimize(indices.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * mesh.mNumVertices);
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(mesh.mNumVertices * sizeof(Vertex)));
+}
+
+/* side of the grid, from 1k to 1M vertices */
+BENCHMARK(BM_ModelConvertMeshGeometry)->RangeMultiplier(4)->Range(32, 1024);
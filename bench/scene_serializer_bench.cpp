@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <libcgp/intf.hpp>
+#include <libcgp/mgr/object_mgr.hpp>
+#include <libcgp/mgr/resource_mgr.hpp>
+#include <libcgp/primitives/model.hpp>
+#include <libcgp/serialization/scene_serializer.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace LibGcp;
+
+static constexpr const char *kBenchModelName = "bench_scene_model";
+static constexpr const char *kBenchSceneName = "bench_scene";
+
+static std::string GetBenchDir()
+{
+    const auto dir = std::filesystem::temp_directory_path() / "render_engine_bench";
+    std::filesystem::create_directories(dir);
+
+    return dir.string();
+}
+
+/* Objects share a single in-memory model, so only the scene records are measured */
+static void FillScene(const size_t count)
+{
+    const auto model = std::make_shared<Model>(std::vector<std::shared_ptr<Mesh>>{});
+    model->load_type = LoadType::kMemory;
+
+    ResourceMgr::GetInstance().GetModels().Lock();
+    ResourceMgr::GetInstance().GetModels()[kBenchModelName] = model;
+    ResourceMgr::GetInstance().GetModels().Unlock();
+
+    auto &objects = ObjectMgr::GetInstance().GetStaticObjects();
+    objects.Clear();
+    objects.reserve(count);
+
+    for (size_t idx = 0; idx < count; ++idx) {
+        const auto step = static_cast<float>(idx);
+        const ObjectPosition position{
+            .position = {step, 0.0F, -step},
+            .rotation = {0.0F, step, 0.0F},
+            .scale    = {1.0F, 1.0F, 1.0F},
+        };
+
+        objects.emplace_back(position, model);
+    }
+}
+
+static void BM_SceneSerializerSave(benchmark::State &state)
+{
+    FillScene(static_cast<size_t>(state.range(0)));
+    SceneSerializer serializer(GetBenchDir());
+
+    for (auto _ : state) {
+        if (IsFailure(serializer.SerializeScene(kBenchSceneName, SerializationType::kShallow))) {
+            state.SkipWithError("Failed to save the scene");
+            break;
+        }
+    }
+
+    ObjectMgr::GetInstance().GetStaticObjects().Clear();
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetComplexityN(state.range(0));
+}
+
+static void BM_SceneSerializerLoad(benchmark::State &state)
+{
+    FillScene(static_cast<size_t>(state.range(0)));
+    SceneSerializer serializer(GetBenchDir());
+
+    const Rc save_rc = serializer.SerializeScene(kBenchSceneName, SerializationType::kShallow);
+    ObjectMgr::GetInstance().GetStaticObjects().Clear();
+
+    if (IsFailure(save_rc)) {
+        state.SkipWithError("Failed to save the scene");
+        return;
+    }
+
+    for (auto _ : state) {
+        auto [rc, scene] = serializer.LoadScene(kBenchSceneName, SerializationType::kShallow);
+        if (IsFailure(rc) || scene.static_objects.size() != static_cast<size_t>(state.range(0))) {
+            state.SkipWithError("Failed to load the scene");
+            break;
+        }
+
+        benchmark::DoNotOptimize(scene);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_SceneSerializerSave)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMillisecond)
+    ->Complexity(benchmark::oN);
+
+BENCHMARK(BM_SceneSerializerLoad)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMillisecond)
+    ->Complexity(benchmark::oN);
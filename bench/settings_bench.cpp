@@ -0,0 +1,39 @@
+#include <benchmark/benchmark.h>
+
+#include <libcgp/intf.hpp>
+#include <libcgp/mgr/settings_mgr.hpp>
+
+using namespace LibGcp;
+
+static void BM_SettingsGet(benchmark::State &state)
+{
+    const auto &settings = SettingsMgr::GetInstance();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(settings.GetSetting<Setting::kFov, float>());
+        benchmark::DoNotOptimize(settings.GetSetting<Setting::kFreeCameraSpeed, double>());
+        benchmark::DoNotOptimize(settings.GetSetting<Setting::kClockTicking, bool>());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 3);
+}
+
+BENCHMARK(BM_SettingsGet);
+
+/* Value changes every time, otherwise the setter returns before storing it */
+static void BM_SettingsSet(benchmark::State &state)
+{
+    auto &settings    = SettingsMgr::GetInstance();
+    const float saved = settings.GetSetting<Setting::kFov, float>();
+    float fov         = saved;
+
+    for (auto _ : state) {
+        fov = fov > 90.0F ? 30.0F : fov + 1.0F;
+        settings.SetSetting<Setting::kFov>(fov);
+    }
+
+    settings.SetSetting<Setting::kFov>(saved);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_SettingsSet);
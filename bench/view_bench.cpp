@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+
+#include <libcgp/engine/view.hpp>
+#include <libcgp/intf.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace LibGcp;
+
+static std::vector<ObjectPosition> MakePositions(const size_t count)
+{
+    std::vector<ObjectPosition> positions{};
+    positions.reserve(count);
+
+    for (size_t idx = 0; idx < count; ++idx) {
+        const auto step = static_cast<float>(idx);
+        positions.push_back({
+            .position = {step, 0.5F * step, -step},
+            .rotation = {step * 0.01F, step * 0.02F, step * 0.03F},
+            .scale    = {1.0F, 2.0F, 1.0F},
+        });
+    }
+
+    return positions;
+}
+
+static void BM_ViewPrepareModelMatrices(benchmark::State &state)
+{
+    const auto positions = MakePositions(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        for (const auto &position : positions) {
+            benchmark::DoNotOptimize(View::PrepareModelMatrices(position));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ViewPrepareModelMatrices)->RangeMultiplier(8)->Range(1 << 6, 1 << 15);
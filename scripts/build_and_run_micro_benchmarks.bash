@@ -0,0 +1,37 @@
+#!/bin/bash
+
+BUILD_AND_RUN_MICRO_BENCHMARKS_DIR="$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && pwd )"
+
+BUILD_AND_RUN_MICRO_BENCHMARKS_REPO_DIR="${BUILD_AND_RUN_MICRO_BENCHMARKS_DIR}/.."
+
+BENCH_TARGET_NAME="MicroBenchmarkTarget"
+
+set -euo pipefail  # Exit on error, unset variables, and pipeline failures
+
+# Step 1: cd to the repo root
+echo "Changing directory to ${BUILD_AND_RUN_MICRO_BENCHMARKS_REPO_DIR}"
+cd "${BUILD_AND_RUN_MICRO_BENCHMARKS_REPO_DIR}"
+
+# Results are named after the revision, compare two of them with:
+#   <benchmark source>/tools/compare.py benchmarks <old>.json <new>.json
+REVISION=$(git rev-parse --short HEAD)
+REPORT_DIR="$(pwd)/bench_results"
+REPORT_FILE="${REPORT_DIR}/micro_bench_${REVISION}.json"
+
+# Step 2: configure cmake, debug build is sanitized so release is used
+echo "Creating build directory and running cmake"
+mkdir -p build_bench && cd build_bench
+cmake -DCMAKE_BUILD_TYPE=Release ..
+
+# Step 3: build the benchmark target
+echo "Building the benchmarks"
+cmake --build . --target "${BENCH_TARGET_NAME}" -- -j$(nproc)
+
+# Step 4: find bench binary
+echo "Finding bench binary"
+BENCH_BINARY=$(find . -name "${BENCH_TARGET_NAME}" -type f)
+
+# Step 5: run benchmarks, extra arguments e.g. --benchmark_filter are passed through
+echo "Running benchmarks, results saved to ${REPORT_FILE}"
+mkdir -p "${REPORT_DIR}"
+"${BENCH_BINARY}" --benchmark_out="${REPORT_FILE}" --benchmark_out_format=json "$@" || exit 1
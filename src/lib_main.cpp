@@ -2,30 +2,134 @@
 
 #include <libcgp/engine/engine.hpp>
 #include <libcgp/engine/process_loop.hpp>
+#include <libcgp/engine/startup_loader.hpp>
+#include <libcgp/engine/startup_timeline.hpp>
 #include <libcgp/mgr/object_mgr.hpp>
 #include <libcgp/mgr/resource_mgr.hpp>
 #include <libcgp/mgr/settings_mgr.hpp>
 #include <libcgp/window/window.hpp>
 
-int LibGcp::RenderEngineMain(const Scene& scene)
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+/**
+ * Loader runs before the window is created, so the scene is parsed and its assets are imported and decoded while
+ * the GL context is being set up. Only the upload of the prepared assets waits for the context.
+ */
+static LibGcp::Rc InitComponents(LibGcp::StartupLoader& loader, const bool is_hidden)
 {
-    /* initialize components */
+    using namespace LibGcp;
+
+    StartupTimeline::Begin();
+
     SettingsMgr::InitInstance();
-    Window::InitInstance().Init();
     ResourceMgr::InitInstance();
+
+    /* benchmark measures cold loads, so it never reuses assets decoded by other processes */
+    if (!is_hidden) {
+        ResourceMgr::GetInstance().OpenSharedAssetCache();
+    }
+    loader.Start();
+
+    Window::InitInstance().Init(is_hidden);
+    ResourceMgr::GetInstance().InitContext();
     ObjectMgr::InitInstance();
+
+    Scene scene{};
+    if (const Rc rc = loader.Finish(scene); IsFailure(rc)) {
+        return rc;
+    }
+
     Engine::InitInstance().Init(scene);
 
-    /* render loop */
-    ProcessLoopApp();
+    /* textures decoded ahead are either loaded by now or not used by the scene */
+    ResourceMgr::GetInstance().ClearPredecodedTextures();
+
+    return Rc::kSuccess;
+}
+
+static void DeleteComponents(const bool has_engine)
+{
+    using namespace LibGcp;
 
-    /* cleanup */
     Window::DeleteInstance();
 
-    Engine::DeleteInstance();
+    if (has_engine) {
+        Engine::DeleteInstance();
+    }
     ObjectMgr::DeleteInstance();
     ResourceMgr::DeleteInstance();
     SettingsMgr::DeleteInstance();
+}
+
+static int RunEngine(LibGcp::StartupLoader& loader, const std::string& scene_name)
+{
+    using namespace LibGcp;
+
+    if (const Rc rc = InitComponents(loader, false); IsFailure(rc)) {
+        std::cerr << "Failed to load scene: " << scene_name << " caused by: " << GetRcDescription(rc) << std::endl;
+        DeleteComponents(false);
+        return EXIT_FAILURE;
+    }
+
+    /* render loop */
+    ProcessLoopApp();
+
+    /* cleanup */
+    DeleteComponents(true);
+
+    return EXIT_SUCCESS;
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+int LibGcp::RenderEngineMain(const Scene& scene)
+{
+    StartupLoader loader(scene);
+    return RunEngine(loader, "in-memory scene");
+}
+
+int LibGcp::RenderEngineMain(const std::string& scene_path)
+{
+    StartupLoader loader(scene_path);
+    return RunEngine(loader, scene_path);
+}
+
+int LibGcp::RenderEngineBenchMain(const BenchConfig& config)
+{
+    const auto load_start = std::chrono::steady_clock::now();
+
+    StartupLoader loader(config.scene_path);
+    if (const Rc rc = InitComponents(loader, true); IsFailure(rc)) {
+        std::cerr << "Failed to load scene: " << config.scene_path << " caused by: " << GetRcDescription(rc)
+                  << std::endl;
+        DeleteComponents(false);
+        return EXIT_FAILURE;
+    }
+
+    BenchReport report{};
+    report.load_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - load_start).count();
+
+    /* benchmark loop */
+    Rc bench_rc = ProcessBenchLoop(config, report);
+    if (IsSuccess(bench_rc)) {
+        bench_rc = WriteBenchReport(config, report);
+    }
+
+    if (IsFailure(bench_rc)) {
+        std::cerr << "Benchmark failed: " << GetRcDescription(bench_rc) << std::endl;
+    }
+
+    /* cleanup */
+    DeleteComponents(true);
 
-    return 0;
+    return IsSuccess(bench_rc) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,342 @@
+#include <libcgp/engine/bench_loop.hpp>
+
+#include <libcgp/engine/engine.hpp>
+#include <libcgp/engine/input_capture.hpp>
+#include <libcgp/engine/startup_timeline.hpp>
+#include <libcgp/mgr/object_mgr.hpp>
+#include <libcgp/mgr/settings_mgr.hpp>
+#include <libcgp/utils/profiler.hpp>
+#include <libcgp/window/window.hpp>
+
+// clang-format off
+#include <glad/gl.h>
+#include <GLFW/glfw3.h> /* (include after glad) */
+// clang-format on
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <numbers>
+#include <sstream>
+#include <vector>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static constexpr size_t kOrbitKeyframes = 64;
+static constexpr float kOrbitRadius     = 10.0F;
+static constexpr float kOrbitHeight     = 3.0F;
+
+struct CameraKeyframe {
+    glm::vec3 position;
+    glm::vec3 target;
+};
+
+static std::vector<CameraKeyframe> MakeOrbitPath()
+{
+    std::vector<CameraKeyframe> keyframes{};
+    keyframes.reserve(kOrbitKeyframes + 1);
+
+    /* last keyframe closes the loop */
+    for (size_t idx = 0; idx <= kOrbitKeyframes; ++idx) {
+        const float angle = 2.0F * std::numbers::pi_v<float> * static_cast<float>(idx) / kOrbitKeyframes;
+
+        keyframes.push_back({
+            .position = {kOrbitRadius * std::cos(angle), kOrbitHeight, kOrbitRadius * std::sin(angle)},
+            .target   = glm::vec3{0.0F},
+        });
+    }
+
+    return keyframes;
+}
+
+static LibGcp::Rc LoadCameraPath(const std::string &path, std::vector<CameraKeyframe> &out)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return LibGcp::Rc::kFailedToOpenFile;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        CameraKeyframe keyframe{};
+        std::istringstream stream(line);
+        if (!(stream >> keyframe.position.x >> keyframe.position.y >> keyframe.position.z >> keyframe.target.x >>
+              keyframe.target.y >> keyframe.target.z)) {
+            return LibGcp::Rc::kCorruptedFile;
+        }
+
+        out.push_back(keyframe);
+    }
+
+    return out.empty() ? LibGcp::Rc::kCorruptedFile : LibGcp::Rc::kSuccess;
+}
+
+/* Keyframes are evenly spaced over the progress from 0 to 1 */
+static CameraKeyframe SampleCameraPath(const std::vector<CameraKeyframe> &keyframes, const double progress)
+{
+    const double position = std::clamp(progress, 0.0, 1.0) * static_cast<double>(keyframes.size() - 1);
+    const auto first      = std::min(static_cast<size_t>(position), keyframes.size() - 1);
+    const auto second     = std::min(first + 1, keyframes.size() - 1);
+    const auto factor     = static_cast<float>(position - static_cast<double>(first));
+
+    return {
+        .position = glm::mix(keyframes[first].position, keyframes[second].position, factor),
+        .target   = glm::mix(keyframes[first].target, keyframes[second].target, factor),
+    };
+}
+
+/* Nearest rank percentiles */
+static LibGcp::BenchSampleStats ComputeStats(std::vector<double> samples)
+{
+    if (samples.empty()) {
+        return {};
+    }
+
+    std::ranges::sort(samples);
+
+    const auto percentile = [&](const double fraction) {
+        const auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(samples.size())));
+        return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+    };
+
+    double sum = 0.0;
+    for (const double sample : samples) {
+        sum += sample;
+    }
+
+    return {
+        .average_ms = sum / static_cast<double>(samples.size()),
+        .p50_ms     = percentile(0.50),
+        .p95_ms     = percentile(0.95),
+        .p99_ms     = percentile(0.99),
+        .max_ms     = samples.back(),
+    };
+}
+
+static void WriteStats(std::ostream &out, const LibGcp::BenchSampleStats &stats)
+{
+    out << R"({"avg": )" << stats.average_ms << R"(, "p50": )" << stats.p50_ms << R"(, "p95": )" << stats.p95_ms
+        << R"(, "p99": )" << stats.p99_ms << R"(, "max": )" << stats.max_ms << "}";
+}
+
+static double ElapsedMs(
+    const std::chrono::steady_clock::time_point start, const std::chrono::steady_clock::time_point end
+)
+{
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::Rc LibGcp::ProcessBenchLoop(const BenchConfig &config, BenchReport &report)
+{
+    const bool is_replay = !config.input_capture_path.empty();
+
+    InputCapture capture{};
+    std::vector<CameraKeyframe> keyframes{};
+    if (is_replay) {
+        if (const Rc rc = capture.Load(config.input_capture_path); IsFailure(rc)) {
+            return rc;
+        }
+    } else if (config.camera_path.empty()) {
+        keyframes = MakeOrbitPath();
+    } else if (const Rc rc = LoadCameraPath(config.camera_path, keyframes); IsFailure(rc)) {
+        return rc;
+    }
+
+    const size_t measured_frames = is_replay ? std::min(config.frames, capture.GetFrames().size()) : config.frames;
+    if (measured_frames == 0) {
+        return Rc::kInvalidArgument;
+    }
+
+    Profiler::SetThreadName("Render");
+
+    if (is_replay) {
+        /* cameras and the clock are set by the recorded settings */
+        Engine::GetInstance().BeginInputReplay(capture);
+    } else {
+        /* camera follows the path instead of the user input */
+        SettingsMgr::GetInstance().SetSetting<Setting::kCameraType>(CameraType::kFree);
+        SettingsMgr::GetInstance().SetSetting<Setting::kClockTicking>(true);
+    }
+
+    std::vector<double> cpu_frames{};
+    std::vector<double> frames{};
+    cpu_frames.reserve(measured_frames);
+    frames.reserve(measured_frames);
+
+    const bool is_replay_checked  = is_replay && config.delta_us == 0;
+    report.replay_diverged_frames = 0;
+    report.first_diverged_frame   = measured_frames;
+
+    size_t drawn_objects  = 0;
+    size_t culled_objects = 0;
+    size_t drawn_meshes   = 0;
+    size_t max_meshes     = 0;
+
+    auto &gpu_profiler = Engine::GetInstance().GetGpuProfiler();
+    gpu_profiler.Reset();
+
+    for (size_t idx = 0; idx < config.warmup_frames + measured_frames; ++idx) {
+        const bool is_measured = idx >= config.warmup_frames;
+        if (idx == config.warmup_frames) {
+            gpu_profiler.StartRecording();
+        }
+
+        const size_t frame = is_measured ? idx - config.warmup_frames : 0;
+        uint64_t delta_us  = config.delta_us;
+
+        if (is_replay) {
+            /* warmup frames are drawn from the initial state without any input */
+            if (idx == config.warmup_frames && idx != 0) {
+                Engine::GetInstance().BeginInputReplay(capture);
+            }
+
+            if (is_measured) {
+                Engine::GetInstance().ReplayInputFrame(capture, frame);
+                delta_us = config.delta_us != 0 ? config.delta_us : capture.GetFrames()[frame].delta_us;
+            }
+        } else {
+            const double progress =
+                measured_frames > 1 ? static_cast<double>(frame) / static_cast<double>(measured_frames - 1) : 0.0;
+            const auto keyframe   = SampleCameraPath(keyframes, progress);
+            const glm::vec3 front = keyframe.target - keyframe.position;
+
+            if (glm::length(front) > 0.0F) {
+                Engine::GetInstance().PointFreeCamera(keyframe.position, glm::normalize(front));
+            }
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        Engine::GetInstance().Draw();
+        Engine::GetInstance().ProcessProgress(delta_us);
+        const auto engine_end = std::chrono::steady_clock::now();
+
+        Window::GetInstance().SwapBuffers();
+        const auto end = std::chrono::steady_clock::now();
+        StartupTimeline::MarkFirstFrame();
+
+        if (!is_measured) {
+            continue;
+        }
+
+        cpu_frames.push_back(ElapsedMs(start, engine_end));
+        frames.push_back(ElapsedMs(start, end));
+
+        if (is_replay_checked && Engine::GetInstance().GetInputStateHash() != capture.GetFrames()[frame].state_hash) {
+            report.first_diverged_frame = std::min(report.first_diverged_frame, frame);
+            ++report.replay_diverged_frames;
+        }
+
+        const auto &draw_stats = ObjectMgr::GetInstance().GetDrawStats();
+        drawn_objects += draw_stats.drawn_objects;
+        culled_objects += draw_stats.culled_objects;
+        drawn_meshes += draw_stats.drawn_meshes;
+        max_meshes = std::max(max_meshes, draw_stats.drawn_meshes);
+    }
+
+    gpu_profiler.StopRecording();
+    gpu_profiler.Flush();
+
+    std::vector<double> gpu_frames{};
+    std::array<std::vector<double>, GpuProfiler::kPassCount> gpu_passes{};
+    for (const auto &sample : gpu_profiler.GetRecordedFrames()) {
+        double sum = 0.0;
+        for (size_t pass = 0; pass < GpuProfiler::kPassCount; ++pass) {
+            gpu_passes[pass].push_back(sample[pass]);
+            sum += sample[pass];
+        }
+        gpu_frames.push_back(sum);
+    }
+
+    const auto *renderer = reinterpret_cast<const char *>(glGetString(GL_RENDERER));
+    const auto count     = static_cast<double>(measured_frames);
+
+    report.renderer               = renderer != nullptr ? renderer : "unknown";
+    report.frames                 = measured_frames;
+    report.cpu_frame              = ComputeStats(std::move(cpu_frames));
+    report.frame                  = ComputeStats(std::move(frames));
+    report.gpu_frames             = gpu_frames.size();
+    report.gpu_frame              = ComputeStats(std::move(gpu_frames));
+    report.average_drawn_objects  = static_cast<double>(drawn_objects) / count;
+    report.average_culled_objects = static_cast<double>(culled_objects) / count;
+    report.average_drawn_meshes   = static_cast<double>(drawn_meshes) / count;
+    report.max_drawn_meshes       = max_meshes;
+
+    for (size_t pass = 0; pass < GpuProfiler::kPassCount; ++pass) {
+        report.gpu_passes[pass] = ComputeStats(std::move(gpu_passes[pass]));
+    }
+
+    return Rc::kSuccess;
+}
+
+LibGcp::Rc LibGcp::WriteBenchReport(const BenchConfig &config, const BenchReport &report)
+{
+    std::ostringstream out{};
+
+    out << "{\n";
+    out << R"(  "scene": )";
+    Profiler::WriteJsonString(out, config.scene_path);
+    out << ",\n" << R"(  "renderer": )";
+    Profiler::WriteJsonString(out, report.renderer);
+    out << ",\n";
+    out << R"(  "frames": )" << report.frames << ",\n";
+    out << R"(  "warmup_frames": )" << config.warmup_frames << ",\n";
+    out << R"(  "delta_us": )" << config.delta_us << ",\n";
+    out << R"(  "load_ms": )" << report.load_ms << ",\n";
+
+    out << R"(  "startup": )";
+    StartupTimeline::WriteJson(out);
+    out << ",\n";
+
+    if (!config.input_capture_path.empty()) {
+        out << R"(  "replay": {"capture": )";
+        Profiler::WriteJsonString(out, config.input_capture_path);
+        out << R"(, "diverged_frames": )" << report.replay_diverged_frames << R"(, "first_diverged_frame": )";
+
+        if (report.replay_diverged_frames == 0) {
+            out << "null},\n";
+        } else {
+            out << report.first_diverged_frame << "},\n";
+        }
+    }
+
+    out << R"(  "cpu_frame_ms": )";
+    WriteStats(out, report.cpu_frame);
+    out << ",\n" << R"(  "frame_ms": )";
+    WriteStats(out, report.frame);
+    out << ",\n" << R"(  "gpu_frames": )" << report.gpu_frames << ",\n" << R"(  "gpu_frame_ms": )";
+    WriteStats(out, report.gpu_frame);
+
+    out << ",\n" << R"(  "gpu_passes_ms": {)";
+    for (size_t pass = 0; pass < GpuProfiler::kPassCount; ++pass) {
+        const char *name = GpuProfiler::GetPassName(static_cast<GpuProfiler::Pass>(pass));
+        out << (pass == 0 ? "\n" : ",\n") << R"(    ")" << name << R"(": )";
+        WriteStats(out, report.gpu_passes[pass]);
+    }
+    out << "\n  },\n";
+
+    out << R"(  "draws": {"avg_objects": )" << report.average_drawn_objects << R"(, "avg_culled_objects": )"
+        << report.average_culled_objects << R"(, "avg_meshes": )" << report.average_drawn_meshes
+        << R"(, "max_meshes": )" << report.max_drawn_meshes << "}\n";
+    out << "}\n";
+
+    std::ofstream file(config.report_path, std::ios::trunc);
+    if (!file.is_open()) {
+        return Rc::kFailedToOpenFile;
+    }
+
+    file << out.str();
+    return file.good() ? Rc::kSuccess : Rc::kUnknownFailure;
+}
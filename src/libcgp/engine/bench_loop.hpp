@@ -0,0 +1,73 @@
+#ifndef ENGINE_BENCH_LOOP_HPP_
+#define ENGINE_BENCH_LOOP_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/engine/gpu_profiler.hpp>
+#include <libcgp/rc.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+LIBGCP_DECL_START_
+struct BenchConfig {
+    std::string scene_path;
+
+    /* Keyframes "px py pz tx ty tz" per line, position and the point looked at, orbit is used when empty */
+    std::string camera_path;
+
+    /* Recorded input replayed instead of the camera path, frames are limited to the recorded ones */
+    std::string input_capture_path;
+
+    std::string report_path;
+
+    size_t frames;
+    size_t warmup_frames;
+
+    /* Clock delta passed to every frame instead of the measured one, 0 keeps the deltas of the replayed input */
+    uint64_t delta_us;
+};
+
+/* All times in milliseconds */
+struct BenchSampleStats {
+    double average_ms;
+    double p50_ms;
+    double p95_ms;
+    double p99_ms;
+    double max_ms;
+};
+
+struct BenchReport {
+    std::string renderer;
+    size_t frames;
+    double load_ms;
+
+    /* time spent by the engine in the frame, excluding the buffer swap */
+    BenchSampleStats cpu_frame;
+
+    /* whole frame including the buffer swap */
+    BenchSampleStats frame;
+
+    size_t gpu_frames;
+    BenchSampleStats gpu_frame;
+    std::array<BenchSampleStats, GpuProfiler::kPassCount> gpu_passes;
+
+    /* frames whose camera and settings differ from the recorded ones, checked only with the recorded deltas */
+    size_t replay_diverged_frames;
+    size_t first_diverged_frame;
+
+    double average_drawn_objects;
+    double average_culled_objects;
+    double average_drawn_meshes;
+    size_t max_drawn_meshes;
+};
+
+/* Renders frames along the camera path with the fixed clock delta, all engine components must be initialized */
+NDSCRD Rc ProcessBenchLoop(const BenchConfig &config, BenchReport &report);
+
+NDSCRD Rc WriteBenchReport(const BenchConfig &config, const BenchReport &report);
+
+LIBGCP_DECL_END_
+
+#endif  // ENGINE_BENCH_LOOP_HPP_
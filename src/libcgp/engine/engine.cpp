@@ -1,9 +1,15 @@
 #include <libcgp/engine/engine.hpp>
 
+#include <libcgp/engine/render_stats.hpp>
+#include <libcgp/engine/startup_timeline.hpp>
 #include <libcgp/mgr/settings_mgr.hpp>
+#include <libcgp/utils/hash.hpp>
 #include <libcgp/utils/macros.hpp>
+#include <libcgp/utils/profiler.hpp>
 #include <libcgp/window/window.hpp>
 
+#include <algorithm>
+
 LibGcp::EngineBase::~EngineBase() { TRACE("EngineBase::~EngineBase()"); }
 
 void LibGcp::EngineBase::Init(const Scene &scene) noexcept
@@ -17,6 +23,9 @@ void LibGcp::EngineBase::Init(const Scene &scene) noexcept
     /* Adjust camera type based on default settings - intentional cast */
     OnCameraTypeChanged_(SettingsMgr::GetInstance().GetSetting<uint64_t>(Setting::kCameraType));
 
+    /* mouse turns are recorded together with the key presses */
+    Window::GetInstance().GetMouse().BindRecorder(&input_recorder_);
+
     /* Add reaction on perspective change */
     SettingsMgr::GetInstance().AddListener(Setting::kFov, OnPerspectiveChanged_);
     SettingsMgr::GetInstance().AddListener(Setting::kNear, OnPerspectiveChanged_);
@@ -63,19 +72,23 @@ void LibGcp::EngineBase::Init(const Scene &scene) noexcept
     g_buffer_.PrepareBuffers();
 
     /* load shaders */
-    geometry_pass_shader_ = ResourceMgr::GetInstance().GetShader({
-        .paths           = {"g_buffer", "g_buffer"},
-        .type            = ResourceType::kShader,
-        .load_type       = LoadType::kMemory,
-        .is_serializable = false,
-    });
-
-    lighting_pass_shader_ = ResourceMgr::GetInstance().GetShader({
-        .paths           = {"deferred_shading", "deferred_shading"},
-        .type            = ResourceType::kShader,
-        .load_type       = LoadType::kMemory,
-        .is_serializable = false,
-    });
+    {
+        const StartupTimeline::Scope phase(StartupTimeline::Phase::kShaderCompile);
+
+        geometry_pass_shader_ = ResourceMgr::GetInstance().GetShader({
+            .paths           = {"g_buffer", "g_buffer"},
+            .type            = ResourceType::kShader,
+            .load_type       = LoadType::kMemory,
+            .is_serializable = false,
+        });
+
+        lighting_pass_shader_ = ResourceMgr::GetInstance().GetShader({
+            .paths           = {"deferred_shading", "deferred_shading"},
+            .type            = ResourceType::kShader,
+            .load_type       = LoadType::kMemory,
+            .is_serializable = false,
+        });
+    }
 
     /* prepare g_buffer uniforms */
     lighting_pass_shader_->Activate();
@@ -83,37 +96,72 @@ void LibGcp::EngineBase::Init(const Scene &scene) noexcept
 
     /* prepare quad */
     quad_.Init();
+
+    /* time queries of the render passes */
+    gpu_profiler_.Init();
+
+    /* finer mip levels and world cells are loaded in the background */
+    texture_streamer_.Start();
+    world_streamer_.Start();
+    scene_preloader_.Start();
+
+    UNUSED const auto cache_stats = ResourceMgr::GetInstance().GetProgramCacheStats();
+    TRACE("Shader program cache: " << cache_stats.hits << " hits, " << cache_stats.misses << " misses");
 }
 
 void LibGcp::EngineBase::Draw()
 {
+    PROFILE_SCOPE("Engine::Draw");
+
+    /* results of the frames old enough are collected without waiting */
+    gpu_profiler_.BeginFrame();
+    RenderStats::BeginFrame();
+
     /* geometry pass */
+    gpu_profiler_.BeginPass(GpuProfiler::Pass::kGeometry);
     geometry_pass_shader_->Activate();
     g_buffer_.BindForWriting();
     Engine::GetInstance().GetView().PrepareViewMatrices(*geometry_pass_shader_);
     ObjectMgr::GetInstance().DrawStaticObjects(*geometry_pass_shader_);
+    gpu_profiler_.EndPass(GpuProfiler::Pass::kGeometry);
 
     /* switch to default framebuffer */
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    gpu_profiler_.BeginPass(GpuProfiler::Pass::kLighting);
+    GlBindFramebuffer(GL_FRAMEBUFFER, 0);
     glClearColor(0.2F, 0.2F, 0.2F, 1.0F);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    /* lighting pass */
-    lighting_pass_shader_->Activate();
+    /* lighting pass, permutation specialized for current light counts is used once compiled */
+    const auto lighting_variant = light_mgr_.GetSpecializedShader(kLightingPassShaderName);
+    Shader &lighting_shader = lighting_variant ? *lighting_variant : *lighting_pass_shader_;
+
+    lighting_shader.Activate();
+    g_buffer_.BindShaderWithBuffers(lighting_shader);
     g_buffer_.BindTexturesForReading();
 
-    lighting_pass_shader_->SetVec3("un_view_pos", view_.GetBindObject().position);
-    light_mgr_.PrepareLights(*lighting_pass_shader_);
-    global_light_.PrepareLights(*lighting_pass_shader_);
+    lighting_shader.SetVec3("un_view_pos", view_.GetBindObject().position);
+    light_mgr_.PrepareLights(lighting_shader);
+    global_light_.PrepareLights(lighting_shader);
 
     quad_.Draw();
+    gpu_profiler_.EndPass(GpuProfiler::Pass::kLighting);
 
     /* copy depth buffer */
+    gpu_profiler_.BeginPass(GpuProfiler::Pass::kDepthBlit);
     g_buffer_.SyncDepthBufferWithDefaultFramebuffer();
+    gpu_profiler_.EndPass(GpuProfiler::Pass::kDepthBlit);
 }
 
 void LibGcp::EngineBase::ProcessProgress(const uint64_t delta)
 {
+    PROFILE_SCOPE("Engine::ProcessProgress");
+
+    /* settings changed from the overlays since the previous frame */
+    input_recorder_.RecordSettingChanges();
+
+    /* previous frame is finished, preloaded scene can be swapped in */
+    scene_preloader_.Update();
+
     ProcessInput_(delta);
 
     if (SettingsMgr::GetInstance().GetSetting<Setting::kClockTicking, bool>()) {
@@ -127,28 +175,56 @@ void LibGcp::EngineBase::ProcessProgress(const uint64_t delta)
 
     view_.UpdateCameraPosition();
 
+    /* load world cells around the camera and unload the distant ones */
+    world_streamer_.Update(view_, delta);
+
+    /* load or drop mip levels of streamed textures according to their size on screen */
+    texture_streamer_.Update(view_);
+
+    /* swap in resources changed on disk */
+    ResourceMgr::GetInstance().ProcessHotReloads();
+
+    /* replace placeholders of lazily loaded models imported in the background */
+    ResourceMgr::GetInstance().ProcessLazyModels();
+
+    /* release resources nobody uses when over the budget */
+    ResourceMgr::GetInstance().EnforceMemoryBudget();
+
+    if (input_recorder_.IsRecording()) {
+        input_recorder_.EndFrame(delta, GetInputStateHash());
+    }
+
     /* Reset keys input for next frame */
     keys_.fill(0);
 }
 
 void LibGcp::EngineBase::ReloadScene(const Scene &scene)
 {
-    /* remove all objects */
-    ObjectMgr::GetInstance().GetStaticObjects().Clear();
+    PROFILE_SCOPE("Engine::ReloadScene");
+
+    frame_events_ |= static_cast<uint64_t>(FrameTelemetry::Event::kSceneReload);
+
+    /* cells of the previous scene are not part of any scene description */
+    world_streamer_.Close();
 
-    /* clean all resources */
-    ResourceMgr::GetInstance().GetModels().Clear();
-    ResourceMgr::GetInstance().GetShaders().Clear();
-    ResourceMgr::GetInstance().GetTextures().Clear();
+    /* release only resources missing from the new scene and load the new ones */
+    {
+        const StartupTimeline::Scope phase(StartupTimeline::Phase::kResourceUpload);
+        ResourceMgr::GetInstance().ReconcileResourcesWithScene(scene);
+    }
+
+    {
+        const StartupTimeline::Scope phase(StartupTimeline::Phase::kObjectCreation);
 
-    /* load resources */
-    ResourceMgr::GetInstance().LoadResourceFromScene(scene);
+        /* keep unchanged objects, move or recreate the rest */
+        ObjectMgr::GetInstance().ReconcileObjectsWithScene(scene);
 
-    /* load objects */
-    ObjectMgr::GetInstance().LoadObjectsFromScene(scene);
+        /* update lights of changed models only */
+        light_mgr_.ReconcileLightsWithScene(scene);
+    }
 
-    /* load lights */
-    light_mgr_.LoadLightsFromScene(scene);
+    /* model textures are released once no remaining model uses them */
+    ResourceMgr::GetInstance().ReleaseOrphanedResources();
 
     /* Note that settings must be loaded after all objects as there may be some events to fire */
     /* ensure default are loaded */
@@ -158,6 +234,129 @@ void LibGcp::EngineBase::ReloadScene(const Scene &scene)
     for (const auto &[setting, obj] : scene.settings) {
         SettingsMgr::GetInstance().SetSetting<uint64_t>(setting, obj.GetRaw());
     }
+
+    /* cells are loaded around the camera in the following frames */
+    world_streamer_.Open(scene.world_cells);
+}
+
+void LibGcp::EngineBase::StartInputRecording()
+{
+    input_recorder_.Start({
+        .camera_position     = free_camera_.position,
+        .camera_front        = free_camera_.front,
+        .camera_up           = free_camera_.up,
+        .camera_yaw          = free_camera_.yaw,
+        .camera_pitch        = free_camera_.pitch,
+        .flow_count          = flow_count_,
+        .word_tick_remainder = word_time_.GetTickRemainder(),
+    });
+}
+
+LibGcp::Rc LibGcp::EngineBase::StopInputRecording(const std::string &path)
+{
+    input_recorder_.Stop();
+
+    const auto &capture = input_recorder_.GetCapture();
+    TRACE("Saving " << capture.GetFrames().size() << " frames of input to " << path);
+
+    return capture.Save(path);
+}
+
+void LibGcp::EngineBase::BeginInputReplay(const InputCapture &capture)
+{
+    keys_.fill(0);
+
+    /* listeners fire as usual, so cameras are bound the same way as when the recording started */
+    const auto &settings = capture.GetSettings();
+    for (size_t idx = 0; idx < std::min(settings.size(), static_cast<size_t>(Setting::kLast)); ++idx) {
+        SettingsMgr::GetInstance().SetSetting<uint64_t>(static_cast<Setting>(idx), settings[idx]);
+    }
+
+    const auto &state     = capture.GetState();
+    free_camera_.position = state.camera_position;
+    free_camera_.front    = state.camera_front;
+    free_camera_.up       = state.camera_up;
+    free_camera_.yaw      = state.camera_yaw;
+    free_camera_.pitch    = state.camera_pitch;
+    flow_count_           = state.flow_count;
+    word_time_.SetTickRemainder(state.word_tick_remainder);
+
+    /* place the follow camera according to the restored counter */
+    ProcessDynamicObjects_(0);
+    view_.UpdateCameraPosition();
+}
+
+void LibGcp::EngineBase::ReplayInputFrame(const InputCapture &capture, const size_t frame)
+{
+    for (const auto &event : capture.GetFrameEvents(frame)) {
+        switch (event.type) {
+            case InputCapture::EventType::kKey:
+                /* overlays are not drawn by the replay, switching them has no effect on the frame */
+                if (event.code != GLFW_KEY_F12) {
+                    keys_[event.code] += static_cast<int>(event.value);
+                }
+                break;
+            case InputCapture::EventType::kMouseTurn:
+                Window::GetInstance().GetMouse().Turn(event.x_offset, event.y_offset);
+                break;
+            case InputCapture::EventType::kSetting:
+                SettingsMgr::GetInstance().SetSetting<uint64_t>(static_cast<Setting>(event.code), event.value);
+                break;
+            default:
+                R_ASSERT(false && "Unknown input event")
+        }
+    }
+}
+
+uint64_t LibGcp::EngineBase::GetInputStateHash() const noexcept
+{
+    const auto &camera = view_.GetBindObject();
+
+    ContentHasher hasher{};
+    hasher.Update(camera.position);
+    hasher.Update(camera.front);
+    hasher.Update(camera.up);
+    hasher.Update(camera.yaw);
+    hasher.Update(camera.pitch);
+
+    for (size_t idx = 0; idx < static_cast<size_t>(Setting::kLast); ++idx) {
+        hasher.Update(SettingsMgr::GetInstance().GetSetting<uint64_t>(static_cast<Setting>(idx)));
+    }
+
+    return hasher.Finalize().low;
+}
+
+void LibGcp::EngineBase::RecordFrameTelemetry(const FrameTelemetry::CpuTimes &times)
+{
+    const auto &texture_stats = texture_streamer_.GetStats();
+    if (texture_stats.uploaded_bytes != last_uploaded_texture_bytes_) {
+        frame_events_ |= static_cast<uint64_t>(FrameTelemetry::Event::kTextureStreaming);
+        last_uploaded_texture_bytes_ = texture_stats.uploaded_bytes;
+    }
+
+    const auto &world_stats = world_streamer_.GetStats();
+    if (world_stats.streamed_objects != last_streamed_objects_) {
+        frame_events_ |= static_cast<uint64_t>(FrameTelemetry::Event::kWorldStreaming);
+        last_streamed_objects_ = world_stats.streamed_objects;
+    }
+
+    /* counters are rolled over only when the next frame is drawn */
+    const auto &render_stats = RenderStats::GetCurrentFrame();
+    const uint64_t cpu_us    = times.draw_us + times.progress_us;
+
+    frame_telemetry_.Push({
+        .frame           = frame_telemetry_.GetPushedRecords(),
+        .timestamp_ns    = Profiler::GetTimestampNs(),
+        .cpu             = times,
+        .other_us        = times.frame_us > cpu_us ? times.frame_us - cpu_us : 0,
+        .gpu_pass_ms     = gpu_profiler_.GetLastSample(),
+        .counters        = render_stats.GetTotal(),
+        .visible_objects = render_stats.visible_objects,
+        .culled_objects  = render_stats.culled_objects,
+        .events          = frame_events_,
+    });
+
+    frame_events_ = 0;
 }
 
 void LibGcp::EngineBase::OnFrameBufferResized()
@@ -2,11 +2,17 @@
 #define ENGINE_ENGINE_HPP_
 
 #include <libcgp/defines.hpp>
+#include <libcgp/engine/frame_telemetry.hpp>
 #include <libcgp/engine/g_buffer.hpp>
 #include <libcgp/engine/global_light.hpp>
+#include <libcgp/engine/gpu_profiler.hpp>
+#include <libcgp/engine/input_capture.hpp>
 #include <libcgp/engine/light_mgr.hpp>
+#include <libcgp/engine/scene_preloader.hpp>
+#include <libcgp/engine/texture_streamer.hpp>
 #include <libcgp/engine/view.hpp>
 #include <libcgp/engine/word_time.hpp>
+#include <libcgp/engine/world_streamer.hpp>
 #include <libcgp/primitives/quad.hpp>
 #include <libcgp/primitives/shader.hpp>
 
@@ -16,6 +22,7 @@
 #include <cassert>
 #include <cstdint>
 #include <memory>
+#include <string>
 
 // clang-format off
 #include <glad/gl.h>
@@ -29,6 +36,8 @@ class EngineBase final : public CxxUtils::StaticSingletonHelper
     // Class internals
     // ------------------------------
 
+    static constexpr const char *kLightingPassShaderName = "deferred_shading//deferred_shading";
+
     // ------------------------------
     // Object creation
     // ------------------------------
@@ -51,9 +60,43 @@ class EngineBase final : public CxxUtils::StaticSingletonHelper
 
     FAST_CALL GlobalLights &GetGlobalLight() noexcept { return global_light_; }
 
+    NDSCRD FAST_CALL const TextureStreamer &GetTextureStreamer() const noexcept { return texture_streamer_; }
+
+    NDSCRD FAST_CALL const WorldStreamer &GetWorldStreamer() const noexcept { return world_streamer_; }
+
+    NDSCRD FAST_CALL ScenePreloader &GetScenePreloader() noexcept { return scene_preloader_; }
+
+    NDSCRD FAST_CALL GpuProfiler &GetGpuProfiler() noexcept { return gpu_profiler_; }
+
+    NDSCRD FAST_CALL FrameTelemetry &GetFrameTelemetry() noexcept { return frame_telemetry_; }
+
+    /* Called once the frame is presented, completes its record with the GPU times, counters and events */
+    void RecordFrameTelemetry(const FrameTelemetry::CpuTimes &times);
+
     void ProcessProgress(uint64_t delta);
 
-    FAST_CALL void ButtonPressed(const int key) { ++keys_[key]; }
+    FAST_CALL void ButtonPressed(const int key)
+    {
+        input_recorder_.RecordKey(key);
+        ++keys_[key];
+    }
+
+    /* input recording and replay */
+    NDSCRD FAST_CALL const InputRecorder &GetInputRecorder() const noexcept { return input_recorder_; }
+
+    void StartInputRecording();
+
+    /* Recording stops even when the capture fails to be saved */
+    NDSCRD Rc StopInputRecording(const std::string &path);
+
+    /* Restores the state the capture was recorded from, live input must not reach the engine afterwards */
+    void BeginInputReplay(const InputCapture &capture);
+
+    /* Feeds the input of the frame, must be called before the frame is drawn */
+    void ReplayInputFrame(const InputCapture &capture, size_t frame);
+
+    /* Hash of the camera and settings compared by the replay against the recorded one */
+    NDSCRD uint64_t GetInputStateHash() const noexcept;
 
     void ReloadScene(const Scene &scene);
 
@@ -64,6 +107,14 @@ class EngineBase final : public CxxUtils::StaticSingletonHelper
 
     FAST_CALL void MoveFreeCameraTo(const glm::vec3 &position) { free_camera_.position = position; }
 
+    /* Keeps yaw and pitch in sync, so mouse input continues from the new direction */
+    FAST_CALL void PointFreeCamera(const glm::vec3 &position, const glm::vec3 &front)
+    {
+        free_camera_.position = position;
+        free_camera_.front    = front;
+        free_camera_.ConvertVectorToYawPitch();
+    }
+
     // ---------------------------------
     // Class implementation methods
     // ---------------------------------
@@ -93,9 +144,20 @@ class EngineBase final : public CxxUtils::StaticSingletonHelper
     LightMgr light_mgr_{};
     View view_{};
     GBuffer g_buffer_{};
+    TextureStreamer texture_streamer_{};
+    WorldStreamer world_streamer_{};
+    ScenePreloader scene_preloader_{};
+    GpuProfiler gpu_profiler_{};
+    FrameTelemetry frame_telemetry_{};
+
+    /* Telemetry events of the frame, streaming is detected from the change of the streamers stats */
+    uint64_t frame_events_{};
+    size_t last_uploaded_texture_bytes_{};
+    size_t last_streamed_objects_{};
 
     /* Input */
     std::array<int, GLFW_KEY_LAST> keys_{};
+    InputRecorder input_recorder_{};
 
     /* Camera */
     // TODO: temp object
@@ -0,0 +1,275 @@
+#include <libcgp/engine/frame_telemetry.hpp>
+
+#include <libcgp/utils/macros.hpp>
+#include <libcgp/utils/profiler.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <ostream>
+#include <utility>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static constexpr uint64_t kWritingSequence = ~static_cast<uint64_t>(0);
+
+static constexpr std::array kEventNames{
+    std::pair{LibGcp::FrameTelemetry::Event::kSceneReload, "scene_reload"},
+    std::pair{LibGcp::FrameTelemetry::Event::kWorldStreaming, "world_streaming"},
+    std::pair{LibGcp::FrameTelemetry::Event::kTextureStreaming, "texture_streaming"},
+};
+
+static std::string GetGpuColumnName(const size_t pass)
+{
+    std::string name = LibGcp::GpuProfiler::GetPassName(static_cast<LibGcp::GpuProfiler::Pass>(pass));
+    for (char &symbol : name) {
+        symbol = symbol == ' ' ? '_' : static_cast<char>(std::tolower(static_cast<unsigned char>(symbol)));
+    }
+
+    return "gpu_" + name + "_ms";
+}
+
+static void WriteCsvHeader(std::ostream &out)
+{
+    out << "frame,timestamp_ms,frame_ms,draw_ms,progress_ms,other_ms";
+    for (size_t pass = 0; pass < LibGcp::GpuProfiler::kPassCount; ++pass) {
+        out << ',' << GetGpuColumnName(pass);
+    }
+    out << ",draw_calls,triangles,vertices,program_binds,vao_binds,texture_binds,framebuffer_binds,uniform_uploads,"
+           "uploaded_bytes,visible_objects,culled_objects,events\n";
+}
+
+static void WriteCsvRow(std::ostream &out, const LibGcp::FrameTelemetry::FrameRecord &record)
+{
+    const auto &counters = record.counters;
+
+    out << record.frame << ',' << static_cast<double>(record.timestamp_ns) / 1e6 << ','
+        << static_cast<double>(record.cpu.frame_us) / 1e3 << ',' << static_cast<double>(record.cpu.draw_us) / 1e3
+        << ',' << static_cast<double>(record.cpu.progress_us) / 1e3 << ','
+        << static_cast<double>(record.other_us) / 1e3;
+
+    for (const double pass_ms : record.gpu_pass_ms) {
+        out << ',' << pass_ms;
+    }
+
+    out << ',' << counters.draw_calls << ',' << counters.triangles << ',' << counters.vertices << ','
+        << counters.program_binds << ',' << counters.vao_binds << ',' << counters.texture_binds << ','
+        << counters.framebuffer_binds << ',' << counters.uniform_uploads << ',' << counters.uploaded_bytes << ','
+        << record.visible_objects << ',' << record.culled_objects << ','
+        << LibGcp::FrameTelemetry::GetEventNames(record.events) << '\n';
+}
+
+static void WriteJsonRecord(std::ostream &out, const LibGcp::FrameTelemetry::FrameRecord &record)
+{
+    const auto &counters = record.counters;
+
+    out << R"({"frame": )" << record.frame << R"(, "timestamp_ms": )" << static_cast<double>(record.timestamp_ns) / 1e6
+        << R"(, "frame_ms": )" << static_cast<double>(record.cpu.frame_us) / 1e3 << R"(, "draw_ms": )"
+        << static_cast<double>(record.cpu.draw_us) / 1e3 << R"(, "progress_ms": )"
+        << static_cast<double>(record.cpu.progress_us) / 1e3 << R"(, "other_ms": )"
+        << static_cast<double>(record.other_us) / 1e3;
+
+    for (size_t pass = 0; pass < LibGcp::GpuProfiler::kPassCount; ++pass) {
+        out << R"(, ")" << GetGpuColumnName(pass) << R"(": )" << record.gpu_pass_ms[pass];
+    }
+
+    out << R"(, "draw_calls": )" << counters.draw_calls << R"(, "triangles": )" << counters.triangles
+        << R"(, "vertices": )" << counters.vertices << R"(, "program_binds": )" << counters.program_binds
+        << R"(, "vao_binds": )" << counters.vao_binds << R"(, "texture_binds": )" << counters.texture_binds
+        << R"(, "framebuffer_binds": )" << counters.framebuffer_binds << R"(, "uniform_uploads": )"
+        << counters.uniform_uploads << R"(, "uploaded_bytes": )" << counters.uploaded_bytes
+        << R"(, "visible_objects": )" << record.visible_objects << R"(, "culled_objects": )"
+        << record.culled_objects << R"(, "events": ")" << LibGcp::FrameTelemetry::GetEventNames(record.events)
+        << "\"}";
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::FrameTelemetry::FrameTelemetry() : slots_(kCapacity) {}
+
+LibGcp::FrameTelemetry::~FrameTelemetry() { StopStreaming(); }
+
+void LibGcp::FrameTelemetry::Push(const FrameRecord &record) noexcept
+{
+    std::array<uint64_t, kRecordWords> words{};
+    std::memcpy(words.data(), &record, sizeof(FrameRecord));
+
+    const uint64_t idx = head_.load(std::memory_order_relaxed);
+    auto &slot         = slots_[idx % kCapacity];
+
+    slot.sequence.store(kWritingSequence, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t word = 0; word < kRecordWords; ++word) {
+        slot.words[word].store(words[word], std::memory_order_relaxed);
+    }
+
+    slot.sequence.store(idx + 1, std::memory_order_release);
+    head_.store(idx + 1, std::memory_order_release);
+}
+
+std::vector<LibGcp::FrameTelemetry::FrameRecord> LibGcp::FrameTelemetry::Snapshot() const
+{
+    std::vector<FrameRecord> records{};
+    records.reserve(kCapacity);
+    ReadSince_(0, records);
+
+    return records;
+}
+
+LibGcp::Rc LibGcp::FrameTelemetry::DumpCsv(const std::string &path) const
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        return Rc::kFailedToOpenFile;
+    }
+
+    WriteCsvHeader(file);
+    for (const auto &record : Snapshot()) {
+        WriteCsvRow(file, record);
+    }
+
+    return file.good() ? Rc::kSuccess : Rc::kUnknownFailure;
+}
+
+LibGcp::Rc LibGcp::FrameTelemetry::DumpJson(const std::string &path) const
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        return Rc::kFailedToOpenFile;
+    }
+
+    file << R"({"frames": [)";
+
+    bool is_first = true;
+    for (const auto &record : Snapshot()) {
+        file << (is_first ? "\n  " : ",\n  ");
+        WriteJsonRecord(file, record);
+        is_first = false;
+    }
+
+    file << "\n]}\n";
+    return file.good() ? Rc::kSuccess : Rc::kUnknownFailure;
+}
+
+LibGcp::Rc LibGcp::FrameTelemetry::StartStreaming(const std::string &path)
+{
+    StopStreaming();
+
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        return Rc::kFailedToOpenFile;
+    }
+
+    WriteCsvHeader(file);
+
+    stream_dropped_.store(0, std::memory_order_relaxed);
+    is_streaming_.store(true, std::memory_order_relaxed);
+    thread_ = std::thread([this, file = std::move(file)]() mutable {
+        RunStreaming_(std::move(file));
+    });
+
+    return Rc::kSuccess;
+}
+
+void LibGcp::FrameTelemetry::StopStreaming()
+{
+    {
+        const std::lock_guard lock(mutex_);
+        is_streaming_.store(false, std::memory_order_relaxed);
+    }
+    cv_.notify_all();
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+std::string LibGcp::FrameTelemetry::GetEventNames(const uint64_t events)
+{
+    std::string names{};
+    for (const auto &[event, name] : kEventNames) {
+        if ((events & static_cast<uint64_t>(event)) == 0) {
+            continue;
+        }
+
+        names += names.empty() ? "" : "|";
+        names += name;
+    }
+
+    return names;
+}
+
+uint64_t LibGcp::FrameTelemetry::ReadSince_(const uint64_t since, std::vector<FrameRecord> &out) const
+{
+    const uint64_t head  = head_.load(std::memory_order_acquire);
+    const uint64_t first = std::max(since, head > kCapacity ? head - kCapacity : 0);
+
+    std::array<uint64_t, kRecordWords> words{};
+    for (uint64_t idx = first; idx < head; ++idx) {
+        const auto &slot = slots_[idx % kCapacity];
+
+        if (slot.sequence.load(std::memory_order_acquire) != idx + 1) {
+            continue;
+        }
+
+        for (size_t word = 0; word < kRecordWords; ++word) {
+            words[word] = slot.words[word].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != idx + 1) {
+            continue;
+        }
+
+        FrameRecord record{};
+        std::memcpy(&record, words.data(), sizeof(FrameRecord));
+        out.push_back(record);
+    }
+
+    return head;
+}
+
+void LibGcp::FrameTelemetry::RunStreaming_(std::ofstream file)
+{
+    Profiler::SetThreadName("Frame telemetry");
+
+    /* records pushed before the streaming started are not streamed */
+    uint64_t next = head_.load(std::memory_order_acquire);
+    std::vector<FrameRecord> records{};
+    records.reserve(kCapacity);
+
+    bool is_running = true;
+    while (is_running) {
+        {
+            std::unique_lock lock(mutex_);
+            is_running = !cv_.wait_for(lock, std::chrono::milliseconds(kStreamIntervalMs), [this] {
+                return !is_streaming_.load(std::memory_order_relaxed);
+            });
+        }
+
+        records.clear();
+        const uint64_t head = ReadSince_(next, records);
+
+        /* records overwritten before they were read */
+        const uint64_t expected = head - next;
+        stream_dropped_.fetch_add(expected - records.size(), std::memory_order_relaxed);
+        next = head;
+
+        for (const auto &record : records) {
+            WriteCsvRow(file, record);
+        }
+        file.flush();
+
+        if (!file.good()) {
+            TRACE("Frame telemetry stream failed, stopping");
+            is_streaming_.store(false, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
@@ -0,0 +1,155 @@
+#ifndef ENGINE_FRAME_TELEMETRY_HPP_
+#define ENGINE_FRAME_TELEMETRY_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/engine/gpu_profiler.hpp>
+#include <libcgp/engine/render_stats.hpp>
+#include <libcgp/rc.hpp>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+LIBGCP_DECL_START_
+/**
+ * Fixed size ring of per frame records, written by the render thread without locks.
+ * Every slot is a small seqlock, readers copy records out of the ring and skip the ones overwritten meanwhile,
+ * so the ring may be dumped from any thread at any time. Streaming appends new records to the CSV file from
+ * a background thread, records overwritten before the thread got to them are counted as dropped.
+ */
+class FrameTelemetry
+{
+    // ------------------------------
+    // Class internals
+    // ------------------------------
+
+    public:
+    /* a bit over a minute at 60 fps */
+    static constexpr size_t kCapacity           = 4096;
+    static constexpr uint64_t kStreamIntervalMs = 250;
+
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    enum class Event : uint32_t {
+        kSceneReload      = 1 << 0,
+        kWorldStreaming   = 1 << 1,
+        kTextureStreaming = 1 << 2,
+    };
+
+    /* Measured on the render thread, in microseconds */
+    struct CpuTimes {
+        uint64_t frame_us;
+        uint64_t draw_us;
+        uint64_t progress_us;
+    };
+
+    struct FrameRecord {
+        uint64_t frame;
+        uint64_t timestamp_ns;
+        CpuTimes cpu;
+
+        /* overlays, event polling and the buffer swap */
+        uint64_t other_us;
+
+        /* latest collected GPU sample, it lags kFrameLatency frames behind the record */
+        GpuProfiler::FrameSample gpu_pass_ms;
+
+        RenderStats::Counters counters;
+        uint64_t visible_objects;
+        uint64_t culled_objects;
+
+        /* mask of Event values */
+        uint64_t events;
+    };
+
+    static_assert(std::is_trivially_copyable_v<FrameRecord>, "Records are copied word by word");
+    static_assert(sizeof(FrameRecord) % sizeof(uint64_t) == 0, "Records are copied word by word");
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    FrameTelemetry();
+
+    ~FrameTelemetry();
+
+    FrameTelemetry(const FrameTelemetry &) = delete;
+
+    FrameTelemetry &operator=(const FrameTelemetry &) = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    /* Render thread only, never blocks */
+    void Push(const FrameRecord &record) noexcept;
+
+    /* Records still present in the ring, oldest first */
+    NDSCRD std::vector<FrameRecord> Snapshot() const;
+
+    NDSCRD Rc DumpCsv(const std::string &path) const;
+
+    NDSCRD Rc DumpJson(const std::string &path) const;
+
+    /* Truncates the file and keeps appending new records to it until stopped */
+    NDSCRD Rc StartStreaming(const std::string &path);
+
+    /* Writes the remaining records before returning */
+    void StopStreaming();
+
+    NDSCRD FAST_CALL bool IsStreaming() const noexcept { return is_streaming_.load(std::memory_order_relaxed); }
+
+    NDSCRD FAST_CALL size_t GetStreamDroppedRecords() const noexcept
+    {
+        return stream_dropped_.load(std::memory_order_relaxed);
+    }
+
+    NDSCRD FAST_CALL uint64_t GetPushedRecords() const noexcept { return head_.load(std::memory_order_relaxed); }
+
+    /* Names joined with '|', empty for no events */
+    NDSCRD static std::string GetEventNames(uint64_t events);
+
+    // ---------------------------------
+    // Class implementation methods
+    // ---------------------------------
+
+    protected:
+    static constexpr size_t kRecordWords = sizeof(FrameRecord) / sizeof(uint64_t);
+
+    struct Slot {
+        std::atomic<uint64_t> sequence;
+        std::array<std::atomic<uint64_t>, kRecordWords> words;
+    };
+
+    /* Appends records pushed since the given index, returns the index to continue from */
+    uint64_t ReadSince_(uint64_t since, std::vector<FrameRecord> &out) const;
+
+    void RunStreaming_(std::ofstream file);
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    std::vector<Slot> slots_;
+    std::atomic<uint64_t> head_{};
+
+    std::mutex mutex_{};
+    std::condition_variable cv_{};
+    std::atomic<bool> is_streaming_{};
+    std::atomic<size_t> stream_dropped_{};
+    std::thread thread_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // ENGINE_FRAME_TELEMETRY_HPP_
@@ -1,5 +1,6 @@
 #include <libcgp/engine/g_buffer.hpp>
 
+#include <libcgp/engine/render_stats.hpp>
 #include <libcgp/window/window.hpp>
 
 // clang-format off
@@ -42,6 +43,8 @@ void LibGcp::GBuffer::DestroyBuffers()
         glDeleteFramebuffers(1, &g_buffer_);
         g_buffer_ = 0;
     }
+
+    allocation_.Release();
 }
 
 void LibGcp::GBuffer::PrepareBuffers()
@@ -88,11 +91,16 @@ void LibGcp::GBuffer::PrepareBuffers()
 
     R_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE && "Framebuffer is not complete!");
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    allocation_ = MemoryTracker::Allocation(
+        MemoryTracker::Category::kRenderTargets,
+        static_cast<size_t>(w) * static_cast<size_t>(h) * kBytesPerPixel, kMemoryOwner
+    );
 }
 
 void LibGcp::GBuffer::BindForWriting()
 {
-    glBindFramebuffer(GL_FRAMEBUFFER, g_buffer_);
+    GlBindFramebuffer(GL_FRAMEBUFFER, g_buffer_);
     glClearColor(0.2F, 0.2F, 0.2F, 1.0F);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
@@ -108,20 +116,20 @@ void LibGcp::GBuffer::SyncDepthBufferWithDefaultFramebuffer()
 {
     const auto [w, h] = Window::GetInstance().GetWindowSize();
 
-    glBindFramebuffer(GL_READ_FRAMEBUFFER, g_buffer_);
-    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    GlBindFramebuffer(GL_READ_FRAMEBUFFER, g_buffer_);
+    GlBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
     glBlitFramebuffer(0, 0, w, h, 0, 0, w, h, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    GlBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
 void LibGcp::GBuffer::BindTexturesForReading() const
 {
     glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, g_position_);
+    GlBindTexture(GL_TEXTURE_2D, g_position_);
 
     glActiveTexture(GL_TEXTURE1);
-    glBindTexture(GL_TEXTURE_2D, g_normal_);
+    GlBindTexture(GL_TEXTURE_2D, g_normal_);
 
     glActiveTexture(GL_TEXTURE2);
-    glBindTexture(GL_TEXTURE_2D, g_albedo_spec_);
+    GlBindTexture(GL_TEXTURE_2D, g_albedo_spec_);
 }
@@ -3,6 +3,7 @@
 
 #include <libcgp/defines.hpp>
 #include <libcgp/primitives/shader.hpp>
+#include <libcgp/utils/memory_tracker.hpp>
 
 #include <cstdint>
 
@@ -14,6 +15,11 @@ class GBuffer
     // Class internals
     // ------------------------------
 
+    static constexpr const char *kMemoryOwner = "g_buffer";
+
+    /* position, normal, albedo with specular and depth */
+    static constexpr size_t kBytesPerPixel = 8 + 8 + 4 + 4;
+
     // ------------------------------
     // Object creation
     // ------------------------------
@@ -53,6 +59,8 @@ class GBuffer
     uint32_t g_normal_{};
     uint32_t g_albedo_spec_{};
     uint32_t g_depth_{};
+
+    MemoryTracker::Allocation allocation_{};
 };
 
 LIBGCP_DECL_END_
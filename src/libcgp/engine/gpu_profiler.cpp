@@ -0,0 +1,218 @@
+#include <libcgp/engine/gpu_profiler.hpp>
+
+#include <libcgp/engine/render_stats.hpp>
+
+#include <glad/gl.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+/* Nearest rank percentile over the sorted samples */
+static double GetPercentile(const std::vector<double> &sorted, const double percentile) noexcept
+{
+    const auto rank = static_cast<size_t>(std::ceil(percentile * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::GpuProfiler::~GpuProfiler() { Destroy(); }
+
+void LibGcp::GpuProfiler::Init()
+{
+    for (auto &queries : queries_) {
+        glGenQueries(static_cast<GLsizei>(queries.size()), queries.data());
+    }
+
+    for (auto &issued : is_issued_) {
+        issued.fill(false);
+    }
+    is_frame_recorded_.fill(false);
+
+    frame_          = 0;
+    is_initialized_ = true;
+}
+
+void LibGcp::GpuProfiler::Destroy()
+{
+    if (!is_initialized_) {
+        return;
+    }
+
+    for (auto &queries : queries_) {
+        glDeleteQueries(static_cast<GLsizei>(queries.size()), queries.data());
+        queries.fill(0);
+    }
+
+    is_initialized_ = false;
+}
+
+void LibGcp::GpuProfiler::BeginFrame()
+{
+    if (!is_initialized_) {
+        return;
+    }
+
+    /* slot being reused was recorded kFrameLatency frames ago */
+    frame_ = (frame_ + 1) % kFrameLatency;
+    CollectFrame_(frame_, false);
+
+    is_frame_recorded_[frame_] = is_recording_;
+}
+
+void LibGcp::GpuProfiler::BeginPass(const Pass pass)
+{
+    RenderStats::BeginPass(pass);
+
+    if (!is_initialized_) {
+        return;
+    }
+
+    const auto idx = static_cast<size_t>(pass);
+    glBeginQuery(GL_TIME_ELAPSED, queries_[frame_][idx]);
+    is_issued_[frame_][idx] = true;
+}
+
+void LibGcp::GpuProfiler::EndPass(const Pass pass)
+{
+    RenderStats::EndPass();
+
+    if (!is_initialized_ || !is_issued_[frame_][static_cast<size_t>(pass)]) {
+        return;
+    }
+
+    glEndQuery(GL_TIME_ELAPSED);
+}
+
+LibGcp::GpuProfiler::PassStats LibGcp::GpuProfiler::GetStats(const Pass pass) const
+{
+    const auto idx    = static_cast<size_t>(pass);
+    const size_t size = history_size_[idx];
+
+    if (size == 0) {
+        return {};
+    }
+
+    std::vector<double> sorted(history_[idx].begin(), history_[idx].begin() + size);
+    std::ranges::sort(sorted);
+
+    double sum = 0.0;
+    for (const double sample : sorted) {
+        sum += sample;
+    }
+
+    return {
+        .samples    = size,
+        .average_ms = sum / static_cast<double>(size),
+        .p50_ms     = GetPercentile(sorted, 0.50),
+        .p95_ms     = GetPercentile(sorted, 0.95),
+        .p99_ms     = GetPercentile(sorted, 0.99),
+        .max_ms     = sorted.back(),
+    };
+}
+
+double LibGcp::GpuProfiler::GetAverageFrameMs() const
+{
+    double sum = 0.0;
+    for (size_t idx = 0; idx < kPassCount; ++idx) {
+        sum += GetStats(static_cast<Pass>(idx)).average_ms;
+    }
+
+    return sum;
+}
+
+void LibGcp::GpuProfiler::Reset() noexcept
+{
+    history_next_.fill(0);
+    history_size_.fill(0);
+    dropped_samples_ = 0;
+    last_sample_     = {};
+}
+
+void LibGcp::GpuProfiler::StartRecording()
+{
+    recorded_frames_.clear();
+    is_recording_ = true;
+}
+
+void LibGcp::GpuProfiler::StopRecording() noexcept { is_recording_ = false; }
+
+void LibGcp::GpuProfiler::Flush()
+{
+    if (!is_initialized_) {
+        return;
+    }
+
+    /* oldest frame first, so recorded frames stay in order */
+    for (size_t idx = 1; idx <= kFrameLatency; ++idx) {
+        CollectFrame_((frame_ + idx) % kFrameLatency, true);
+    }
+}
+
+const char *LibGcp::GpuProfiler::GetPassName(const Pass pass) noexcept
+{
+    switch (pass) {
+        case Pass::kGeometry:
+            return "Geometry";
+        case Pass::kLighting:
+            return "Lighting";
+        case Pass::kDepthBlit:
+            return "Depth blit";
+        case Pass::kOverlay:
+            return "Overlay";
+        default:
+            return "Unknown";
+    }
+}
+
+void LibGcp::GpuProfiler::CollectFrame_(const size_t frame, const bool should_wait)
+{
+    FrameSample sample{};
+    bool is_complete = true;
+
+    for (size_t pass = 0; pass < kPassCount; ++pass) {
+        if (!is_issued_[frame][pass]) {
+            continue;
+        }
+        is_issued_[frame][pass] = false;
+
+        GLint is_available = GL_TRUE;
+        if (!should_wait) {
+            glGetQueryObjectiv(queries_[frame][pass], GL_QUERY_RESULT_AVAILABLE, &is_available);
+        }
+
+        /* never wait for the result, the query is reused in this frame anyway */
+        if (is_available == GL_FALSE) {
+            ++dropped_samples_;
+            is_complete = false;
+            continue;
+        }
+
+        GLuint64 elapsed_ns = 0;
+        glGetQueryObjectui64v(queries_[frame][pass], GL_QUERY_RESULT, &elapsed_ns);
+
+        sample[pass] = static_cast<double>(elapsed_ns) / 1e6;
+        AddSample_(pass, sample[pass]);
+    }
+
+    last_sample_ = sample;
+
+    if (is_frame_recorded_[frame] && is_complete) {
+        recorded_frames_.push_back(sample);
+    }
+    is_frame_recorded_[frame] = false;
+}
+
+void LibGcp::GpuProfiler::AddSample_(const size_t pass, const double time_ms) noexcept
+{
+    history_[pass][history_next_[pass]] = time_ms;
+    history_next_[pass]                 = (history_next_[pass] + 1) % kHistorySize;
+    history_size_[pass]                 = std::min(history_size_[pass] + 1, kHistorySize);
+}
@@ -0,0 +1,155 @@
+#ifndef ENGINE_GPU_PROFILER_HPP_
+#define ENGINE_GPU_PROFILER_HPP_
+
+#include <libcgp/defines.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+LIBGCP_DECL_START_
+/**
+ * Measures GPU time of the render passes with GL_TIME_ELAPSED queries.
+ * Every frame uses its own set of queries from the ring, results are read back only kFrameLatency frames later
+ * and only when already available, so the render thread never waits for the GPU. Sample which is still not
+ * available when its query is reused is dropped.
+ * Last kHistorySize samples of each pass are kept for the rolling statistics.
+ */
+class GpuProfiler
+{
+    // ------------------------------
+    // Class internals
+    // ------------------------------
+
+    static constexpr size_t kFrameLatency = 4;
+    static constexpr size_t kHistorySize  = 240;
+
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    enum class Pass : size_t {
+        kGeometry,
+        kLighting,
+        kDepthBlit,
+        kOverlay,
+        kLast,
+    };
+
+    static constexpr size_t kPassCount = static_cast<size_t>(Pass::kLast);
+
+    /* Time of every pass in the frame in milliseconds */
+    using FrameSample = std::array<double, kPassCount>;
+
+    /* Computed over the samples in the history window, all times in milliseconds */
+    struct PassStats {
+        size_t samples;
+        double average_ms;
+        double p50_ms;
+        double p95_ms;
+        double p99_ms;
+        double max_ms;
+    };
+
+    /* Ends the pass when leaving the scope */
+    class ScopedPass
+    {
+        public:
+        ScopedPass(GpuProfiler &profiler, const Pass pass) : profiler_(profiler), pass_(pass)
+        {
+            profiler_.BeginPass(pass_);
+        }
+
+        ~ScopedPass() { profiler_.EndPass(pass_); }
+
+        ScopedPass(const ScopedPass &)            = delete;
+        ScopedPass &operator=(const ScopedPass &) = delete;
+
+        private:
+        GpuProfiler &profiler_;
+        Pass pass_;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    GpuProfiler() = default;
+
+    ~GpuProfiler();
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    void Init();
+
+    void Destroy();
+
+    /* Collects finished queries of the oldest frame in the ring and starts recording the new one */
+    void BeginFrame();
+
+    /* Passes must not overlap, only one time query may be active at once */
+    void BeginPass(Pass pass);
+
+    void EndPass(Pass pass);
+
+    NDSCRD PassStats GetStats(Pass pass) const;
+
+    /* Sum of the averages of all passes */
+    NDSCRD double GetAverageFrameMs() const;
+
+    NDSCRD FAST_CALL size_t GetDroppedSamples() const noexcept { return dropped_samples_; }
+
+    /* Pass times of the latest collected frame, kFrameLatency frames behind, dropped samples are zero */
+    NDSCRD FAST_CALL const FrameSample &GetLastSample() const noexcept { return last_sample_; }
+
+    /* Clears the history, e.g. before a benchmark run */
+    void Reset() noexcept;
+
+    /* Frames begun while recording are kept whole, frames with a dropped sample are skipped */
+    void StartRecording();
+
+    void StopRecording() noexcept;
+
+    /* Waits for all pending queries, meant only for the end of the measurement */
+    void Flush();
+
+    NDSCRD FAST_CALL const std::vector<FrameSample> &GetRecordedFrames() const noexcept { return recorded_frames_; }
+
+    NDSCRD static const char *GetPassName(Pass pass) noexcept;
+
+    // ---------------------------------
+    // Class implementation methods
+    // ---------------------------------
+
+    protected:
+    void CollectFrame_(size_t frame, bool should_wait);
+
+    void AddSample_(size_t pass, double time_ms) noexcept;
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    std::array<std::array<uint32_t, kPassCount>, kFrameLatency> queries_{};
+    std::array<std::array<bool, kPassCount>, kFrameLatency> is_issued_{};
+    std::array<bool, kFrameLatency> is_frame_recorded_{};
+    size_t frame_{};
+
+    std::array<std::array<double, kHistorySize>, kPassCount> history_{};
+    std::array<size_t, kPassCount> history_next_{};
+    std::array<size_t, kPassCount> history_size_{};
+    size_t dropped_samples_{};
+    FrameSample last_sample_{};
+
+    bool is_recording_{};
+    std::vector<FrameSample> recorded_frames_{};
+    bool is_initialized_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // ENGINE_GPU_PROFILER_HPP_
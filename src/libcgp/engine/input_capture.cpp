@@ -0,0 +1,247 @@
+#include <libcgp/engine/input_capture.hpp>
+
+#include <libcgp/mgr/settings_mgr.hpp>
+#include <libcgp/utils/chunk_codec.hpp>
+#include <libcgp/utils/files.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <span>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static constexpr size_t kSettingCount = static_cast<size_t>(LibGcp::Setting::kLast);
+
+template <class T>
+static std::vector<std::byte> EncodeRecords(const std::vector<T> &records)
+{
+    return LibGcp::ChunkCodec::Encode(
+        std::as_bytes(std::span(records)), LibGcp::ChunkCodec::Filter::kShuffle, static_cast<uint32_t>(sizeof(T))
+    );
+}
+
+template <class T>
+static bool ReadRecords(std::ifstream &file, const uint64_t chunk_size, const uint64_t count, std::vector<T> &out)
+{
+    std::vector<std::byte> chunk(chunk_size);
+    if (!file.read(reinterpret_cast<char *>(chunk.data()), static_cast<std::streamsize>(chunk.size()))) {
+        return false;
+    }
+
+    if (LibGcp::ChunkCodec::GetDecodedSize(chunk) != count * sizeof(T)) {
+        return false;
+    }
+
+    out.resize(count);
+    return LibGcp::ChunkCodec::Decode(chunk, std::as_writable_bytes(std::span(out)));
+}
+
+NDSCRD static uint64_t GetRawSetting(const size_t idx)
+{
+    return LibGcp::SettingsMgr::GetInstance().GetSetting<uint64_t>(static_cast<LibGcp::Setting>(idx));
+}
+
+static void ReadRawSettings(std::vector<uint64_t> &out)
+{
+    out.resize(kSettingCount);
+    for (size_t idx = 0; idx < kSettingCount; ++idx) {
+        out[idx] = GetRawSetting(idx);
+    }
+}
+
+static bool IsEventValid(const LibGcp::InputCapture::Event &event, const size_t frame_count)
+{
+    if (event.frame >= frame_count) {
+        return false;
+    }
+
+    switch (event.type) {
+        case LibGcp::InputCapture::EventType::kKey:
+            return event.code < GLFW_KEY_LAST;
+        case LibGcp::InputCapture::EventType::kMouseTurn:
+            return true;
+        case LibGcp::InputCapture::EventType::kSetting:
+            return event.code < kSettingCount;
+        default:
+            return false;
+    }
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::Rc LibGcp::InputCapture::Save(const std::string &path) const
+{
+    const auto frames_chunk = EncodeRecords(frames_);
+    const auto events_chunk = EncodeRecords(events_);
+
+    const Header header{
+        .magic             = kMagic,
+        .version           = kVersion,
+        .setting_count     = static_cast<uint32_t>(settings_.size()),
+        .frame_count       = frames_.size(),
+        .event_count       = events_.size(),
+        .frames_chunk_size = frames_chunk.size(),
+        .events_chunk_size = events_chunk.size(),
+        .state             = state_,
+    };
+
+    const std::string tmp_path = GetUniqueTempPath(path);
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return Rc::kFailedToOpenFile;
+    }
+
+    file.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+    file.write(
+        reinterpret_cast<const char *>(settings_.data()),
+        static_cast<std::streamsize>(settings_.size() * sizeof(uint64_t))
+    );
+    for (const auto *chunk : {&frames_chunk, &events_chunk}) {
+        file.write(reinterpret_cast<const char *>(chunk->data()), static_cast<std::streamsize>(chunk->size()));
+    }
+    file.close();
+
+    std::error_code ec;
+    if (file.fail() || (std::filesystem::rename(tmp_path, path, ec), ec)) {
+        std::filesystem::remove(tmp_path, ec);
+        return Rc::kFailedToOpenFile;
+    }
+
+    return Rc::kSuccess;
+}
+
+LibGcp::Rc LibGcp::InputCapture::Load(const std::string &path)
+{
+    Clear();
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return Rc::kFailedToOpenFile;
+    }
+
+    Header header{};
+    if (!file.read(reinterpret_cast<char *>(&header), sizeof(Header)) || header.magic != kMagic) {
+        return Rc::kCorruptedFile;
+    }
+
+    if (header.version != kVersion) {
+        return Rc::kOutdatedProtocol;
+    }
+
+    std::error_code ec;
+    const auto file_size = std::filesystem::file_size(path, ec);
+    const auto expected  = sizeof(Header) + static_cast<uint64_t>(header.setting_count) * sizeof(uint64_t) +
+                          header.frames_chunk_size + header.events_chunk_size;
+
+    /* sizes are checked one by one first, so the sum can not overflow */
+    if (ec || header.frames_chunk_size > file_size || header.events_chunk_size > file_size || expected != file_size) {
+        return Rc::kCorruptedFile;
+    }
+
+    state_ = header.state;
+    settings_.resize(header.setting_count);
+    file.read(
+        reinterpret_cast<char *>(settings_.data()), static_cast<std::streamsize>(settings_.size() * sizeof(uint64_t))
+    );
+
+    if (!file || !ReadRecords(file, header.frames_chunk_size, header.frame_count, frames_) ||
+        !ReadRecords(file, header.events_chunk_size, header.event_count, events_)) {
+        Clear();
+        return Rc::kCorruptedFile;
+    }
+
+    const bool are_events_valid = std::ranges::all_of(events_, [&](const Event &event) {
+        return IsEventValid(event, frames_.size());
+    });
+    const bool are_events_ordered = std::ranges::is_sorted(events_, {}, [](const Event &event) {
+        return static_cast<size_t>(event.frame);
+    });
+
+    if (!are_events_valid || !are_events_ordered) {
+        Clear();
+        return Rc::kCorruptedFile;
+    }
+
+    return Rc::kSuccess;
+}
+
+void LibGcp::InputCapture::Clear() noexcept
+{
+    state_ = {};
+    settings_.clear();
+    frames_.clear();
+    events_.clear();
+}
+
+std::span<const LibGcp::InputCapture::Event> LibGcp::InputCapture::GetFrameEvents(const size_t frame) const noexcept
+{
+    const auto [first, last] = std::ranges::equal_range(events_, frame, {}, [](const Event &event) {
+        return static_cast<size_t>(event.frame);
+    });
+
+    return {first, last};
+}
+
+void LibGcp::InputRecorder::Start(const InputCapture::State &state)
+{
+    capture_.Clear();
+    capture_.state_ = state;
+    ReadRawSettings(capture_.settings_);
+
+    last_settings_     = capture_.settings_;
+    frame_first_event_ = 0;
+    is_recording_      = true;
+}
+
+void LibGcp::InputRecorder::RecordSettingChanges()
+{
+    if (!is_recording_) {
+        return;
+    }
+
+    auto &events           = capture_.events_;
+    const size_t first_new = events.size();
+
+    for (size_t idx = 0; idx < kSettingCount; ++idx) {
+        const uint64_t value = GetRawSetting(idx);
+        if (value == last_settings_[idx]) {
+            continue;
+        }
+
+        AddEvent_({.type = InputCapture::EventType::kSetting, .code = static_cast<uint16_t>(idx), .value = value});
+        last_settings_[idx] = value;
+    }
+
+    /* changes were made by the overlays before any input of the frame was polled */
+    std::rotate(
+        events.begin() + static_cast<ptrdiff_t>(frame_first_event_), events.begin() + static_cast<ptrdiff_t>(first_new),
+        events.end()
+    );
+}
+
+void LibGcp::InputRecorder::EndFrame(const uint64_t delta_us, const uint64_t state_hash)
+{
+    if (!is_recording_) {
+        return;
+    }
+
+    /* deltas over an hour are not expected even from a stalled frame */
+    const auto delta = static_cast<uint32_t>(std::min<uint64_t>(delta_us, std::numeric_limits<uint32_t>::max()));
+    capture_.frames_.push_back({.delta_us = delta, .state_hash = state_hash});
+    frame_first_event_ = capture_.events_.size();
+
+    ReadRawSettings(last_settings_);
+}
+
+void LibGcp::InputRecorder::AddEvent_(InputCapture::Event event)
+{
+    /* events arriving before the frame is ended belong to it */
+    event.frame = static_cast<uint32_t>(capture_.frames_.size());
+    capture_.events_.push_back(event);
+}
@@ -0,0 +1,200 @@
+#ifndef ENGINE_INPUT_CAPTURE_HPP_
+#define ENGINE_INPUT_CAPTURE_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/rc.hpp>
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+LIBGCP_DECL_START_
+/**
+ * Input of a recorded session: key presses, mouse turns and setting changes, each stamped with the frame it was
+ * consumed in, together with the clock delta of every frame and the state needed to start the replay from the
+ * same point. Every frame also stores the hash of the camera and settings reached at its end, so replays may be
+ * checked to stay frame exact.
+ *
+ * File layout:
+ *  Header, uint64_t settings[setting_count], chunk of Frame[frame_count], chunk of Event[event_count]
+ * Both chunks are written with ChunkCodec using the shuffle filter over the records.
+ */
+class InputCapture
+{
+    // ------------------------------
+    // Class internals
+    // ------------------------------
+
+    public:
+    static constexpr uint64_t kMagic                 = 0x3150414349434C47ULL;
+    static constexpr uint32_t kVersion               = 1;
+    static constexpr const char *kFileExtension      = ".libgcp_input";
+    static constexpr const char *kDefaultCapturePath = "input_capture.libgcp_input";
+
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    enum class EventType : uint8_t {
+        kKey,
+        kMouseTurn,
+        kSetting,
+        kLast,
+    };
+
+    struct PACK Event {
+        uint32_t frame;
+        EventType type;
+
+        /* key or setting */
+        uint16_t code;
+
+        /* raw setting value */
+        uint64_t value;
+
+        /* mouse offsets before the sensitivity is applied */
+        double x_offset;
+        double y_offset;
+    };
+
+    struct PACK Frame {
+        uint32_t delta_us;
+        uint64_t state_hash;
+    };
+
+    /* Engine state not covered by the settings */
+    struct PACK State {
+        glm::vec3 camera_position;
+        glm::vec3 camera_front;
+        glm::vec3 camera_up;
+        double camera_yaw;
+        double camera_pitch;
+        double flow_count;
+        uint64_t word_tick_remainder;
+    };
+
+    struct PACK Header {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t setting_count;
+        uint64_t frame_count;
+        uint64_t event_count;
+        uint64_t frames_chunk_size;
+        uint64_t events_chunk_size;
+        State state;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    InputCapture() = default;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    /* Written through a temporary file, existing file is replaced only by a complete capture */
+    NDSCRD Rc Save(const std::string &path) const;
+
+    NDSCRD Rc Load(const std::string &path);
+
+    void Clear() noexcept;
+
+    NDSCRD FAST_CALL const State &GetState() const noexcept { return state_; }
+
+    NDSCRD FAST_CALL const std::vector<uint64_t> &GetSettings() const noexcept { return settings_; }
+
+    NDSCRD FAST_CALL const std::vector<Frame> &GetFrames() const noexcept { return frames_; }
+
+    NDSCRD FAST_CALL const std::vector<Event> &GetEvents() const noexcept { return events_; }
+
+    /* Events are kept in the order they were recorded, so those of one frame are adjacent */
+    NDSCRD std::span<const Event> GetFrameEvents(size_t frame) const noexcept;
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    protected:
+    friend class InputRecorder;
+
+    State state_{};
+    std::vector<uint64_t> settings_{};
+    std::vector<Frame> frames_{};
+    std::vector<Event> events_{};
+};
+
+/**
+ * Fills the capture while the user plays. Key presses and mouse turns are recorded by the input callbacks as
+ * they arrive, setting changes are found by comparing all settings against their values at the end of the
+ * previous frame, so changes made by the engine itself are never recorded, only those made from the overlays.
+ */
+class InputRecorder
+{
+    public:
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    InputRecorder() = default;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    /* Previous capture is dropped */
+    void Start(const InputCapture::State &state);
+
+    FAST_CALL void Stop() noexcept { is_recording_ = false; }
+
+    NDSCRD FAST_CALL bool IsRecording() const noexcept { return is_recording_; }
+
+    NDSCRD FAST_CALL const InputCapture &GetCapture() const noexcept { return capture_; }
+
+    FAST_CALL void RecordKey(const int key)
+    {
+        if (is_recording_) {
+            AddEvent_({.type = InputCapture::EventType::kKey, .code = static_cast<uint16_t>(key), .value = 1});
+        }
+    }
+
+    FAST_CALL void RecordMouseTurn(const double x_offset, const double y_offset)
+    {
+        if (is_recording_) {
+            AddEvent_({.type = InputCapture::EventType::kMouseTurn, .x_offset = x_offset, .y_offset = y_offset});
+        }
+    }
+
+    /* Called before the frame consumes its input */
+    void RecordSettingChanges();
+
+    /* Called once the frame consumed its input, settings changed by the engine meanwhile are not recorded */
+    void EndFrame(uint64_t delta_us, uint64_t state_hash);
+
+    // ---------------------------------
+    // Class implementation methods
+    // ---------------------------------
+
+    protected:
+    void AddEvent_(InputCapture::Event event);
+
+    void SyncSettings_();
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    InputCapture capture_{};
+    std::vector<uint64_t> last_settings_{};
+    size_t frame_first_event_{};
+    bool is_recording_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // ENGINE_INPUT_CAPTURE_HPP_
@@ -8,7 +8,11 @@
 #include <libcgp/primitives/shader.hpp>
 #include <libcgp/utils/macros.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // ------------------------------
 // Statics
@@ -74,28 +78,105 @@ void LightGetFunc<>(Shader &shader, uint64_t *counter, const SpotLight &light, c
     shader.SetGLfloat((prefix + "outer_cut_off").c_str(), light.spot_light.outer_cut_off);
 }
 
+struct ModelLights {
+    std::vector<PointLight> point_lights{};
+    std::vector<SpotLight> spot_lights{};
+};
+
+static bool IsSameLight(const PointLight &lhs, const PointLight &rhs)
+{
+    return lhs.light_info == rhs.light_info && lhs.point_light == rhs.point_light;
+}
+
+static bool IsSameLight(const SpotLight &lhs, const SpotLight &rhs)
+{
+    return lhs.light_info == rhs.light_info && lhs.spot_light == rhs.spot_light;
+}
+
+/* Returns true when the lights of the model had to be replaced */
+template <class T>
+static bool ReplaceLightsIfChanged(LightContainer &container, std::vector<T> &&lights)
+{
+    auto &current = container.GetUnderlyingData<T>();
+
+    if (std::ranges::equal(current, lights, [](const T &lhs, const T &rhs) {
+            return IsSameLight(lhs, rhs);
+        })) {
+        return false;
+    }
+
+    current = std::move(lights);
+    return true;
+}
+
+static std::unordered_map<std::string, ModelLights> GroupLightsByModel(
+    const point_lights_t &point_lights, const spot_lights_t &spot_lights
+)
+{
+    std::unordered_map<std::string, ModelLights> model_lights{};
+
+    for (const auto &point_light_spec : point_lights) {
+        model_lights[point_light_spec.model_name].point_lights.emplace_back(point_light_spec);
+    }
+
+    for (const auto &spot_light_spec : spot_lights) {
+        model_lights[spot_light_spec.model_name].spot_lights.emplace_back(spot_light_spec);
+    }
+
+    return model_lights;
+}
+
+/* Replaces lights only on models where they differ, returns number of changed models */
+static size_t ApplyModelLights(std::unordered_map<std::string, ModelLights> model_lights)
+{
+    size_t changed_models{};
+    for (auto &[model_name, lights] : model_lights) {
+        auto model = ResourceMgr::GetInstance().GetModel(model_name, LoadType::kExternal);
+        R_ASSERT(model != nullptr && "Model not found for light object!");
+
+        const bool point_changed = ReplaceLightsIfChanged(model->GetLights(), std::move(lights.point_lights));
+        const bool spot_changed  = ReplaceLightsIfChanged(model->GetLights(), std::move(lights.spot_lights));
+        changed_models += point_changed || spot_changed;
+    }
+
+    return changed_models;
+}
+
 LIBGCP_DECL_END_
 
 // ------------------------------
 // Implementations
 // ------------------------------
 
-void LibGcp::LightMgr::LoadLightsFromScene(const Scene &scene)
+void LibGcp::LightMgr::ReconcileLightsWithScene(const Scene &scene)
 {
-    /* Load point lights */
-    for (const auto &point_light_spec : scene.point_lights) {
-        auto model = ResourceMgr::GetInstance().GetModel(point_light_spec.model_name, LoadType::kExternal);
-        R_ASSERT(model != nullptr && "Model not found for light object!");
+    const auto scene_lights = GroupLightsByModel(scene.point_lights, scene.spot_lights);
 
-        model->GetLights().emplace_back<PointLight>(point_light_spec);
-    }
+    size_t changed_models = ApplyModelLights(scene_lights);
 
-    /* Load spotlights */
-    for (const auto &spot_light_spec : scene.spot_lights) {
-        auto model = ResourceMgr::GetInstance().GetModel(spot_light_spec.model_name, LoadType::kExternal);
-        R_ASSERT(model != nullptr && "Model not found for light object!");
-        model->GetLights().emplace_back<SpotLight>(spot_light_spec);
+    /* Drop lights of models having none in the new scene */
+    ResourceMgr::GetInstance().GetModels().Lock();
+
+    for (const auto &[model_name, model] : ResourceMgr::GetInstance().GetModels()) {
+        if (scene_lights.contains(model_name) || model->GetLights().IsEmpty()) {
+            continue;
+        }
+
+        model->GetLights().GetUnderlyingData<PointLight>().clear();
+        model->GetLights().GetUnderlyingData<SpotLight>().clear();
+        ++changed_models;
     }
+
+    ResourceMgr::GetInstance().GetModels().Unlock();
+
+    TRACE("Reconciled lights, changed models: " << changed_models);
+}
+
+void LibGcp::LightMgr::ApplyLights(const point_lights_t &point_lights, const spot_lights_t &spot_lights)
+{
+    const size_t changed_models = ApplyModelLights(GroupLightsByModel(point_lights, spot_lights));
+
+    TRACE("Applied lights, changed models: " << changed_models);
 }
 
 void LibGcp::LightMgr::PrepareLights(Shader &shader) const
@@ -119,6 +200,50 @@ void LibGcp::LightMgr::PrepareLights(Shader &shader) const
     R_ASSERT(counters[kSpotLightIdx] < kMaxTypeLightObjects && "Too many spot lights");
     R_ASSERT(counters[kPointLightIdx] + counters[kSpotLightIdx] < kMaxLightObjects && "Too many lights");
 
-    shader.SetGLuint("un_lightning.num_point_lights", counters[kPointLightIdx]);
-    shader.SetGLuint("un_lightning.num_spot_lights", counters[kSpotLightIdx]);
+    /* specialized permutations have the counts compiled in */
+    if (!shader.HasDefine(kPointLightsCountDefine)) {
+        shader.SetGLuint("un_lightning.num_point_lights", counters[kPointLightIdx]);
+    }
+
+    if (!shader.HasDefine(kSpotLightsCountDefine)) {
+        shader.SetGLuint("un_lightning.num_spot_lights", counters[kSpotLightIdx]);
+    }
+}
+
+std::shared_ptr<LibGcp::Shader> LibGcp::LightMgr::GetSpecializedShader(const char *shader_name)
+{
+    if (UpdateSpecializationDefines_()) {
+        specialized_shader_.reset();
+    }
+
+    if (!specialized_shader_) {
+        specialized_shader_ = ResourceMgr::GetInstance().GetShaderVariant(shader_name, defines_);
+    }
+
+    return specialized_shader_;
+}
+
+bool LibGcp::LightMgr::UpdateSpecializationDefines_()
+{
+    size_t point_lights{};
+    size_t spot_lights{};
+
+    for (const auto &obj : ObjectMgr::GetInstance().GetStaticObjects()) {
+        point_lights += obj.GetModel()->GetLights().size<PointLight>();
+        spot_lights += obj.GetModel()->GetLights().size<SpotLight>();
+    }
+
+    if (has_defines_ && point_lights == point_lights_count_ && spot_lights == spot_lights_count_) {
+        return false;
+    }
+
+    point_lights_count_ = point_lights;
+    spot_lights_count_  = spot_lights;
+    has_defines_        = true;
+    defines_            = {
+        {kPointLightsCountDefine, std::to_string(point_lights) + "u"},
+        {kSpotLightsCountDefine, std::to_string(spot_lights) + "u"},
+    };
+
+    return true;
 }
@@ -6,11 +6,12 @@
 #include <libcgp/utils/macros.hpp>
 
 #include <libcgp/primitives/model.hpp>
+#include <libcgp/primitives/shader.hpp>
 
-LIBGCP_DECL_START_
+#include <memory>
+#include <string>
 
-/* Forward declarations */
-class Shader;
+LIBGCP_DECL_START_
 
 class LightMgr
 {
@@ -19,6 +20,10 @@ class LightMgr
     // ------------------------------
 
     public:
+    /* defines fixing light counts in the lighting pass shader */
+    static constexpr const char *kPointLightsCountDefine = "NUM_POINT_LIGHTS";
+    static constexpr const char *kSpotLightsCountDefine  = "NUM_SPOT_LIGHTS";
+
     // ------------------------------
     // Object creation
     // ------------------------------
@@ -27,10 +32,21 @@ class LightMgr
     // Object interaction
     // ------------------------------
 
-    void LoadLightsFromScene(const Scene &scene);
+    /* Replaces lights only on the models whose lights differ from the new scene */
+    void ReconcileLightsWithScene(const Scene &scene);
+
+    /* Replaces lights of the listed models only, lights of other models are left untouched */
+    static void ApplyLights(const point_lights_t &point_lights, const spot_lights_t &spot_lights);
 
     void PrepareLights(Shader &shader) const;
 
+    /**
+     * Permutation of the given shader with current light counts compiled in, nullptr until it is compiled.
+     * Lights are edited in place by many callers, so the counts are the change signal: defines and the variant
+     * lookup are rebuilt only when they differ from the previous frame.
+     */
+    NDSCRD std::shared_ptr<Shader> GetSpecializedShader(const char *shader_name);
+
     template <typename T>
     FAST_CALL static void AddLight(Model &model, const T &light)
     {
@@ -43,9 +59,20 @@ class LightMgr
     // ---------------------------------
 
     protected:
+    /* Rebuilds the defines when the counts changed, returns true in that case */
+    bool UpdateSpecializationDefines_();
+
     // ------------------------------
     // Class fields
     // ------------------------------
+
+    size_t point_lights_count_{};
+    size_t spot_lights_count_{};
+    bool has_defines_{};
+    shader_defines_t defines_{};
+
+    /* variant matching the defines, kept once ready so the manager is not asked every frame */
+    std::shared_ptr<Shader> specialized_shader_{};
 };
 
 LIBGCP_DECL_END_
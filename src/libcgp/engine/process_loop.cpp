@@ -1,6 +1,9 @@
 #include <libcgp/engine/engine.hpp>
+#include <libcgp/engine/frame_telemetry.hpp>
 #include <libcgp/engine/process_loop.hpp>
+#include <libcgp/engine/startup_timeline.hpp>
 #include <libcgp/mgr/object_mgr.hpp>
+#include <libcgp/utils/profiler.hpp>
 #include <libcgp/window/window.hpp>
 
 // clang-format off
@@ -9,26 +12,51 @@
 // clang-format on
 
 #include <chrono>
+#include <cstdint>
 #include <string>
 
+static uint64_t ElapsedUs(
+    const std::chrono::steady_clock::time_point start, const std::chrono::steady_clock::time_point end
+)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+}
+
 void LibGcp::ProcessLoopApp()
 {
     Window::GetInstance().InitDebug();
+    Profiler::SetThreadName("Render");
 
     /* At this point all events should be connected */
-    auto last_frame = std::chrono::steady_clock::now();
+    auto last_frame       = std::chrono::steady_clock::now();
+    auto last_frame_start = last_frame;
+    FrameTelemetry::CpuTimes frame_times{};
+    bool is_first_frame = true;
+
     Window::GetInstance().RunLoop([&] {
+        const auto frame_start = std::chrono::steady_clock::now();
+
+        /* previous frame is presented by now, so its record is complete */
+        if (!is_first_frame) {
+            frame_times.frame_us = ElapsedUs(last_frame_start, frame_start);
+            Engine::GetInstance().RecordFrameTelemetry(frame_times);
+            StartupTimeline::MarkFirstFrame();
+        }
+        last_frame_start = frame_start;
+        is_first_frame   = false;
+
         //  Render objects
         Engine::GetInstance().Draw();
 
         // Process progress
-        const auto new_frame = std::chrono::steady_clock::now();
-        const uint64_t delta_time_ms =
-            std::chrono::duration_cast<std::chrono::microseconds>(new_frame - last_frame).count();
-        last_frame = new_frame;
+        const auto new_frame         = std::chrono::steady_clock::now();
+        const uint64_t delta_time_us = ElapsedUs(last_frame, new_frame);
+        last_frame                   = new_frame;
+
+        Engine::GetInstance().ProcessProgress(delta_time_us);
 
-        // TRACE("Curr fps: " << 1000000.0F / delta_time_ms);
-        Engine::GetInstance().ProcessProgress(delta_time_ms);
+        frame_times.draw_us     = ElapsedUs(frame_start, new_frame);
+        frame_times.progress_us = ElapsedUs(new_frame, std::chrono::steady_clock::now());
     });
 
     Window::GetInstance().DestroyDebug();
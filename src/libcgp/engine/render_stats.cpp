@@ -0,0 +1,46 @@
+#include <libcgp/engine/render_stats.hpp>
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::RenderStats::Counters &LibGcp::RenderStats::Counters::operator+=(const Counters &other) noexcept
+{
+    draw_calls += other.draw_calls;
+    triangles += other.triangles;
+    vertices += other.vertices;
+    program_binds += other.program_binds;
+    vao_binds += other.vao_binds;
+    texture_binds += other.texture_binds;
+    framebuffer_binds += other.framebuffer_binds;
+    uniform_uploads += other.uniform_uploads;
+    uploaded_bytes += other.uploaded_bytes;
+
+    return *this;
+}
+
+LibGcp::RenderStats::Counters LibGcp::RenderStats::FrameStats::GetTotal() const noexcept
+{
+    Counters total{};
+    for (const auto &slot : slots) {
+        total += slot;
+    }
+
+    return total;
+}
+
+void LibGcp::RenderStats::BeginFrame() noexcept
+{
+    last_frame_    = current_frame_;
+    current_frame_ = {};
+    slot_          = kOutsidePassSlot;
+}
+
+const char *LibGcp::RenderStats::GetSlotName(const size_t slot) noexcept
+{
+    if (slot >= kOutsidePassSlot) {
+        return "Outside passes";
+    }
+
+    return GpuProfiler::GetPassName(static_cast<GpuProfiler::Pass>(slot));
+}
@@ -0,0 +1,232 @@
+#ifndef ENGINE_RENDER_STATS_HPP_
+#define ENGINE_RENDER_STATS_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/engine/gpu_profiler.hpp>
+
+#include <glad/gl.h>
+
+#include <array>
+#include <cstddef>
+
+LIBGCP_DECL_START_
+/**
+ * Per frame and per pass counters of the GL work issued by the renderer.
+ * Counting happens in the thin Gl* wrappers below, so only calls routed through them are seen. Passes are the ones
+ * timed by the GpuProfiler, work issued outside of any pass, e.g. streaming uploads, lands in the last slot.
+ *
+ * Counters are owned by the render thread, they are compiled out unless USE_RENDER_STATS is enabled,
+ * which is the case for all builds but release.
+ */
+class RenderStats
+{
+    // ------------------------------
+    // Class internals
+    // ------------------------------
+
+    public:
+#ifdef USE_RENDER_STATS_
+    static constexpr bool kUseRenderStats = true;
+#else
+    static constexpr bool kUseRenderStats = false;
+#endif
+
+    /* passes of the gpu profiler followed by the slot for work outside of them */
+    static constexpr size_t kOutsidePassSlot = GpuProfiler::kPassCount;
+    static constexpr size_t kSlotCount       = GpuProfiler::kPassCount + 1;
+
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    struct Counters {
+        size_t draw_calls;
+        size_t triangles;
+        size_t vertices;
+        size_t program_binds;
+        size_t vao_binds;
+        size_t texture_binds;
+        size_t framebuffer_binds;
+        size_t uniform_uploads;
+        size_t uploaded_bytes;
+
+        Counters &operator+=(const Counters &other) noexcept;
+    };
+
+    struct FrameStats {
+        std::array<Counters, kSlotCount> slots;
+        size_t visible_objects;
+        size_t culled_objects;
+
+        NDSCRD Counters GetTotal() const noexcept;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    RenderStats() = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    /* Finishes the frame being counted, it becomes available through GetLastFrame */
+    static void BeginFrame() noexcept;
+
+    WRAP_CALL static void BeginPass(const GpuProfiler::Pass pass) noexcept { slot_ = static_cast<size_t>(pass); }
+
+    WRAP_CALL static void EndPass() noexcept { slot_ = kOutsidePassSlot; }
+
+    /* Last finished frame, must be read from the render thread */
+    NDSCRD FAST_CALL static const FrameStats &GetLastFrame() noexcept { return last_frame_; }
+
+    /* Frame still being counted, complete once presented and until the next BeginFrame */
+    NDSCRD FAST_CALL static const FrameStats &GetCurrentFrame() noexcept { return current_frame_; }
+
+    NDSCRD static const char *GetSlotName(size_t slot) noexcept;
+
+    WRAP_CALL static void AddDraw(const GLenum mode, const GLsizei count) noexcept
+    {
+        auto &counters      = current_frame_.slots[slot_];
+        const auto vertices = static_cast<size_t>(count);
+
+        ++counters.draw_calls;
+        counters.vertices += vertices;
+
+        if (mode == GL_TRIANGLES) {
+            counters.triangles += vertices / 3;
+        } else if ((mode == GL_TRIANGLE_STRIP || mode == GL_TRIANGLE_FAN) && vertices > 2) {
+            counters.triangles += vertices - 2;
+        }
+    }
+
+    WRAP_CALL static void AddProgramBind() noexcept { ++current_frame_.slots[slot_].program_binds; }
+
+    WRAP_CALL static void AddVaoBind() noexcept { ++current_frame_.slots[slot_].vao_binds; }
+
+    WRAP_CALL static void AddTextureBind() noexcept { ++current_frame_.slots[slot_].texture_binds; }
+
+    WRAP_CALL static void AddFramebufferBind() noexcept { ++current_frame_.slots[slot_].framebuffer_binds; }
+
+    WRAP_CALL static void AddUniformUpload() noexcept { ++current_frame_.slots[slot_].uniform_uploads; }
+
+    WRAP_CALL static void AddUpload(const size_t bytes) noexcept
+    {
+        current_frame_.slots[slot_].uploaded_bytes += bytes;
+    }
+
+    WRAP_CALL static void AddObjects(const size_t visible, const size_t culled) noexcept
+    {
+        current_frame_.visible_objects += visible;
+        current_frame_.culled_objects += culled;
+    }
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    protected:
+    static inline FrameStats current_frame_{};
+    static inline FrameStats last_frame_{};
+    static inline size_t slot_{kOutsidePassSlot};
+};
+
+// ------------------------------
+// Counted GL calls
+// ------------------------------
+
+WRAP_CALL void GlDrawElements(const GLenum mode, const GLsizei count, const GLenum type, const void *indices)
+{
+    if constexpr (RenderStats::kUseRenderStats) {
+        RenderStats::AddDraw(mode, count);
+    }
+
+    glDrawElements(mode, count, type, indices);
+}
+
+WRAP_CALL void GlDrawArrays(const GLenum mode, const GLint first, const GLsizei count)
+{
+    if constexpr (RenderStats::kUseRenderStats) {
+        RenderStats::AddDraw(mode, count);
+    }
+
+    glDrawArrays(mode, first, count);
+}
+
+WRAP_CALL void GlUseProgram(const GLuint program)
+{
+    if constexpr (RenderStats::kUseRenderStats) {
+        RenderStats::AddProgramBind();
+    }
+
+    glUseProgram(program);
+}
+
+WRAP_CALL void GlBindVertexArray(const GLuint vao)
+{
+    if constexpr (RenderStats::kUseRenderStats) {
+        RenderStats::AddVaoBind();
+    }
+
+    glBindVertexArray(vao);
+}
+
+WRAP_CALL void GlBindTexture(const GLenum target, const GLuint texture)
+{
+    if constexpr (RenderStats::kUseRenderStats) {
+        RenderStats::AddTextureBind();
+    }
+
+    glBindTexture(target, texture);
+}
+
+WRAP_CALL void GlBindFramebuffer(const GLenum target, const GLuint framebuffer)
+{
+    if constexpr (RenderStats::kUseRenderStats) {
+        RenderStats::AddFramebufferBind();
+    }
+
+    glBindFramebuffer(target, framebuffer);
+}
+
+/* Buffers allocated without data are not counted, their content is written through the mapping */
+WRAP_CALL void GlBufferData(const GLenum target, const GLsizeiptr size, const void *data, const GLenum usage)
+{
+    if constexpr (RenderStats::kUseRenderStats) {
+        if (data != nullptr) {
+            RenderStats::AddUpload(static_cast<size_t>(size));
+        }
+    }
+
+    glBufferData(target, size, data, usage);
+}
+
+/* Mapped range is counted as uploaded when it is mapped for writing */
+WRAP_CALL void *GlMapBufferRange(
+    const GLenum target, const GLintptr offset, const GLsizeiptr length, const GLbitfield access
+)
+{
+    if constexpr (RenderStats::kUseRenderStats) {
+        if ((access & GL_MAP_WRITE_BIT) != 0) {
+            RenderStats::AddUpload(static_cast<size_t>(length));
+        }
+    }
+
+    return glMapBufferRange(target, offset, length, access);
+}
+
+/* Forwards to any glUniform* entry point */
+template <class FuncT, class... Args>
+WRAP_CALL void GlUniform(FuncT func, Args... args)
+{
+    if constexpr (RenderStats::kUseRenderStats) {
+        RenderStats::AddUniformUpload();
+    }
+
+    func(args...);
+}
+
+LIBGCP_DECL_END_
+
+#endif  // ENGINE_RENDER_STATS_HPP_
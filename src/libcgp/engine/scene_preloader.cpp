@@ -0,0 +1,212 @@
+#include <libcgp/engine/engine.hpp>
+#include <libcgp/engine/scene_preloader.hpp>
+#include <libcgp/mgr/resource_mgr.hpp>
+#include <libcgp/mgr/settings_mgr.hpp>
+#include <libcgp/serialization/scene_serializer.hpp>
+#include <libcgp/utils/macros.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <utility>
+
+#include <assimp/Importer.hpp>
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::ScenePreloader::~ScenePreloader() { Stop(); }
+
+void LibGcp::ScenePreloader::Start() { importer_.Start(); }
+
+void LibGcp::ScenePreloader::Stop()
+{
+    Cancel();
+    importer_.Stop();
+}
+
+void LibGcp::ScenePreloader::Preload(const std::string &directory, const std::string &scene_name, callback_t on_done)
+{
+    Cancel();
+
+    /* scene file is read on its own serializer, so the one bound to the current scene is untouched */
+    parsing_ = std::async(std::launch::async, [directory, scene_name] {
+        SceneSerializer serializer(directory);
+        return serializer.LoadScene(scene_name, SerializationType::kShallow);
+    });
+
+    on_done_ = std::move(on_done);
+    state_   = State::kParsing;
+    stats_   = {};
+    TrackPeakMemory_();
+
+    TRACE("Preloading scene: " << directory << "/" << scene_name);
+}
+
+void LibGcp::ScenePreloader::Cancel()
+{
+    if (parsing_.valid()) {
+        parsing_.wait();
+        parsing_ = {};
+    }
+
+    /* imports requested for the cancelled scene are dropped on arrival */
+    pending_models_.clear();
+    staged_models_.clear();
+    scene_   = {};
+    on_done_ = {};
+    state_   = State::kIdle;
+}
+
+void LibGcp::ScenePreloader::Update()
+{
+    if (state_ == State::kParsing) {
+        if (parsing_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return;
+        }
+
+        auto [rc, scene] = parsing_.get();
+        if (IsFailure(rc)) {
+            TRACE("Failed to preload scene: " << GetRcDescription(rc));
+            Finish_(rc);
+            return;
+        }
+
+        scene_ = std::move(scene);
+        RequestModels_();
+        state_ = State::kStaging;
+    }
+
+    if (state_ != State::kStaging) {
+        return;
+    }
+
+    StageModels_();
+
+    if (state_ == State::kStaging && pending_models_.empty()) {
+        Swap_();
+    }
+}
+
+void LibGcp::ScenePreloader::RequestModels_()
+{
+    /* lazily loaded models are cheap placeholders, there is nothing to stage */
+    if (SettingsMgr::GetInstance().GetSetting<Setting::kLazyModelLoading, bool>()) {
+        return;
+    }
+
+    for (const auto &resource : scene_.resources) {
+        if (resource.type == ResourceType::kModel && resource.load_type == LoadType::kExternal) {
+            pending_models_.try_emplace(resource.paths[0], resource);
+        }
+    }
+
+    /* objects refer to models by name only, missing specs are loaded as external */
+    for (const auto &object : scene_.static_objects) {
+        pending_models_.try_emplace(
+            object.name,
+            ResourceSpec{
+                .paths     = {object.name, ""},
+                .type      = ResourceType::kModel,
+                .load_type = LoadType::kExternal,
+            }
+        );
+    }
+
+    /* models shared with the current scene are kept by the reconciliation */
+    {
+        auto &models = ResourceMgr::GetInstance().GetModels();
+        const std::lock_guard lock(models.GetMutex());
+
+        std::erase_if(pending_models_, [&](const auto &entry) {
+            return models.contains(entry.first);
+        });
+    }
+
+    for (const auto &[path, spec] : pending_models_) {
+        importer_.Request(path);
+    }
+
+    stats_.total_models = pending_models_.size();
+}
+
+void LibGcp::ScenePreloader::StageModels_()
+{
+    for (auto &[path, importer, blob] : importer_.TakeImported(kMaxModelsPerFrame)) {
+        const auto it = pending_models_.find(path);
+        if (it == pending_models_.end()) {
+            /* left from the cancelled preload */
+            continue;
+        }
+
+        ResourceMgr::GetInstance().SetTextureFlip(it->second.flip_texture);
+
+        ModelSerializer serializer{};
+        std::shared_ptr<Model> model{};
+        if (importer) {
+            model = serializer.BuildModelFromImport(*importer, path);
+        } else if (!blob.empty()) {
+            model = serializer.LoadModelFromBlob(blob, path);
+        }
+
+        if (!model) {
+            TRACE("Failed to preload model: " << path);
+            Finish_(Rc::kFailedToLoad);
+            return;
+        }
+
+        staged_models_.push_back({
+            .spec  = std::move(it->second),
+            .model = std::move(model),
+        });
+        pending_models_.erase(it);
+
+        ++stats_.staged_models;
+    }
+
+    TrackPeakMemory_();
+}
+
+void LibGcp::ScenePreloader::TrackPeakMemory_()
+{
+    /* staged models are tracked from their creation, so they are already part of the totals */
+    const auto memory_stats = ResourceMgr::GetInstance().GetMemoryStats();
+
+    stats_.peak_vram_bytes = std::max(stats_.peak_vram_bytes, memory_stats.vram_bytes);
+    stats_.peak_ram_bytes  = std::max(stats_.peak_ram_bytes, memory_stats.ram_bytes);
+}
+
+void LibGcp::ScenePreloader::Swap_()
+{
+    for (auto &staged : staged_models_) {
+        ResourceMgr::GetInstance().AdoptModel(staged.spec, staged.model);
+    }
+    staged_models_.clear();
+
+    /* staged models are already registered, so only objects and lights are created here */
+    Engine::GetInstance().ReloadScene(scene_);
+
+    TRACE(
+        "Swapped in preloaded scene with " << stats_.staged_models << " staged models, peak VRAM: "
+                                           << stats_.peak_vram_bytes << " B, peak RAM: " << stats_.peak_ram_bytes
+                                           << " B"
+    );
+    Finish_(Rc::kSuccess);
+}
+
+void LibGcp::ScenePreloader::Finish_(const Rc rc)
+{
+    /* callback may start another preload */
+    callback_t on_done = std::move(on_done_);
+
+    pending_models_.clear();
+    staged_models_.clear();
+    scene_   = {};
+    on_done_ = {};
+    state_   = State::kIdle;
+
+    if (on_done) {
+        on_done(rc);
+    }
+}
@@ -0,0 +1,126 @@
+#ifndef ENGINE_SCENE_PRELOADER_HPP_
+#define ENGINE_SCENE_PRELOADER_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/intf.hpp>
+#include <libcgp/primitives/model.hpp>
+#include <libcgp/rc.hpp>
+#include <libcgp/utils/model_importer.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+LIBGCP_DECL_START_
+/**
+ * Prepares the next scene while the current one keeps rendering. Scene file is read and its models are
+ * imported on worker threads, GPU resources of the models are created on the render thread one model per frame
+ * and kept aside until all of them are ready. Scene is then swapped in at the frame boundary.
+ */
+class ScenePreloader
+{
+    // ------------------------------
+    // Class internals
+    // ------------------------------
+
+    static constexpr size_t kMaxModelsPerFrame = 1;
+
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    using callback_t = std::function<void(Rc rc)>;
+
+    /* memory is tracked from the preload start until the swap */
+    struct Stats {
+        size_t staged_models;
+        size_t total_models;
+        size_t peak_vram_bytes;
+        size_t peak_ram_bytes;
+    };
+
+    protected:
+    enum class State : std::uint8_t {
+        kIdle,
+        kParsing,
+        kStaging,
+    };
+
+    struct StagedModel {
+        ResourceSpec spec;
+        std::shared_ptr<Model> model;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    public:
+    ScenePreloader() = default;
+
+    ~ScenePreloader();
+
+    ScenePreloader(const ScenePreloader &) = delete;
+
+    ScenePreloader &operator=(const ScenePreloader &) = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    void Start();
+
+    void Stop();
+
+    /* Cancels the preload in progress, callback is invoked once the scene is swapped in or failed to load */
+    void Preload(const std::string &directory, const std::string &scene_name, callback_t on_done);
+
+    void Cancel();
+
+    /* Must be called at the frame boundary from the thread owning GL context */
+    void Update();
+
+    NDSCRD FAST_CALL bool IsLoading() const noexcept { return state_ != State::kIdle; }
+
+    NDSCRD FAST_CALL const Stats &GetStats() const noexcept { return stats_; }
+
+    // ---------------------------------
+    // Class implementation methods
+    // ---------------------------------
+
+    protected:
+    void RequestModels_();
+
+    void StageModels_();
+
+    void TrackPeakMemory_();
+
+    void Swap_();
+
+    void Finish_(Rc rc);
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    State state_{};
+    std::future<std::tuple<Rc, Scene>> parsing_{};
+    Scene scene_{};
+    callback_t on_done_{};
+
+    std::unordered_map<std::string, ResourceSpec> pending_models_{};
+    std::vector<StagedModel> staged_models_{};
+    Stats stats_{};
+
+    ModelImporter importer_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // ENGINE_SCENE_PRELOADER_HPP_
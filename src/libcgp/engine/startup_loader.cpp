@@ -0,0 +1,207 @@
+#include <libcgp/engine/startup_loader.hpp>
+#include <libcgp/engine/startup_timeline.hpp>
+#include <libcgp/mgr/resource_mgr.hpp>
+#include <libcgp/mgr/settings_mgr.hpp>
+#include <libcgp/serialization/scene_serializer.hpp>
+#include <libcgp/utils/files.hpp>
+#include <libcgp/utils/macros.hpp>
+#include <libcgp/utils/profiler.hpp>
+
+#include <algorithm>
+#include <unordered_set>
+#include <utility>
+
+#include <assimp/Importer.hpp>
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::StartupLoader::StartupLoader(std::string scene_path) : scene_path_(std::move(scene_path)) {}
+
+LibGcp::StartupLoader::StartupLoader(Scene scene) : scene_(std::move(scene)) {}
+
+LibGcp::StartupLoader::~StartupLoader()
+{
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void LibGcp::StartupLoader::Start()
+{
+    R_ASSERT(!thread_.joinable());
+
+    thread_ = std::thread([this] {
+        Run_();
+    });
+}
+
+LibGcp::Rc LibGcp::StartupLoader::Finish(Scene &scene)
+{
+    PROFILE_SCOPE("StartupLoader::Finish");
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    if (IsFailure(rc_)) {
+        return rc_;
+    }
+
+    {
+        const StartupTimeline::Scope phase(StartupTimeline::Phase::kResourceUpload);
+
+        for (auto &prepared : models_) {
+            ResourceMgr::GetInstance().SetTextureFlip(prepared.spec.flip_texture);
+
+            ModelSerializer serializer{};
+            std::shared_ptr<Model> model{};
+            if (!prepared.blob.empty()) {
+                model = serializer.LoadModelFromBlob(prepared.blob, prepared.spec.paths[0]);
+            }
+
+            if (!model && prepared.importer) {
+                model = serializer.BuildModelFromImport(*prepared.importer, prepared.spec.paths[0]);
+            }
+
+            /* failures are reported again by the regular load of the scene */
+            if (model) {
+                ResourceMgr::GetInstance().AdoptModel(prepared.spec, model);
+            }
+
+            prepared.importer.reset();
+        }
+    }
+
+    TRACE("Prepared " << models_.size() << " models and " << textures_.size() << " textures during startup");
+
+    models_.clear();
+    textures_.clear();
+    scene = std::move(scene_);
+
+    return Rc::kSuccess;
+}
+
+void LibGcp::StartupLoader::Run_()
+{
+    Profiler::SetThreadName("Startup loader");
+
+    if (!scene_path_.empty()) {
+        const StartupTimeline::Scope phase(StartupTimeline::Phase::kSceneParse);
+
+        SceneSerializer serializer(GetDirFromFile(scene_path_));
+        auto [rc, scene] = serializer.LoadScene(GetFileName(scene_path_), SerializationType::kShallow);
+
+        if (IsFailure(rc)) {
+            TRACE("Failed to load scene: " << scene_path_ << " caused by: " << GetRcDescription(rc));
+            rc_ = rc;
+            return;
+        }
+
+        scene_ = std::move(scene);
+    }
+
+    CollectTextures_();
+    CollectModels_();
+
+    /* this thread is one of the workers, so none is started for an empty scene */
+    const size_t item_count   = textures_.size() + models_.size();
+    const size_t worker_count = std::min({size_t{std::thread::hardware_concurrency()}, kMaxWorkers, item_count});
+
+    std::vector<std::thread> helpers{};
+    for (size_t idx = 1; idx < worker_count; ++idx) {
+        helpers.emplace_back([this] {
+            Profiler::SetThreadName("Startup loader");
+            Work_();
+        });
+    }
+
+    Work_();
+
+    for (auto &helper : helpers) {
+        helper.join();
+    }
+}
+
+void LibGcp::StartupLoader::CollectModels_()
+{
+    /* lazily loaded models are cheap placeholders, there is nothing to prepare */
+    if (SettingsMgr::GetInstance().GetSetting<Setting::kLazyModelLoading, bool>()) {
+        return;
+    }
+
+    std::unordered_set<std::string> names{};
+    const auto add_model = [&](const ResourceSpec &spec) {
+        if (names.insert(spec.paths[0]).second) {
+            models_.push_back({.spec = spec, .importer = {}, .blob = {}});
+        }
+    };
+
+    for (const auto &resource : scene_.resources) {
+        if (resource.type == ResourceType::kModel && resource.load_type == LoadType::kExternal) {
+            add_model(resource);
+        }
+    }
+
+    /* objects refer to models by name only, missing specs are loaded as external */
+    for (const auto &object : scene_.static_objects) {
+        add_model({
+            .paths     = {object.name, ""},
+            .type      = ResourceType::kModel,
+            .load_type = LoadType::kExternal,
+        });
+    }
+}
+
+void LibGcp::StartupLoader::CollectTextures_()
+{
+    for (const auto &resource : scene_.resources) {
+        if (resource.type == ResourceType::kTexture && resource.load_type == LoadType::kExternal) {
+            textures_.push_back({.path = resource.paths[0], .flip_texture = resource.flip_texture});
+        }
+    }
+}
+
+void LibGcp::StartupLoader::Work_()
+{
+    while (true) {
+        const size_t idx = next_item_.fetch_add(1);
+
+        if (idx < textures_.size()) {
+            const StartupTimeline::Scope phase(StartupTimeline::Phase::kImageDecode);
+            ResourceMgr::GetInstance().PredecodeTexture(textures_[idx].path, textures_[idx].flip_texture);
+        } else if (idx < textures_.size() + models_.size()) {
+            ImportModel_(models_[idx - textures_.size()]);
+        } else {
+            return;
+        }
+    }
+}
+
+void LibGcp::StartupLoader::ImportModel_(PreparedModel &prepared)
+{
+    const std::string &path = prepared.spec.paths[0];
+
+    {
+        const StartupTimeline::Scope phase(StartupTimeline::Phase::kModelImport);
+
+        /* another process might have imported the model already, its textures are then loaded as they are */
+        prepared.blob = ModelSerializer::FindSharedBlob(path);
+        if (!prepared.blob.empty()) {
+            return;
+        }
+
+        prepared.importer = ModelSerializer::ImportExternalFormat(path);
+        if (!prepared.importer) {
+            TRACE("Failed to import model during startup: " << path);
+            return;
+        }
+    }
+
+    /* material textures shared by several models are decoded once */
+    for (const auto &texture_path : ModelSerializer::GetExternalTexturePaths(*prepared.importer, path)) {
+        const StartupTimeline::Scope phase(StartupTimeline::Phase::kImageDecode);
+        ResourceMgr::GetInstance().PredecodeTexture(texture_path, prepared.spec.flip_texture);
+    }
+}
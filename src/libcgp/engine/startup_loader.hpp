@@ -0,0 +1,113 @@
+#ifndef ENGINE_STARTUP_LOADER_HPP_
+#define ENGINE_STARTUP_LOADER_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/intf.hpp>
+#include <libcgp/primitives/model.hpp>
+#include <libcgp/rc.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Forward declarations */
+namespace Assimp
+{
+class Importer;
+}  // namespace Assimp
+
+LIBGCP_DECL_START_
+/**
+ * Loads the first scene while the window and GL context are created. Scene file is parsed, models are imported
+ * with assimp and textures are decoded on worker threads, none of them touches GL. Once the context exists the
+ * prepared models are uploaded on the render thread, so only the GPU work is left between the context creation
+ * and the first frame. Requires settings and resource managers to be initialized before Start.
+ */
+class StartupLoader
+{
+    // ------------------------------
+    // Class internals
+    // ------------------------------
+
+    static constexpr size_t kMaxWorkers = 4;
+
+    protected:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    struct PreparedModel {
+        ResourceSpec spec;
+        std::unique_ptr<Assimp::Importer> importer;
+        ModelSerializer::blob_t blob;
+    };
+
+    struct PreparedTexture {
+        std::string path;
+        int8_t flip_texture;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    public:
+    explicit StartupLoader(std::string scene_path);
+
+    /* Scene is already parsed, only its assets are prepared */
+    explicit StartupLoader(Scene scene);
+
+    ~StartupLoader();
+
+    StartupLoader(const StartupLoader &) = delete;
+
+    StartupLoader &operator=(const StartupLoader &) = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    void Start();
+
+    /* Waits for the workers and uploads the prepared models, must be called from the thread owning GL context */
+    NDSCRD Rc Finish(Scene &scene);
+
+    // ---------------------------------
+    // Class implementation methods
+    // ---------------------------------
+
+    protected:
+    void Run_();
+
+    void CollectModels_();
+
+    void CollectTextures_();
+
+    /* Takes items shared by all workers until none is left */
+    void Work_();
+
+    void ImportModel_(PreparedModel &prepared);
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    std::string scene_path_{};
+    Scene scene_{};
+    Rc rc_{Rc::kSuccess};
+
+    /* textures come first, so they are decoded while the models are imported */
+    std::vector<PreparedTexture> textures_{};
+    std::vector<PreparedModel> models_{};
+    std::atomic<size_t> next_item_{};
+
+    std::thread thread_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // ENGINE_STARTUP_LOADER_HPP_
@@ -0,0 +1,133 @@
+#include <libcgp/engine/startup_timeline.hpp>
+
+#include <libcgp/utils/macros.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static constexpr std::array kPhaseNames{
+    "glfw_init",       "context_creation", "glad_load",      "scene_parse",     "model_import",
+    "image_decode",    "resource_upload",  "shader_compile", "object_creation",
+};
+
+static_assert(kPhaseNames.size() == LibGcp::StartupTimeline::kPhaseCount);
+
+static double ToMs(const uint64_t ns) { return static_cast<double>(ns) / 1e6; }
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::StartupTimeline::Scope::Scope(const Phase phase) noexcept : phase_(phase), start_ns_(GetElapsedNs_())
+{
+    if constexpr (Profiler::kUseProfiler) {
+        zone_.emplace(GetPhaseName(phase));
+    }
+}
+
+LibGcp::StartupTimeline::Scope::~Scope() { Record_(phase_, start_ns_, GetElapsedNs_()); }
+
+void LibGcp::StartupTimeline::Begin() noexcept
+{
+    const std::lock_guard lock(mutex_);
+
+    phases_         = {};
+    first_frame_ns_ = 0;
+    begin_ns_       = Profiler::GetTimestampNs();
+}
+
+void LibGcp::StartupTimeline::MarkFirstFrame() noexcept
+{
+    const uint64_t now_ns = GetElapsedNs_();
+
+    {
+        const std::lock_guard lock(mutex_);
+        if (first_frame_ns_ != 0) {
+            return;
+        }
+
+        first_frame_ns_ = now_ns;
+    }
+
+    TRACE("Time to first frame: " << ToMs(now_ns) << " ms");
+    for (size_t idx = 0; idx < kPhaseCount; ++idx) {
+        const auto record = GetPhase(static_cast<Phase>(idx));
+
+        TRACE(
+            "  " << kPhaseNames[idx] << ": " << ToMs(record.start_ns) << " - " << ToMs(record.end_ns)
+                 << " ms, busy: " << ToMs(record.busy_ns) << " ms in " << record.count << " runs"
+        );
+    }
+}
+
+LibGcp::StartupTimeline::PhaseRecord LibGcp::StartupTimeline::GetPhase(const Phase phase) noexcept
+{
+    const std::lock_guard lock(mutex_);
+    return phases_[static_cast<size_t>(phase)];
+}
+
+uint64_t LibGcp::StartupTimeline::GetTimeToFirstFrameNs() noexcept
+{
+    const std::lock_guard lock(mutex_);
+    return first_frame_ns_;
+}
+
+const char *LibGcp::StartupTimeline::GetPhaseName(const Phase phase) noexcept
+{
+    return kPhaseNames[static_cast<size_t>(phase)];
+}
+
+void LibGcp::StartupTimeline::WriteJson(std::ostream &out)
+{
+    out << R"({"time_to_first_frame_ms": )" << ToMs(GetTimeToFirstFrameNs()) << R"(, "phases": {)";
+
+    for (size_t idx = 0; idx < kPhaseCount; ++idx) {
+        const auto record = GetPhase(static_cast<Phase>(idx));
+
+        out << (idx == 0 ? "" : ", ") << '"' << kPhaseNames[idx] << R"(": {"start_ms": )" << ToMs(record.start_ns)
+            << R"(, "end_ms": )" << ToMs(record.end_ns) << R"(, "busy_ms": )" << ToMs(record.busy_ns)
+            << R"(, "count": )" << record.count << '}';
+    }
+
+    out << "}}";
+}
+
+LibGcp::Rc LibGcp::StartupTimeline::DumpJson(const std::string &path)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        return Rc::kFailedToOpenFile;
+    }
+
+    WriteJson(file);
+    file << '\n';
+
+    return file.good() ? Rc::kSuccess : Rc::kUnknownFailure;
+}
+
+uint64_t LibGcp::StartupTimeline::GetElapsedNs_() noexcept
+{
+    /* begin is written once before any other thread starts, so it is read without the lock */
+    return Profiler::GetTimestampNs() - begin_ns_;
+}
+
+void LibGcp::StartupTimeline::Record_(const Phase phase, const uint64_t start_ns, const uint64_t end_ns) noexcept
+{
+    const std::lock_guard lock(mutex_);
+
+    /* scenes reloaded later are not part of the startup */
+    if (first_frame_ns_ != 0) {
+        return;
+    }
+
+    auto &record = phases_[static_cast<size_t>(phase)];
+
+    record.start_ns = record.count == 0 ? start_ns : std::min(record.start_ns, start_ns);
+    record.end_ns   = std::max(record.end_ns, end_ns);
+    record.busy_ns += end_ns - start_ns;
+    ++record.count;
+}
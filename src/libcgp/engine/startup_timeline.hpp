@@ -0,0 +1,123 @@
+#ifndef ENGINE_STARTUP_TIMELINE_HPP_
+#define ENGINE_STARTUP_TIMELINE_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/rc.hpp>
+#include <libcgp/utils/profiler.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+
+LIBGCP_DECL_START_
+/**
+ * Wall clock spans of the engine startup phases, measured from Begin until the first frame is presented.
+ * Phases running on several threads at once, e.g. model import, are reported as the span from the first start to
+ * the last end together with the time summed over all threads, so the overlap with the render thread is visible.
+ * Every phase is also recorded as a profiler zone, so it shows up in the exported Chrome trace. Phases finished
+ * after the first frame, e.g. of scenes reloaded later, are not recorded.
+ */
+class StartupTimeline
+{
+    // ------------------------------
+    // Class internals
+    // ------------------------------
+
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    enum class Phase : uint8_t {
+        kGlfwInit,
+        kContextCreation,
+        kGladLoad,
+        kSceneParse,
+        kModelImport,
+        kImageDecode,
+        kResourceUpload,
+        kShaderCompile,
+        kObjectCreation,
+        kLast,
+    };
+
+    static constexpr size_t kPhaseCount = static_cast<size_t>(Phase::kLast);
+
+    /* Nanoseconds since Begin, all zero for the phase which did not run */
+    struct PhaseRecord {
+        uint64_t start_ns;
+        uint64_t end_ns;
+        uint64_t busy_ns;
+        size_t count;
+    };
+
+    class Scope
+    {
+        public:
+        explicit Scope(Phase phase) noexcept;
+
+        ~Scope();
+
+        Scope(const Scope &)            = delete;
+        Scope &operator=(const Scope &) = delete;
+
+        private:
+        Phase phase_;
+        uint64_t start_ns_;
+        std::optional<Profiler::Zone> zone_{};
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    StartupTimeline() = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    /* Restarts the timeline, phases recorded before are dropped */
+    static void Begin() noexcept;
+
+    /* Only the first call after Begin is taken into account */
+    static void MarkFirstFrame() noexcept;
+
+    NDSCRD static PhaseRecord GetPhase(Phase phase) noexcept;
+
+    /* Zero until the first frame is presented */
+    NDSCRD static uint64_t GetTimeToFirstFrameNs() noexcept;
+
+    NDSCRD static const char *GetPhaseName(Phase phase) noexcept;
+
+    /* JSON object with the phases in milliseconds and the time to first frame */
+    static void WriteJson(std::ostream &out);
+
+    NDSCRD static Rc DumpJson(const std::string &path);
+
+    // ---------------------------------
+    // Class implementation methods
+    // ---------------------------------
+
+    protected:
+    NDSCRD static uint64_t GetElapsedNs_() noexcept;
+
+    static void Record_(Phase phase, uint64_t start_ns, uint64_t end_ns) noexcept;
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    static inline std::mutex mutex_{};
+    static inline std::array<PhaseRecord, kPhaseCount> phases_{};
+    static inline uint64_t begin_ns_{};
+    static inline uint64_t first_frame_ns_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // ENGINE_STARTUP_TIMELINE_HPP_
@@ -0,0 +1,338 @@
+#include <libcgp/engine/texture_streamer.hpp>
+
+#include <libcgp/mgr/object_mgr.hpp>
+#include <libcgp/mgr/settings_mgr.hpp>
+#include <libcgp/utils/macros.hpp>
+#include <libcgp/utils/mip_file.hpp>
+#include <libcgp/utils/profiler.hpp>
+#include <libcgp/window/window.hpp>
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static constexpr size_t kBytesInKb = 1024;
+
+/* Diameter in pixels of the sphere projected on the screen */
+static float GetScreenDiameter(const float radius, const float distance)
+{
+    using LibGcp::Setting;
+    auto &settings    = LibGcp::SettingsMgr::GetInstance();
+    const auto height = static_cast<float>(std::get<1>(LibGcp::Window::GetInstance().GetWindowSize()));
+
+    if (settings.GetSetting<Setting::kProjectionType, LibGcp::ProjectionType>() ==
+        LibGcp::ProjectionType::kOrthographic) {
+        return 2.0f * radius * height / settings.GetSetting<Setting::kOrthoHeight, float>();
+    }
+
+    const float fov          = settings.GetSetting<Setting::kFov, float>();
+    const float near_plane   = settings.GetSetting<Setting::kNear, float>();
+    const float focal_pixels = height / (2.0f * std::tan(glm::radians(fov) / 2.0f));
+
+    /* camera inside the bounds sees the closest possible surface */
+    return 2.0f * radius * focal_pixels / std::max(distance - radius, near_plane);
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::TextureStreamer::~TextureStreamer() { Stop(); }
+
+void LibGcp::TextureStreamer::Start()
+{
+    if (is_running_) {
+        return;
+    }
+
+    is_running_ = true;
+    thread_     = std::thread([this] {
+        Run_();
+    });
+}
+
+void LibGcp::TextureStreamer::Stop()
+{
+    {
+        const std::lock_guard lock(mutex_);
+        is_running_ = false;
+    }
+    cv_.notify_all();
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void LibGcp::TextureStreamer::Update(const View &view)
+{
+    PROFILE_SCOPE("TextureStreamer::Update");
+    ++frame_;
+
+    if (!SettingsMgr::GetInstance().GetSetting<Setting::kTextureStreaming, bool>()) {
+        return;
+    }
+
+    if (frame_ % kFootprintInterval == 0) {
+        ComputeFootprints_(view);
+        ScheduleLevels_();
+        UpdateStats_();
+    }
+
+    UploadLoadedLevels_();
+}
+
+void LibGcp::TextureStreamer::ComputeFootprints_(const View &view)
+{
+    const CameraInfo &camera = view.GetBindObject();
+
+    std::unordered_map<TextureStorage *, int> desired_levels{};
+    {
+        auto &objects = ObjectMgr::GetInstance().GetStaticObjects();
+        const std::lock_guard lock(objects.GetMutex());
+
+        for (const auto &object : objects) {
+            const auto model = object.GetModel();
+            if (!model) {
+                continue;
+            }
+
+            const ObjectPosition &position = object.GetPosition();
+            const BoundingBox &bounds      = model->GetBoundingBox();
+
+            const glm::vec3 center = View::PrepareModelMatrices(position) * glm::vec4(bounds.GetCenter(), 1.0f);
+            const glm::vec3 scale  = glm::abs(position.scale);
+            const float radius     = bounds.GetRadius() * std::max({scale.x, scale.y, scale.z});
+
+            const glm::vec3 to_center = center - camera.position;
+            if (glm::dot(to_center, camera.front) < -radius) {
+                /* whole object behind the camera */
+                continue;
+            }
+
+            const float screen_diameter = GetScreenDiameter(radius, glm::length(to_center));
+
+            for (size_t idx = 0; idx < model->GetMeshesCount(); ++idx) {
+                for (const auto &texture : model->GetMesh(idx)->GetTextures()) {
+                    const auto &storage = texture->GetStorage();
+                    if (!storage->IsStreamed()) {
+                        continue;
+                    }
+
+                    /* assumes texture covers the object once, one texel per pixel is enough */
+                    const float texels = static_cast<float>(std::max(storage->GetWidth(), storage->GetHeight()));
+                    const float ratio  = texels / std::max(screen_diameter, 1.0f);
+                    const int level    = std::clamp(
+                        static_cast<int>(std::floor(std::log2(std::max(ratio, 1.0f)))), 0, storage->GetTailLevel()
+                    );
+
+                    auto &tracked = tracked_[storage.get()];
+                    if (tracked.storage.expired()) {
+                        /* new storage or a new one allocated at the address of a released one */
+                        tracked = {
+                            .storage         = storage,
+                            .desired_level   = storage->GetTailLevel(),
+                            .last_seen_frame = frame_,
+                            .is_failed       = false,
+                        };
+                    }
+
+                    const auto [it, inserted] = desired_levels.emplace(storage.get(), level);
+                    if (!inserted) {
+                        it->second = std::min(it->second, level);
+                    }
+                }
+            }
+        }
+    }
+
+    for (auto it = tracked_.begin(); it != tracked_.end();) {
+        const auto storage = it->second.storage.lock();
+
+        if (!storage) {
+            it = tracked_.erase(it);
+            continue;
+        }
+
+        if (const auto desired_it = desired_levels.find(it->first); desired_it != desired_levels.end()) {
+            it->second.desired_level   = desired_it->second;
+            it->second.last_seen_frame = frame_;
+        } else if (frame_ - it->second.last_seen_frame >= kUnseenFramesToDrop) {
+            it->second.desired_level = storage->GetTailLevel();
+        }
+
+        ++it;
+    }
+}
+
+void LibGcp::TextureStreamer::ScheduleLevels_()
+{
+    std::vector<LevelRequest> requests{};
+
+    for (auto &[key, tracked] : tracked_) {
+        const auto storage = tracked.storage.lock();
+
+        if (!storage || tracked.is_failed || in_flight_.contains(key)) {
+            continue;
+        }
+
+        const int resident = storage->GetResidentLevel();
+
+        if (tracked.desired_level < resident) {
+            /* one level at a time, every step makes the texture sharper */
+            in_flight_.insert(key);
+            requests.push_back({
+                .key      = key,
+                .storage  = tracked.storage,
+                .mip_path = storage->GetMipPath(),
+                .level    = resident - 1,
+            });
+        } else if (tracked.desired_level > storage->GetAllocatedLevel() + 1) {
+            /* one level of hysteresis avoids reallocations on small camera moves */
+            storage->ResizeToLevel(tracked.desired_level);
+        }
+    }
+
+    if (!requests.empty()) {
+        {
+            const std::lock_guard lock(mutex_);
+            std::ranges::move(requests, std::back_inserter(requests_));
+        }
+        cv_.notify_one();
+    }
+}
+
+void LibGcp::TextureStreamer::UploadLoadedLevels_()
+{
+    {
+        const std::lock_guard lock(mutex_);
+        std::ranges::move(loaded_, std::back_inserter(uploading_));
+        loaded_.clear();
+    }
+
+    if (uploading_.empty()) {
+        return;
+    }
+
+    /* 0 disables the limit */
+    const uint64_t budget_kb = SettingsMgr::GetInstance().GetSetting<Setting::kTextureUploadBudgetKb, uint64_t>();
+    size_t budget = budget_kb == 0 ? std::numeric_limits<size_t>::max() : budget_kb * kBytesInKb;
+
+    while (!uploading_.empty() && budget > 0) {
+        LoadedLevel &loaded = uploading_.front();
+        const auto storage  = loaded.storage.lock();
+
+        /* storage released in the meantime or level could not be read */
+        if (!storage || loaded.data.empty() || storage->GetResidentLevel() != loaded.level + 1) {
+            if (loaded.data.empty() && tracked_.contains(loaded.key)) {
+                tracked_.at(loaded.key).is_failed = true;
+            }
+
+            in_flight_.erase(loaded.key);
+            uploading_.pop_front();
+            continue;
+        }
+
+        if (storage->GetAllocatedLevel() > loaded.level) {
+            storage->ResizeToLevel(loaded.level);
+        }
+
+        const int level_height = GetMipDimension(storage->GetHeight(), loaded.level);
+        const size_t row_bytes =
+            static_cast<size_t>(GetMipDimension(storage->GetWidth(), loaded.level)) * storage->GetChannels();
+
+        /* large levels are split into row bands uploaded over several frames */
+        const size_t rows_in_budget = std::max<size_t>(1, budget / row_bytes);
+        const int row_end = static_cast<int>(std::min<size_t>(level_height, loaded.rows_uploaded + rows_in_budget));
+
+        storage->UploadLevelRows(loaded.level, loaded.rows_uploaded, row_end, loaded.data.data());
+
+        const size_t uploaded = static_cast<size_t>(row_end - loaded.rows_uploaded) * row_bytes;
+        budget -= std::min(budget, uploaded);
+        stats_.uploaded_bytes += uploaded;
+        loaded.rows_uploaded = row_end;
+
+        if (loaded.rows_uploaded == level_height) {
+            storage->CommitLevel(loaded.level);
+            in_flight_.erase(loaded.key);
+            uploading_.pop_front();
+        }
+    }
+}
+
+void LibGcp::TextureStreamer::UpdateStats_()
+{
+    stats_.streamed_textures = 0;
+    stats_.resident_bytes    = 0;
+    stats_.full_bytes        = 0;
+    stats_.pending_levels    = in_flight_.size();
+
+    for (const auto &[key, tracked] : tracked_) {
+        const auto storage = tracked.storage.lock();
+        if (!storage) {
+            continue;
+        }
+
+        ++stats_.streamed_textures;
+        stats_.resident_bytes += storage->GetSizeBytes();
+
+        for (int level = 0; level < storage->GetMipCount(); ++level) {
+            stats_.full_bytes +=
+                GetMipSizeBytes(storage->GetWidth(), storage->GetHeight(), storage->GetChannels(), level);
+        }
+    }
+}
+
+void LibGcp::TextureStreamer::Run_()
+{
+    Profiler::SetThreadName("Texture streamer");
+
+    while (true) {
+        LevelRequest request{};
+        {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [this] {
+                return !is_running_ || !requests_.empty();
+            });
+
+            if (!is_running_) {
+                return;
+            }
+
+            request = std::move(requests_.front());
+            requests_.pop_front();
+        }
+
+        PROFILE_SCOPE("TextureStreamer::ReadMipLevel");
+        LoadedLevel loaded{
+            .key           = request.key,
+            .storage       = std::move(request.storage),
+            .level         = request.level,
+            .rows_uploaded = 0,
+            .data          = {},
+            .allocation    = {},
+        };
+
+        if (!ReadMipLevel(request.mip_path, request.level, loaded.data)) {
+            TRACE("Failed to read mip level " << request.level << " from: " << request.mip_path);
+            loaded.data.clear();
+        }
+
+        loaded.allocation =
+            MemoryTracker::Allocation(MemoryTracker::Category::kStreaming, loaded.data.size(), request.mip_path);
+
+        const std::lock_guard lock(mutex_);
+        loaded_.push_back(std::move(loaded));
+    }
+}
@@ -0,0 +1,138 @@
+#ifndef ENGINE_TEXTURE_STREAMER_HPP_
+#define ENGINE_TEXTURE_STREAMER_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/engine/view.hpp>
+#include <libcgp/primitives/texture.hpp>
+#include <libcgp/utils/memory_tracker.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+LIBGCP_DECL_START_
+/**
+ * Keeps resident only those mip levels of streamed textures which are visible on the screen.
+ * Desired level is estimated from the projected size of the object bounds, finer levels are read from
+ * mip files on the worker thread and uploaded on the render thread within per-frame byte budget.
+ * Textures not seen for a while fall back to the resident tail.
+ */
+class TextureStreamer
+{
+    // ------------------------------
+    // Class internals
+    // ------------------------------
+
+    static constexpr uint64_t kFootprintInterval = 8;
+    static constexpr uint64_t kUnseenFramesToDrop = 600;
+
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    struct Stats {
+        size_t streamed_textures;
+        size_t resident_bytes;
+        size_t full_bytes;
+        size_t pending_levels;
+        size_t uploaded_bytes;
+    };
+
+    protected:
+    struct TrackedStorage {
+        std::weak_ptr<TextureStorage> storage;
+        int desired_level;
+        uint64_t last_seen_frame;
+        bool is_failed;
+    };
+
+    struct LevelRequest {
+        TextureStorage *key;
+        std::weak_ptr<TextureStorage> storage;
+        std::string mip_path;
+        int level;
+    };
+
+    struct LoadedLevel {
+        TextureStorage *key;
+        std::weak_ptr<TextureStorage> storage;
+        int level;
+        int rows_uploaded;
+        std::vector<unsigned char> data;
+        MemoryTracker::Allocation allocation;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    public:
+    TextureStreamer() = default;
+
+    ~TextureStreamer();
+
+    TextureStreamer(const TextureStreamer &) = delete;
+
+    TextureStreamer &operator=(const TextureStreamer &) = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    void Start();
+
+    void Stop();
+
+    /* Must be called once per frame from the thread owning GL context */
+    void Update(const View &view);
+
+    NDSCRD FAST_CALL const Stats &GetStats() const noexcept { return stats_; }
+
+    // ---------------------------------
+    // Class implementation methods
+    // ---------------------------------
+
+    protected:
+    void ComputeFootprints_(const View &view);
+
+    void ScheduleLevels_();
+
+    void UploadLoadedLevels_();
+
+    void UpdateStats_();
+
+    void Run_();
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    /* render thread state */
+    std::unordered_map<TextureStorage *, TrackedStorage> tracked_{};
+    std::unordered_set<TextureStorage *> in_flight_{};
+    std::deque<LoadedLevel> uploading_{};
+    uint64_t frame_{};
+    Stats stats_{};
+
+    /* shared with the worker */
+    std::mutex mutex_{};
+    std::condition_variable cv_{};
+    std::deque<LevelRequest> requests_{};
+    std::deque<LoadedLevel> loaded_{};
+
+    std::atomic<bool> is_running_{};
+    std::thread thread_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // ENGINE_TEXTURE_STREAMER_HPP_
@@ -7,6 +7,8 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <libcgp/mgr/settings_mgr.hpp>
 
+#include <algorithm>
+
 void LibGcp::CameraInfo::MoveFreeCamera(const float distance, const buttons_t &buttons)
 {
     if (buttons[GLFW_KEY_W]) {
@@ -50,7 +52,11 @@ void LibGcp::View::PrepareViewMatrices(Shader &shader)
 
 void LibGcp::View::PrepareModelMatrices(Shader &shader, const ObjectPosition &position)
 {
-    const auto model_matrix = PrepareModelMatrices(position);
+    PrepareModelMatrices(shader, PrepareModelMatrices(position));
+}
+
+void LibGcp::View::PrepareModelMatrices(Shader &shader, const glm::mat4 &model_matrix)
+{
     shader.SetMat4("un_model", model_matrix);
 }
 
@@ -82,6 +88,8 @@ void LibGcp::View::UpdateCameraPosition()
     const auto center = pos + camera_object_info_->front;
     const auto up     = camera_object_info_->up;
     view_matrix_      = glm::lookAt(pos, center, up);
+
+    UpdateFrustum_();
 }
 
 void LibGcp::View::SyncProjectionMatrixWithSettings()
@@ -117,4 +125,35 @@ void LibGcp::View::SyncProjectionMatrixWithSettings()
 
         SettingsMgr::GetInstance().SetSetting<Setting::kProjectionType>(static_cast<ProjectionType>(clamped));
     }
+
+    UpdateFrustum_();
+}
+
+bool LibGcp::View::IsVisible(
+    const BoundingBox &bounds, const glm::mat4 &model_matrix, const glm::vec3 &scale
+) const noexcept
+{
+    /* bounding sphere is cheap to transform and never rejects visible objects */
+    const glm::vec3 center    = model_matrix * glm::vec4(bounds.GetCenter(), 1.0f);
+    const glm::vec3 abs_scale = glm::abs(scale);
+    const float radius        = bounds.GetRadius() * std::max({abs_scale.x, abs_scale.y, abs_scale.z});
+
+    return std::ranges::all_of(frustum_planes_, [&](const glm::vec4 &plane) {
+        return glm::dot(glm::vec3(plane), center) + plane.w >= -radius;
+    });
+}
+
+void LibGcp::View::UpdateFrustum_() noexcept
+{
+    /* planes are extracted from the rows of the combined matrix, glm matrices are column major */
+    const glm::mat4 matrix = glm::transpose(projection_matrix_ * view_matrix_);
+
+    frustum_planes_ = {
+        matrix[3] + matrix[0], matrix[3] - matrix[0], matrix[3] + matrix[1],
+        matrix[3] - matrix[1], matrix[3] + matrix[2], matrix[3] - matrix[2],
+    };
+
+    for (auto &plane : frustum_planes_) {
+        plane /= glm::length(glm::vec3(plane));
+    }
 }
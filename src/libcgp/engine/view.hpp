@@ -16,6 +16,8 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <array>
+
 LIBGCP_DECL_START_
 class View
 {
@@ -40,6 +42,8 @@ class View
 
     static void PrepareModelMatrices(Shader &shader, const ObjectPosition &position);
 
+    static void PrepareModelMatrices(Shader &shader, const glm::mat4 &model_matrix);
+
     NDSCRD static glm::mat4 PrepareModelMatrices(const ObjectPosition &position);
 
     NDSCRD static glm::mat4 PrepareRotMatrix(const ObjectPosition &position);
@@ -52,11 +56,18 @@ class View
 
     void SyncProjectionMatrixWithSettings();
 
+    /* Conservative test of the model space bounds transformed by the model matrix against the view frustum */
+    NDSCRD bool IsVisible(
+        const BoundingBox &bounds, const glm::mat4 &model_matrix, const glm::vec3 &scale
+    ) const noexcept;
+
     // ---------------------------------
     // Class implementation methods
     // ---------------------------------
 
     protected:
+    void UpdateFrustum_() noexcept;
+
     // ------------------------------
     // Class fields
     // ------------------------------
@@ -65,6 +76,9 @@ class View
 
     glm::mat4 view_matrix_{};
     glm::mat4 projection_matrix_{};
+
+    /* planes of the frustum in world space, normals point inside */
+    std::array<glm::vec4, 6> frustum_planes_{};
 };
 
 LIBGCP_DECL_END_
@@ -38,6 +38,11 @@ class WordTime
 
     NDSCRD static uint64_t GetDayTimeSeconds(uint64_t time);
 
+    /* Ticks not yet converted into seconds, part of the state restored by the input replay */
+    NDSCRD FAST_CALL uint64_t GetTickRemainder() const noexcept { return tick_remainder_; }
+
+    FAST_CALL void SetTickRemainder(const uint64_t tick_remainder) noexcept { tick_remainder_ = tick_remainder; }
+
     NDSCRD FAST_CALL static constexpr uint64_t ConvertToSeconds(
         const uint64_t hours, const uint64_t minutes, const uint64_t seconds
     ) noexcept
@@ -0,0 +1,472 @@
+#include <libcgp/engine/world_streamer.hpp>
+
+#include <libcgp/engine/light_mgr.hpp>
+#include <libcgp/mgr/object_mgr.hpp>
+#include <libcgp/mgr/resource_mgr.hpp>
+#include <libcgp/mgr/settings_mgr.hpp>
+#include <libcgp/primitives/model.hpp>
+#include <libcgp/serialization/scene_serializer.hpp>
+#include <libcgp/utils/macros.hpp>
+#include <libcgp/utils/profiler.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <assimp/Importer.hpp>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static constexpr size_t kWarmUpBlockSize = 1024 * 1024;
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::WorldStreamer::WorldStreamer() = default;
+
+LibGcp::WorldStreamer::~WorldStreamer() { Stop(); }
+
+void LibGcp::WorldStreamer::Start()
+{
+    if (is_running_) {
+        return;
+    }
+
+    is_running_ = true;
+    thread_     = std::thread([this] {
+        Run_();
+    });
+}
+
+void LibGcp::WorldStreamer::Stop()
+{
+    {
+        const std::lock_guard lock(mutex_);
+        is_running_ = false;
+    }
+    cv_.notify_all();
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+LibGcp::Rc LibGcp::WorldStreamer::Open(const std::string &path)
+{
+    Close();
+
+    if (path.empty()) {
+        return Rc::kSuccess;
+    }
+
+    auto [rc, index] = SceneSerializer::LoadWorldCellsIndex(path);
+    if (IsFailure(rc)) {
+        TRACE("Failed to open world cells: " << path << " caused by: " << GetRcDescription(rc));
+        return rc;
+    }
+
+    for (const auto &entry : index.cells) {
+        cells_[MakeKey_(entry.x, entry.z)] = Cell{
+            .entry      = entry,
+            .state      = CellState::kUnloaded,
+            .object_ids = {},
+            .resources  = {},
+        };
+    }
+
+    {
+        const std::lock_guard lock(mutex_);
+        worker_path_ = path;
+    }
+
+    path_              = path;
+    cell_size_         = index.cell_size;
+    has_position_      = false;
+    velocity_          = {};
+    stats_.total_cells = cells_.size();
+
+    TRACE("Opened world with " << cells_.size() << " cells of size " << cell_size_);
+    return Rc::kSuccess;
+}
+
+void LibGcp::WorldStreamer::Close()
+{
+    {
+        const std::lock_guard lock(mutex_);
+
+        /* results of the requests already taken by the worker are dropped on arrival */
+        ++generation_;
+        requests_.clear();
+        loaded_.clear();
+        worker_path_.clear();
+    }
+
+    const bool has_loaded_cells = !loaded_keys_.empty();
+    if (has_loaded_cells) {
+        std::unordered_set<uint64_t> object_ids{};
+
+        for (const uint64_t key : loaded_keys_) {
+            const auto &ids = cells_.at(key).object_ids;
+            object_ids.insert(ids.begin(), ids.end());
+        }
+
+        ObjectMgr::GetInstance().RemoveStaticObjects(object_ids);
+    }
+
+    /* resources held by the cells are released together with them */
+    cells_.clear();
+    loaded_keys_.clear();
+
+    if (has_loaded_cells) {
+        ResourceMgr::GetInstance().ReleaseOrphanedResources();
+    }
+
+    path_.clear();
+    stats_ = {};
+}
+
+void LibGcp::WorldStreamer::Update(const View &view, const uint64_t delta)
+{
+    PROFILE_SCOPE("WorldStreamer::Update");
+
+    if (!IsOpen()) {
+        return;
+    }
+
+    /* smoothed camera velocity predicts where the camera will be in a moment */
+    const glm::vec3 position = view.GetBindObject().position;
+    if (has_position_ && delta > 0) {
+        const glm::vec3 frame_velocity = (position - last_position_) / (static_cast<float>(delta) / 1e+6f);
+        velocity_                      = glm::mix(velocity_, frame_velocity, kVelocitySmoothing);
+    }
+    last_position_ = position;
+    has_position_  = true;
+
+    const auto radius =
+        static_cast<int32_t>(SettingsMgr::GetInstance().GetSetting<Setting::kWorldStreamingRadius, uint64_t>());
+    const glm::ivec2 center    = GetCell_(position);
+    const glm::ivec2 predicted = GetCell_(position + velocity_ * kPrefetchSeconds);
+
+    const auto is_wanted = [&](const Cell &cell, const int32_t range) {
+        const glm::ivec2 coords{cell.entry.x, cell.entry.z};
+        return IsInRange_(coords, center, range) || IsInRange_(coords, predicted, range);
+    };
+
+    RequestCellsAround_(center, radius);
+    if (predicted != center) {
+        RequestCellsAround_(predicted, radius);
+    }
+
+    /* one cell of hysteresis avoids reloading cells on the border */
+    std::vector<uint64_t> distant_keys{};
+    for (const uint64_t key : loaded_keys_) {
+        if (!is_wanted(cells_.at(key), radius + 1)) {
+            distant_keys.push_back(key);
+        }
+    }
+
+    for (const uint64_t key : distant_keys) {
+        UnloadCell_(cells_.at(key));
+        loaded_keys_.erase(key);
+    }
+
+    if (!distant_keys.empty()) {
+        ResourceMgr::GetInstance().ReleaseOrphanedResources();
+    }
+
+    /* instantiate ready cells, GL resources can be created only here */
+    for (size_t instantiated = 0; instantiated < kMaxCellsPerFrame;) {
+        LoadedCell loaded{};
+        {
+            const std::lock_guard lock(mutex_);
+
+            if (loaded_.empty()) {
+                break;
+            }
+
+            loaded = std::move(loaded_.front());
+            loaded_.pop_front();
+        }
+
+        const auto it = cells_.find(loaded.key);
+        if (loaded.generation != generation_ || it == cells_.end() || it->second.state != CellState::kLoading) {
+            continue;
+        }
+
+        --stats_.pending_cells;
+        Cell &cell = it->second;
+
+        if (!is_wanted(cell, radius + 1)) {
+            /* camera moved away while the cell was read */
+            cell.state = CellState::kUnloaded;
+            continue;
+        }
+
+        if (IsFailure(loaded.rc)) {
+            /* broken cell stays empty until it leaves the neighborhood */
+            TRACE("Failed to load world cell: " << cell.entry.x << " " << cell.entry.z);
+            loaded.spec = {};
+            loaded.models.clear();
+        }
+
+        InstantiateCell_(cell, std::move(loaded.spec), std::move(loaded.models));
+        loaded_keys_.insert(loaded.key);
+        ++instantiated;
+    }
+
+    stats_.loaded_cells = loaded_keys_.size();
+}
+
+glm::ivec2 LibGcp::WorldStreamer::GetCell_(const glm::vec3 &position) const noexcept
+{
+    return {
+        static_cast<int32_t>(std::floor(position.x / cell_size_)),
+        static_cast<int32_t>(std::floor(position.z / cell_size_)),
+    };
+}
+
+bool LibGcp::WorldStreamer::IsInRange_(const glm::ivec2 &cell, const glm::ivec2 &center, const int32_t radius) noexcept
+{
+    return std::abs(cell.x - center.x) <= radius && std::abs(cell.y - center.y) <= radius;
+}
+
+void LibGcp::WorldStreamer::RequestCellsAround_(const glm::ivec2 &center, const int32_t radius)
+{
+    std::vector<CellRequest> requests{};
+
+    for (int32_t dz = -radius; dz <= radius; ++dz) {
+        for (int32_t dx = -radius; dx <= radius; ++dx) {
+            const uint64_t key = MakeKey_(center.x + dx, center.y + dz);
+
+            const auto it = cells_.find(key);
+            if (it == cells_.end() || it->second.state != CellState::kUnloaded) {
+                continue;
+            }
+
+            it->second.state = CellState::kLoading;
+            requests.push_back({
+                .generation = 0,
+                .key        = key,
+                .entry      = it->second.entry,
+            });
+        }
+    }
+
+    if (requests.empty()) {
+        return;
+    }
+
+    /* cells closest to the center go first */
+    std::ranges::sort(requests, {}, [&](const CellRequest &request) {
+        return std::max(std::abs(request.entry.x - center.x), std::abs(request.entry.z - center.y));
+    });
+
+    stats_.pending_cells += requests.size();
+    {
+        const std::lock_guard lock(mutex_);
+
+        for (auto &request : requests) {
+            request.generation = generation_;
+            requests_.push_back(request);
+        }
+    }
+    cv_.notify_one();
+}
+
+void LibGcp::WorldStreamer::InstantiateCell_(
+    Cell &cell, WorldCellSpec &&spec, std::vector<ModelImporter::Imported> &&models
+)
+{
+    std::unordered_map<std::string, const ModelImporter::Imported *> imported_models{};
+    for (const auto &imported : models) {
+        if (imported.IsValid()) {
+            imported_models.emplace(imported.path, &imported);
+        }
+    }
+
+    /* cell content is saved in the cells file, never with the scene */
+    for (auto &resource : spec.resources) {
+        resource.is_serializable = false;
+
+        std::shared_ptr<Resource> instance{};
+        switch (resource.type) {
+            case ResourceType::kModel:
+                if (const auto it = imported_models.find(resource.paths[0]); it != imported_models.end()) {
+                    UploadImportedModel_(resource, *it->second);
+                }
+
+                instance = ResourceMgr::GetInstance().GetModel(resource);
+                break;
+            case ResourceType::kTexture:
+                instance = ResourceMgr::GetInstance().GetTexture(resource);
+                break;
+            case ResourceType::kShader:
+                instance = ResourceMgr::GetInstance().GetShader(resource);
+                break;
+            default:
+                break;
+        }
+
+        if (instance) {
+            cell.resources.push_back(std::move(instance));
+        }
+    }
+
+    cell.object_ids.reserve(spec.static_objects.size());
+    for (auto &object : spec.static_objects) {
+        object.is_serializable = false;
+        cell.object_ids.push_back(ObjectMgr::GetInstance().AddStaticObject(object));
+    }
+
+    LightMgr::ApplyLights(spec.point_lights, spec.spot_lights);
+
+    cell.state = CellState::kLoaded;
+    stats_.streamed_objects += cell.object_ids.size();
+
+    TRACE(
+        "Loaded world cell: " << cell.entry.x << " " << cell.entry.z << " with " << cell.object_ids.size()
+                              << " objects"
+    );
+}
+
+void LibGcp::WorldStreamer::UploadImportedModel_(const ResourceSpec &resource, const ModelImporter::Imported &imported)
+{
+    const std::string &path = resource.paths[0];
+    ResourceMgr::GetInstance().SetTextureFlip(resource.flip_texture);
+
+    ModelSerializer serializer{};
+    std::shared_ptr<Model> model{};
+    if (!imported.blob.empty()) {
+        model = serializer.LoadModelFromBlob(imported.blob, path);
+    }
+
+    if (!model && imported.importer) {
+        model = serializer.BuildModelFromImport(*imported.importer, path);
+    }
+
+    /* failure is reported by the regular load, model loaded in the meantime is kept */
+    if (model) {
+        ResourceMgr::GetInstance().AdoptModel(resource, model);
+    }
+}
+
+void LibGcp::WorldStreamer::UnloadCell_(Cell &cell)
+{
+    ObjectMgr::GetInstance().RemoveStaticObjects({cell.object_ids.begin(), cell.object_ids.end()});
+    stats_.streamed_objects -= cell.object_ids.size();
+
+    /* models are released with the orphans once no other cell uses them */
+    cell.object_ids.clear();
+    cell.resources.clear();
+    cell.state = CellState::kUnloaded;
+
+    TRACE("Unloaded world cell: " << cell.entry.x << " " << cell.entry.z);
+}
+
+void LibGcp::WorldStreamer::Run_()
+{
+    Profiler::SetThreadName("World streamer");
+
+    while (true) {
+        CellRequest request{};
+        std::string path{};
+        {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [this] {
+                return !is_running_ || !requests_.empty();
+            });
+
+            if (!is_running_) {
+                return;
+            }
+
+            request = requests_.front();
+            requests_.pop_front();
+            path = worker_path_;
+        }
+
+        PROFILE_SCOPE("WorldStreamer::LoadCell");
+        auto [rc, spec] = SceneSerializer::LoadWorldCell(path, request.entry);
+
+        std::vector<ModelImporter::Imported> models{};
+        if (IsSuccess(rc)) {
+            for (const auto &resource : spec.resources) {
+                if (resource.type == ResourceType::kModel && resource.load_type == LoadType::kExternal) {
+                    models.push_back(ImportModel_(resource));
+                } else {
+                    WarmUpResource_(resource);
+                }
+            }
+        }
+
+        const std::lock_guard lock(mutex_);
+        if (request.generation == generation_) {
+            loaded_.push_back({
+                .generation = request.generation,
+                .key        = request.key,
+                .rc         = rc,
+                .spec       = std::move(spec),
+                .models     = std::move(models),
+            });
+        }
+    }
+}
+
+LibGcp::ModelImporter::Imported LibGcp::WorldStreamer::ImportModel_(const ResourceSpec &resource)
+{
+    ModelImporter::Imported imported{.path = resource.paths[0], .importer = {}, .blob = {}};
+
+    /* lazily loaded models are cheap placeholders, their import is requested once they are seen */
+    if (SettingsMgr::GetInstance().GetSetting<Setting::kLazyModelLoading, bool>()) {
+        return imported;
+    }
+
+    {
+        auto &models = ResourceMgr::GetInstance().GetModels();
+        const std::lock_guard lock(models.GetMutex());
+
+        /* shared with the cells already loaded */
+        if (models.contains(imported.path)) {
+            return imported;
+        }
+    }
+
+    PROFILE_SCOPE("WorldStreamer::ImportModel");
+
+    /* another process might have imported the model already */
+    imported.blob = ModelSerializer::FindSharedBlob(imported.path);
+    if (imported.blob.empty()) {
+        imported.importer = ModelSerializer::ImportExternalFormat(imported.path);
+    }
+
+    if (!imported.IsValid()) {
+        TRACE("Failed to import model of the world cell: " << imported.path);
+    }
+
+    return imported;
+}
+
+void LibGcp::WorldStreamer::WarmUpResource_(const ResourceSpec &resource)
+{
+    /* reading the file ahead lets the render thread load it from the page cache instead of the disk */
+    if (resource.load_type != LoadType::kExternal || resource.type == ResourceType::kShader) {
+        return;
+    }
+
+    std::ifstream file(resource.paths[0], std::ios::binary);
+    if (!file.is_open()) {
+        return;
+    }
+
+    std::vector<char> block(kWarmUpBlockSize);
+    while (file.read(block.data(), static_cast<std::streamsize>(block.size())) || file.gcount() > 0) {
+        /* content is not needed */
+    }
+}
@@ -0,0 +1,179 @@
+#ifndef ENGINE_WORLD_STREAMER_HPP_
+#define ENGINE_WORLD_STREAMER_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/engine/view.hpp>
+#include <libcgp/intf.hpp>
+#include <libcgp/rc.hpp>
+#include <libcgp/utils/model_importer.hpp>
+
+#include <glm/glm.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+LIBGCP_DECL_START_
+/**
+ * Loads cells of the partitioned scene around the camera and unloads the distant ones.
+ * Cells are read from the cells file on the worker thread, which also imports their models and warms up the files
+ * of the other resources, the render thread only uploads the imported models and instantiates ready cells, at most
+ * kMaxCellsPerFrame in a frame.
+ * Cells on the predicted camera path are requested ahead based on the camera velocity.
+ */
+class WorldStreamer
+{
+    // ------------------------------
+    // Class internals
+    // ------------------------------
+
+    static constexpr float kPrefetchSeconds   = 1.0f;
+    static constexpr float kVelocitySmoothing = 0.1f;
+    static constexpr size_t kMaxCellsPerFrame = 1;
+
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    struct Stats {
+        size_t total_cells;
+        size_t loaded_cells;
+        size_t pending_cells;
+        size_t streamed_objects;
+    };
+
+    protected:
+    enum class CellState : std::uint8_t {
+        kUnloaded,
+        kLoading,
+        kLoaded,
+    };
+
+    struct Cell {
+        WorldCellsSerialized::CellEntry entry;
+        CellState state;
+
+        /* held while the cell is loaded */
+        std::vector<uint64_t> object_ids;
+        std::vector<std::shared_ptr<Resource>> resources;
+    };
+
+    struct CellRequest {
+        uint64_t generation;
+        uint64_t key;
+        WorldCellsSerialized::CellEntry entry;
+    };
+
+    struct LoadedCell {
+        uint64_t generation;
+        uint64_t key;
+        Rc rc;
+        WorldCellSpec spec;
+
+        /* models not loaded yet when the cell was read, empty import means the regular load */
+        std::vector<ModelImporter::Imported> models;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    public:
+    WorldStreamer();
+
+    ~WorldStreamer();
+
+    WorldStreamer(const WorldStreamer &) = delete;
+
+    WorldStreamer &operator=(const WorldStreamer &) = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    void Start();
+
+    void Stop();
+
+    /* Reads the table of cells, nothing happens for the empty path */
+    Rc Open(const std::string &path);
+
+    /* Unloads all cells, must be called before the scene they belong to is replaced */
+    void Close();
+
+    /* Must be called once per frame from the thread owning GL context, delta in microseconds */
+    void Update(const View &view, uint64_t delta);
+
+    NDSCRD FAST_CALL bool IsOpen() const noexcept { return !path_.empty(); }
+
+    NDSCRD FAST_CALL const Stats &GetStats() const noexcept { return stats_; }
+
+    // ---------------------------------
+    // Class implementation methods
+    // ---------------------------------
+
+    protected:
+    NDSCRD FAST_CALL static uint64_t MakeKey_(const int32_t x, const int32_t z) noexcept
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(z);
+    }
+
+    NDSCRD glm::ivec2 GetCell_(const glm::vec3 &position) const noexcept;
+
+    NDSCRD static bool IsInRange_(const glm::ivec2 &cell, const glm::ivec2 &center, int32_t radius) noexcept;
+
+    void RequestCellsAround_(const glm::ivec2 &center, int32_t radius);
+
+    void InstantiateCell_(Cell &cell, WorldCellSpec &&spec, std::vector<ModelImporter::Imported> &&models);
+
+    /* Creates GPU resources of the model imported by the worker, must be called from the thread owning GL context */
+    static void UploadImportedModel_(const ResourceSpec &resource, const ModelImporter::Imported &imported);
+
+    void UnloadCell_(Cell &cell);
+
+    void Run_();
+
+    /* Parses the model file without touching GL, models already loaded or loaded lazily are skipped */
+    NDSCRD static ModelImporter::Imported ImportModel_(const ResourceSpec &resource);
+
+    static void WarmUpResource_(const ResourceSpec &resource);
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    /* render thread state */
+    std::string path_{};
+    float cell_size_{};
+    std::unordered_map<uint64_t, Cell> cells_{};
+    std::unordered_set<uint64_t> loaded_keys_{};
+
+    glm::vec3 last_position_{};
+    glm::vec3 velocity_{};
+    bool has_position_{};
+    Stats stats_{};
+
+    /* shared with the worker, results of the previous scene are recognized by the generation */
+    std::mutex mutex_{};
+    std::condition_variable cv_{};
+    std::deque<CellRequest> requests_{};
+    std::deque<LoadedCell> loaded_{};
+    std::string worker_path_{};
+    uint64_t generation_{};
+
+    std::atomic<bool> is_running_{};
+    std::thread thread_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // ENGINE_WORLD_STREAMER_HPP_
@@ -41,11 +41,14 @@ struct ObjectPosition {
     glm::vec3 position{};
     glm::vec3 rotation{};
     glm::vec3 scale{};
+
+    bool operator==(const ObjectPosition &) const = default;
 };
 
 struct StaticObjectSpec {
     ObjectPosition position{};
     std::string name{};
+    bool is_serializable{true};
 };
 
 struct DynamicObjectSpec {
@@ -66,6 +69,21 @@ struct alignas(32) Vertex {
     glm::vec3 tangent;
 };
 
+struct BoundingBox {
+    glm::vec3 min{};
+    glm::vec3 max{};
+
+    NDSCRD FAST_CALL glm::vec3 GetCenter() const noexcept { return (min + max) * 0.5f; }
+
+    NDSCRD FAST_CALL float GetRadius() const noexcept { return glm::length(max - min) * 0.5f; }
+
+    FAST_CALL void Extend(const BoundingBox &other) noexcept
+    {
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+    }
+};
+
 // ------------------------------
 // Engine
 // ------------------------------
@@ -139,12 +157,14 @@ struct Resource {
     public:
     const uint64_t resource_id = id_counter_.fetch_add(1);
 
+    std::array<std::string, 2> paths{};
     LoadType load_type   = LoadType::kLast;
     int8_t flip_texture  = -1;
     bool is_serializable = true;
 
     void SaveSpec(const ResourceSpec &spec) noexcept
     {
+        paths           = spec.paths;
         load_type       = spec.load_type;
         flip_texture    = spec.flip_texture;
         is_serializable = spec.is_serializable;
@@ -165,12 +185,16 @@ struct LightInfo {
     glm::vec3 diffuse;
     glm::vec3 specular;
     float intensity{1.0};
+
+    bool operator==(const LightInfo &) const = default;
 };
 
 struct PointLightInfo {
     float constant;
     float linear;
     float quadratic;
+
+    bool operator==(const PointLightInfo &) const = default;
 };
 
 struct SpotLightInfo {
@@ -180,6 +204,8 @@ struct SpotLightInfo {
     float quadratic;
     float cut_off;
     float outer_cut_off;
+
+    bool operator==(const SpotLightInfo &) const = default;
 };
 
 struct GlobalLightSpec {
@@ -222,6 +248,11 @@ enum class Setting : std::uint16_t {
     kFar,
     kProjectionType,
     kOrthoHeight,
+    kGpuMemoryBudgetMb,
+    kTextureStreaming,
+    kTextureUploadBudgetKb,
+    kWorldStreamingRadius,
+    kLazyModelLoading,
     kLast,
 };
 
@@ -263,7 +294,8 @@ using setting_t = std::vector<std::tuple<Setting, SettingContainer> >;
 
 template <size_t N>
 using SettingTypes = CxxUtils::TypeList<
-    N, CameraType, double, bool, double, uint64_t, double, bool, float, float, float, ProjectionType, float>;
+    N, CameraType, double, bool, double, uint64_t, double, bool, float, float, float, ProjectionType, float, uint64_t,
+    bool, uint64_t, uint64_t, bool>;
 static_assert(SettingTypes<0>::size == static_cast<size_t>(Setting::kLast), "Setting types list is incomplete");
 
 static constexpr std::array kSettingsDescriptions{
@@ -279,11 +311,28 @@ static constexpr std::array kSettingsDescriptions{
     "Far plane",
     "Projection type",
     "Ortho height",
+    "GPU memory budget [MiB]",
+    "Texture streaming",
+    "Texture upload budget [KiB/frame]",
+    "World streaming radius [cells]",
+    "Lazy model loading",
 };
 static_assert(
     kSettingsDescriptions.size() == static_cast<size_t>(Setting::kLast), "Setting descriptions list is incomplete"
 );
 
+/* Square part of the world on XZ plane, loaded and unloaded as a whole around the camera */
+struct WorldCellSpec {
+    int32_t x{};
+    int32_t z{};
+    resource_t resources{};
+    static_objects_t static_objects{};
+    point_lights_t point_lights{};
+    spot_lights_t spot_lights{};
+};
+
+using world_cells_t = std::vector<WorldCellSpec>;
+
 struct Scene {
     setting_t settings;
     resource_t resources;
@@ -291,6 +340,9 @@ struct Scene {
     static_objects_t static_objects;
     point_lights_t point_lights;
     spot_lights_t spot_lights;
+
+    /* path of the file with streamed cells, empty when the scene is not partitioned */
+    std::string world_cells{};
 };
 
 static inline const Scene kEmptyScene{
@@ -320,7 +372,20 @@ enum class SerializationType : std::uint8_t {
 };
 
 struct PACK SceneSerialized {
-    static constexpr uint64_t kMagic = 0xC4A1234BFEAE341;
+    static constexpr uint64_t kMagic      = 0xC4A1234BFEAE341;
+    static constexpr uint64_t kChunkMagic = 0x5EC7104C4A1234B;
+
+    /* Independent parts of the scene, each one is stored in a separate chunk */
+    enum class Section : std::uint8_t {
+        kSettings,
+        kResources,
+        kStaticObjects,
+        kPointLights,
+        kSpotLights,
+        kLast,
+    };
+
+    static constexpr size_t kSectionsCount = static_cast<size_t>(Section::kLast);
 
     struct PACK BaseHeader {
         Version source_version;
@@ -333,6 +398,7 @@ struct PACK SceneSerialized {
         uint64_t magic = kMagic;
     };
 
+    /* Header used by SceneVersion::V0_1_1 files - single contiguous payload */
     struct PACK SceneHeader {
         BaseHeader base_header;
 
@@ -344,6 +410,23 @@ struct PACK SceneSerialized {
         size_t num_spot_lights;
     };
 
+    /* Header used since SceneVersion::V0_1_2 - payload is a sequence of chunks */
+    struct PACK ChunkedSceneHeader {
+        BaseHeader base_header;
+
+        size_t num_chunks;                       // all chunks in the file, including superseded ones
+        size_t section_offsets[kSectionsCount];  // offset of the latest chunk of each section, 0 if missing
+    };
+
+    struct PACK ChunkHeader {
+        Section section;
+        size_t num_records;
+        size_t num_strings;
+        size_t payload_bytes;
+
+        uint64_t magic = kChunkMagic;
+    };
+
     struct PACK SettingsSerialized {
         Setting setting;
         uint64_t value;
@@ -382,17 +465,41 @@ struct PACK SceneSerialized {
         /* char data[0]; */
     };
 
-    SceneHeader header;
+    ChunkedSceneHeader header;
 
-    /* SettingsSerialized settings[]; */
-    /* ResourceSerialized resources[]; */
-    /* StaticObjectSerialized static_objects[]; */
-    /* PointLightSerialized point_lights[]; */
-    /* SpotLightSerialized spot_lights[]; */
-    /* size_t string_table[]; */
+    /* Chunks are appended on save, section_offsets always point to the latest one: */
+    /* ChunkHeader chunk_header; */
+    /* T records[]; -- one of the *Serialized types depending on the section, */
+    /*                  since V0_1_3 static objects are a byte stream of PlacementCodec */
+    /* size_t string_table[]; -- strings are local to the chunk */
     /* StringSerialized string_data[]; */
 };
 
+/* Spatial cells of the scene, stored next to the scene file so that every cell can be read on its own */
+struct PACK WorldCellsSerialized {
+    static constexpr uint64_t kMagic = 0xCE11C4A1234BFEAULL;
+
+    struct PACK Header {
+        SceneVersion scene_version;
+        float cell_size;
+        size_t num_cells;
+
+        uint64_t magic = kMagic;
+    };
+
+    /* Cells use the scene chunk format, settings section is never present */
+    struct PACK CellEntry {
+        int32_t x;
+        int32_t z;
+        size_t section_offsets[SceneSerialized::kSectionsCount];
+    };
+
+    Header header;
+
+    /* CellEntry cells[num_cells]; */
+    /* chunks of all cells */
+};
+
 LIBGCP_DECL_END_
 
 #endif  // INTF_HPP_
@@ -2,12 +2,21 @@
 #define MAIN_HPP_
 
 #include <libcgp/defines.hpp>
+#include <libcgp/engine/bench_loop.hpp>
 #include <libcgp/mgr/settings_mgr.hpp>
 
+#include <string>
+
 LIBGCP_DECL_START_
 
 int RenderEngineMain(const Scene& scene);
 
+/* Scene is parsed and its assets are prepared on worker threads while the window is created */
+int RenderEngineMain(const std::string& scene_path);
+
+/* Loads the scene into a hidden window and renders the benchmark frames */
+int RenderEngineBenchMain(const BenchConfig& config);
+
 LIBGCP_DECL_END_
 
 #endif  // MAIN_HPP_
@@ -1,9 +1,14 @@
 #include <libcgp/engine/engine.hpp>
+#include <libcgp/engine/render_stats.hpp>
 #include <libcgp/mgr/object_mgr.hpp>
 #include <libcgp/mgr/resource_mgr.hpp>
 #include <libcgp/primitives/shader.hpp>
 #include <libcgp/primitives/static_object.hpp>
+#include <libcgp/utils/profiler.hpp>
 
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 LibGcp::ObjectMgrBase::ObjectMgrBase()
@@ -15,19 +20,110 @@ LibGcp::ObjectMgrBase::ObjectMgrBase()
 
 LibGcp::ObjectMgrBase::~ObjectMgrBase() { TRACE("ObjectMgrBase::~ObjectMgrBase()"); }
 
-void LibGcp::ObjectMgrBase::LoadObjectsFromScene(const Scene &scene)
+void LibGcp::ObjectMgrBase::ReconcileObjectsWithScene(const Scene &scene)
 {
-    for (const auto &spec : scene.static_objects) {
-        CreateStaticObject_(spec);
+    /* objects are matched by the model instance, so objects of reloaded models are recreated */
+    std::unordered_map<const Model *, std::vector<size_t>> pending_specs{};
+    for (size_t idx = 0; idx < scene.static_objects.size(); ++idx) {
+        const auto model = ResourceMgr::GetInstance().GetModel(scene.static_objects[idx].name, LoadType::kExternal);
+        pending_specs[model.get()].push_back(idx);
     }
+
+    std::lock_guard lock(static_objects_.GetMutex());
+    std::vector<bool> is_kept(static_objects_.size());
+
+    /* first pass: objects which did not change at all */
+    for (size_t idx = 0; idx < static_objects_.size(); ++idx) {
+        const auto it = pending_specs.find(static_objects_[idx].GetModel().get());
+        if (it == pending_specs.end()) {
+            continue;
+        }
+
+        const auto spec_it = std::ranges::find_if(it->second, [&](const size_t spec_idx) {
+            return scene.static_objects[spec_idx].position == static_objects_[idx].GetPosition();
+        });
+        if (spec_it == it->second.end()) {
+            continue;
+        }
+
+        it->second.erase(spec_it);
+        is_kept[idx] = true;
+    }
+
+    /* second pass: remaining objects of the same model are moved instead of recreated */
+    for (size_t idx = 0; idx < static_objects_.size(); ++idx) {
+        const auto it = pending_specs.find(static_objects_[idx].GetModel().get());
+        if (is_kept[idx] || it == pending_specs.end() || it->second.empty()) {
+            continue;
+        }
+
+        static_objects_[idx].GetPosition() = scene.static_objects[it->second.back()].position;
+        it->second.pop_back();
+        is_kept[idx] = true;
+    }
+
+    /* remove objects missing from the new scene */
+    size_t kept_count{};
+    for (size_t idx = 0; idx < static_objects_.size(); ++idx) {
+        if (!is_kept[idx]) {
+            static_objects_.GetListeners().NotifyListeners<CxxUtils::ContainerEvents::kRemove>(&static_objects_[idx]);
+            continue;
+        }
+
+        if (kept_count != idx) {
+            static_objects_[kept_count] = std::move(static_objects_[idx]);
+        }
+        ++kept_count;
+    }
+
+    const size_t removed_count = static_objects_.size() - kept_count;
+    static_objects_.erase(static_objects_.begin() + static_cast<std::ptrdiff_t>(kept_count), static_objects_.end());
+
+    /* create objects introduced by the new scene, preserving the scene order */
+    std::vector<size_t> missing_specs{};
+    for (const auto &[model, spec_indices] : pending_specs) {
+        missing_specs.insert(missing_specs.end(), spec_indices.begin(), spec_indices.end());
+    }
+    std::ranges::sort(missing_specs);
+
+    for (const size_t spec_idx : missing_specs) {
+        CreateStaticObjectUnlocked_(scene.static_objects[spec_idx]);
+    }
+
+    TRACE(
+        "Reconciled static objects: kept " << kept_count << ", removed " << removed_count << ", created "
+                                           << missing_specs.size()
+    );
 }
 
 void LibGcp::ObjectMgrBase::DrawStaticObjects(Shader &shader) const
 {
+    PROFILE_SCOPE("ObjectMgr::DrawStaticObjects");
+
+    const View &view = Engine::GetInstance().GetView();
+    draw_stats_      = {};
+
     for (const auto &object : static_objects_) {
-        Engine::GetInstance().GetView().PrepareModelMatrices(shader, object.GetPosition());
+        const Model &model             = object.GetModelRef();
+        const ObjectPosition &position = object.GetPosition();
+        const glm::mat4 model_matrix   = View::PrepareModelMatrices(position);
+
+        if (!view.IsVisible(model.GetBoundingBox(), model_matrix, position.scale)) {
+            ++draw_stats_.culled_objects;
+            continue;
+        }
+
+        ++draw_stats_.drawn_objects;
+        draw_stats_.drawn_meshes += model.GetMeshesCount();
+
+        /* visible placeholder is drawn until the model arrives */
+        ResourceMgr::GetInstance().RequestModelLoad(model);
+
+        View::PrepareModelMatrices(shader, model_matrix);
         object.Draw(shader);
     }
+
+    RenderStats::AddObjects(draw_stats_.drawn_objects, draw_stats_.culled_objects);
 }
 
 void LibGcp::ObjectMgrBase::ProcessProgress(UNUSED long delta_time_micros) {}
@@ -45,13 +141,40 @@ void LibGcp::ObjectMgrBase::RemoveStaticObject(const uint64_t ident)
     static_objects_.erase(obj_it);
 }
 
-void LibGcp::ObjectMgrBase::CreateStaticObject_(const StaticObjectSpec &spec)
+void LibGcp::ObjectMgrBase::RemoveStaticObjects(const std::unordered_set<uint64_t> &idents)
 {
     std::lock_guard lock(static_objects_.GetMutex());
+
+    size_t kept_count{};
+    for (size_t idx = 0; idx < static_objects_.size(); ++idx) {
+        if (idents.contains(static_objects_[idx].GetId())) {
+            static_objects_.GetListeners().NotifyListeners<CxxUtils::ContainerEvents::kRemove>(&static_objects_[idx]);
+            continue;
+        }
+
+        if (kept_count != idx) {
+            static_objects_[kept_count] = std::move(static_objects_[idx]);
+        }
+        ++kept_count;
+    }
+
+    static_objects_.erase(static_objects_.begin() + static_cast<std::ptrdiff_t>(kept_count), static_objects_.end());
+}
+
+uint64_t LibGcp::ObjectMgrBase::CreateStaticObject_(const StaticObjectSpec &spec)
+{
+    std::lock_guard lock(static_objects_.GetMutex());
+    return CreateStaticObjectUnlocked_(spec);
+}
+
+uint64_t LibGcp::ObjectMgrBase::CreateStaticObjectUnlocked_(const StaticObjectSpec &spec)
+{
     auto obj = static_objects_.emplace_back(
-        spec.position, ResourceMgr::GetInstance().GetModel(spec.name, LoadType::kExternal)
+        spec.position, ResourceMgr::GetInstance().GetModel(spec.name, LoadType::kExternal), spec.is_serializable
     );
     static_objects_.GetListeners().NotifyListeners<CxxUtils::ContainerEvents::kAdd>(&obj);
+
+    return obj.GetId();
 }
 
 void LibGcp::ObjectMgrBase::CreateDynamicObject_(UNUSED const DynamicObjectSpec &spec) {}
@@ -10,6 +10,7 @@
 #include <CxxUtils/static_singleton.hpp>
 
 #include <mutex>
+#include <unordered_set>
 #include <vector>
 
 LIBGCP_DECL_START_
@@ -21,11 +22,22 @@ class ObjectMgrBase : public CxxUtils::StaticSingletonHelper
 
     static constexpr size_t kDefaultStorageSize = static_cast<size_t>(2 * 16384);
 
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    /* Counted during the last DrawStaticObjects call */
+    struct DrawStats {
+        size_t drawn_objects;
+        size_t culled_objects;
+        size_t drawn_meshes;
+    };
+
     // ------------------------------
     // Object creation
     // ------------------------------
 
-    public:
     ObjectMgrBase();
 
     ~ObjectMgrBase() override;
@@ -34,24 +46,32 @@ class ObjectMgrBase : public CxxUtils::StaticSingletonHelper
     // Class interaction
     // ------------------------------
 
-    void LoadObjectsFromScene(const Scene &scene);
+    /* Keeps objects present in both scenes, moves the ones changed in place, removes and creates the rest */
+    void ReconcileObjectsWithScene(const Scene &scene);
 
     void DrawStaticObjects(Shader &shader) const;
 
+    NDSCRD FAST_CALL const DrawStats &GetDrawStats() const noexcept { return draw_stats_; }
+
     void ProcessProgress(long delta_time_micros);
 
     NDSCRD FAST_CALL CxxUtils::ExtendedVector<StaticObject> &GetStaticObjects() { return static_objects_; }
 
-    FAST_CALL void AddStaticObject(const StaticObjectSpec &spec) { CreateStaticObject_(spec); }
+    FAST_CALL uint64_t AddStaticObject(const StaticObjectSpec &spec) { return CreateStaticObject_(spec); }
 
     void RemoveStaticObject(uint64_t ident);
 
+    /* Removes all objects with given ids in a single pass */
+    void RemoveStaticObjects(const std::unordered_set<uint64_t> &idents);
+
     // ---------------------------------
     // Class implementation methods
     // ---------------------------------
 
     protected:
-    void CreateStaticObject_(const StaticObjectSpec &spec);
+    uint64_t CreateStaticObject_(const StaticObjectSpec &spec);
+
+    uint64_t CreateStaticObjectUnlocked_(const StaticObjectSpec &spec);
 
     void CreateDynamicObject_(const DynamicObjectSpec &spec);
 
@@ -60,6 +80,7 @@ class ObjectMgrBase : public CxxUtils::StaticSingletonHelper
     // ------------------------------
 
     CxxUtils::ExtendedVector<StaticObject> static_objects_;
+    mutable DrawStats draw_stats_{};
 };
 
 using ObjectMgr = CxxUtils::StaticSingleton<ObjectMgrBase>;
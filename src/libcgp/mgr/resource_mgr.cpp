@@ -1,9 +1,16 @@
 #include <libcgp/mgr/resource_mgr.hpp>
+#include <libcgp/mgr/settings_mgr.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <sstream>
 #include <string>
 
@@ -11,13 +18,130 @@
 #include <libcgp/primitives/shader.hpp>
 #include <libcgp/primitives/texture.hpp>
 #include <libcgp/rc.hpp>
+#include <libcgp/serialization/mesh_codec.hpp>
+#include <libcgp/utils/files.hpp>
+#include <libcgp/utils/hash.hpp>
 #include <libcgp/utils/macros.hpp>
+#include <libcgp/utils/shared_asset_cache.hpp>
 
 #include <shaders/static_header.hpp>
 
+#include <assimp/Importer.hpp>
+
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+/* Vertex is over-aligned, padding bytes must not take part in the hash */
+static constexpr size_t kVertexPayloadBytes = offsetof(LibGcp::Vertex, tangent) + sizeof(glm::vec3);
+
+static constexpr uint64_t kTextureHashSeed       = 0x7E87;
+static constexpr uint64_t kMeshHashSeed          = 0x3E54;
+static constexpr uint64_t kSharedTextureHashSeed = 0x5E7E;
+static constexpr uint64_t kEncodedMeshHashSeed   = 0xE3E5;
+
+static constexpr size_t kBytesInMb = 1024 * 1024;
+
+static constexpr size_t kMinFlyweightSweepSize = 1024;
+
+/* names inside the cache directory, see GetCachePath */
+static constexpr const char *kProgramCacheDir = "shaders";
+static constexpr const char *kMipCacheDir     = "mips";
+static constexpr const char *kBoundsCacheDir  = "bounds";
+
+/* put on tmpfs to keep the shared assets only in memory, file is sparse so capacity is just the upper bound */
+static constexpr const char *kSharedAssetCachePath = "shared_assets.bin";
+static constexpr size_t kSharedAssetCacheCapacity = 4ULL * 1024 * 1024 * 1024;
+
+/* Precedes pixels of the texture stored in the shared asset cache */
+struct SharedTextureHeader {
+    int32_t width;
+    int32_t height;
+    int32_t channels;
+    int32_t reserved;
+};
+
+/* Entries come from a file writable by any process, so they are trusted only when the pixels match the header */
+static bool IsSharedTextureValid(const LibGcp::SharedAssetCache::payload_t payload, const SharedTextureHeader &header)
+{
+    static constexpr int32_t kMaxDimension = 1 << 16;
+
+    if (header.width <= 0 || header.width > kMaxDimension || header.height <= 0 || header.height > kMaxDimension ||
+        header.channels < 1 || header.channels > 4) {
+        return false;
+    }
+
+    const size_t pixels_size = static_cast<size_t>(header.width) * static_cast<size_t>(header.height) *
+                               static_cast<size_t>(header.channels);
+    return payload.size() == sizeof(SharedTextureHeader) + pixels_size;
+}
+
+static LibGcp::Hash128 HashTexture(const unsigned char *data, const int width, const int height, const int channels)
+{
+    LibGcp::ContentHasher hasher(kTextureHashSeed);
+
+    hasher.Update(width);
+    hasher.Update(height);
+    hasher.Update(channels);
+    hasher.Update(data, static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(channels));
+
+    return hasher.Finalize();
+}
+
+static LibGcp::Hash128 HashMeshGeometry(
+    const std::span<const LibGcp::Vertex> vertices, const std::span<const GLuint> indices
+)
+{
+    LibGcp::ContentHasher hasher(kMeshHashSeed);
+
+    hasher.Update(vertices.size());
+    for (const auto &vertex : vertices) {
+        hasher.Update(&vertex, kVertexPayloadBytes);
+    }
+    hasher.Update(indices.data(), indices.size_bytes());
+
+    return hasher.Finalize();
+}
+
+/* Registers the flyweight, entries of released payloads are swept once the map doubled since the last sweep */
+template <class T>
+static void InsertFlyweight(
+    std::unordered_map<LibGcp::Hash128, std::weak_ptr<T>, LibGcp::Hash128Hasher> &map, const LibGcp::Hash128 &hash,
+    const std::shared_ptr<T> &payload, size_t &sweep_size
+)
+{
+    map[hash] = payload;
+
+    if (map.size() >= sweep_size) {
+        std::erase_if(map, [](const auto &entry) {
+            return entry.second.expired();
+        });
+        sweep_size = std::max(kMinFlyweightSweepSize, 2 * map.size());
+    }
+}
+
+static bool ReadWholeFile(const std::string &path, std::string &out)
+{
+    std::ifstream file(path);
+
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::stringstream stream;
+    stream << file.rdbuf();
+    out = stream.str();
+
+    return !file.fail();
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
 LibGcp::ResourceMgrBase::ResourceMgrBase()
 {
     TRACE("ResourceMgrBase::ResourceMgrBase()");
@@ -25,9 +149,56 @@ LibGcp::ResourceMgrBase::ResourceMgrBase()
     textures_.reserve(kDefaultMapSize);
     shaders_.reserve(kDefaultMapSize);
     models_.reserve(kDefaultMapSize);
+
+    bounds_cache_   = std::make_unique<ModelBoundsCache>(GetCachePath(kBoundsCacheDir));
+    model_importer_ = std::make_unique<ModelImporter>();
+    model_importer_->Start();
+
+    /* shaders are never evicted, so only their memory is tracked */
+    TrackUsage_(textures_, texture_usage_);
+    TrackUsage_(models_, model_usage_);
+
+    SettingsMgr::GetInstance().AddListener(Setting::kGpuMemoryBudgetMb, OnMemoryBudgetChanged_);
+
+    if constexpr (kUseHotReload) {
+        InitHotReload_();
+    }
+}
+
+LibGcp::ResourceMgrBase::~ResourceMgrBase()
+{
+    TRACE("ResourceMgrBase::~ResourceMgrBase()");
+
+    /* watcher thread must not touch the maps during destruction */
+    file_watcher_.reset();
+    model_importer_.reset();
+}
+
+void LibGcp::ResourceMgrBase::InitContext()
+{
+    TRACE("ResourceMgrBase::InitContext()");
+
+    program_cache_ = std::make_unique<ProgramCache>(GetCachePath(kProgramCacheDir));
+
+    /* let the driver use all its threads for shader variants */
+    if (GLAD_GL_KHR_parallel_shader_compile) {
+        glMaxShaderCompilerThreadsKHR(std::numeric_limits<GLuint>::max());
+    }
 }
 
-LibGcp::ResourceMgrBase::~ResourceMgrBase() { TRACE("ResourceMgrBase::~ResourceMgrBase()"); }
+void LibGcp::ResourceMgrBase::OpenSharedAssetCache()
+{
+    TRACE("ResourceMgrBase::OpenSharedAssetCache()");
+
+    if constexpr (kUseSharedAssetCache) {
+        shared_asset_cache_ =
+            std::make_unique<SharedAssetCache>(GetCachePath(kSharedAssetCachePath), kSharedAssetCacheCapacity);
+
+        if (!shared_asset_cache_->IsEnabled()) {
+            shared_asset_cache_.reset();
+        }
+    }
+}
 
 void LibGcp::ResourceMgrBase::LoadResourceFromScene(const Scene &scene)
 {
@@ -50,6 +221,73 @@ void LibGcp::ResourceMgrBase::LoadResourceFromScene(const Scene &scene)
     }
 }
 
+void LibGcp::ResourceMgrBase::ReconcileResourcesWithScene(const Scene &scene)
+{
+    std::unordered_map<std::string, const ResourceSpec *> wanted_textures{};
+    std::unordered_map<std::string, const ResourceSpec *> wanted_shaders{};
+    std::unordered_map<std::string, const ResourceSpec *> wanted_models{};
+
+    for (const auto &resource : scene.resources) {
+        switch (resource.type) {
+            case ResourceType::kTexture:
+                wanted_textures[resource.paths[0]] = &resource;
+                break;
+            case ResourceType::kShader:
+                wanted_shaders[resource.paths[0] + "//" + resource.paths[1]] = &resource;
+                break;
+            case ResourceType::kModel:
+                wanted_models[resource.paths[0]] = &resource;
+                break;
+            case ResourceType::kLast:
+                R_ASSERT(false);
+        }
+    }
+
+    /* objects and lights refer to models by name only, any spec is fine for them */
+    for (const auto &spec : scene.static_objects) {
+        wanted_models.try_emplace(spec.name, nullptr);
+    }
+
+    for (const auto &spec : scene.point_lights) {
+        wanted_models.try_emplace(spec.model_name, nullptr);
+    }
+
+    for (const auto &spec : scene.spot_lights) {
+        wanted_models.try_emplace(spec.model_name, nullptr);
+    }
+
+    {
+        const std::scoped_lock lock(models_.GetMutex(), textures_.GetMutex(), shaders_.GetMutex());
+
+        const size_t released = ReleaseUnwantedUnlocked_(models_, wanted_models) +
+                                ReleaseUnwantedUnlocked_(textures_, wanted_textures) +
+                                ReleaseUnwantedUnlocked_(shaders_, wanted_shaders);
+
+        /* specs of the new scene take precedence over the ones saved on eviction */
+        const auto is_scene_resource = [](const auto &entry) {
+            return entry.second.is_serializable;
+        };
+        std::erase_if(evicted_models_, is_scene_resource);
+        std::erase_if(evicted_textures_, is_scene_resource);
+
+        TRACE("Released " << released << " resources missing from the new scene");
+    }
+
+    /* already loaded resources are skipped */
+    LoadResourceFromScene(scene);
+}
+
+void LibGcp::ResourceMgrBase::ReleaseOrphanedResources()
+{
+    const std::scoped_lock lock(models_.GetMutex(), textures_.GetMutex(), shaders_.GetMutex());
+
+    /* models go first as they hold their textures */
+    const size_t released = ReleaseOrphanedUnlocked_(models_) + ReleaseOrphanedUnlocked_(textures_) +
+                            ReleaseOrphanedUnlocked_(shaders_);
+
+    TRACE("Released " << released << " orphaned resources");
+}
+
 std::shared_ptr<LibGcp::Texture> LibGcp::ResourceMgrBase::GetTexture(const ResourceSpec &resource)
 {
     assert(resource.type == ResourceType::kTexture);
@@ -59,13 +297,21 @@ std::shared_ptr<LibGcp::Texture> LibGcp::ResourceMgrBase::GetTexture(const Resou
 
     if (textures_.contains(texture_name)) {
         TRACE(texture_name + " texture already loaded");
+        TouchResource_(texture_usage_, texture_name);
         return textures_.at(texture_name);
     }
 
     TRACE(texture_name + " texture not loaded");
-    R_ASSERT(IsSuccess(LoadTextureUnlocked_(resource)));
+
+    /* evicted textures are reloaded with the spec they were originally loaded with */
+    const auto evicted_it = evicted_textures_.find(texture_name);
+    R_ASSERT(IsSuccess(LoadTextureUnlocked_(evicted_it == evicted_textures_.end() ? resource : evicted_it->second)));
     TRACE(texture_name + " texture loaded");
 
+    if (evicted_it != evicted_textures_.end()) {
+        evicted_textures_.erase(evicted_it);
+    }
+
     assert(textures_.contains(texture_name));
     return textures_.at(texture_name);
 }
@@ -100,12 +346,26 @@ std::shared_ptr<LibGcp::Model> LibGcp::ResourceMgrBase::GetModel(const ResourceS
 
     if (models_.contains(model_name)) {
         TRACE(model_name + " model already loaded");
+        TouchResource_(model_usage_, model_name);
         return models_.at(model_name);
     }
 
     TRACE(model_name + " model not loaded");
-    R_ASSERT(IsSuccess(LoadModelUnlocked_(resource)));
-    TRACE(model_name + " model loaded");
+
+    /* evicted models are reloaded with the spec they were originally loaded with */
+    const auto evicted_it    = evicted_models_.find(model_name);
+    const ResourceSpec &spec = evicted_it == evicted_models_.end() ? resource : evicted_it->second;
+
+    /* lazy models start as placeholders resolved in the background once seen */
+    const bool is_lazy = SettingsMgr::GetInstance().GetSetting<Setting::kLazyModelLoading, bool>() &&
+                         spec.load_type == LoadType::kExternal;
+
+    R_ASSERT(IsSuccess(is_lazy ? LoadModelPlaceholderUnlocked_(spec) : LoadModelUnlocked_(spec)));
+    TRACE(model_name + (is_lazy ? " model placeholder created" : " model loaded"));
+
+    if (evicted_it != evicted_models_.end()) {
+        evicted_models_.erase(evicted_it);
+    }
 
     assert(models_.contains(model_name));
     return models_.at(model_name);
@@ -142,6 +402,48 @@ std::shared_ptr<LibGcp::Model> LibGcp::ResourceMgrBase::GetModel(
     return GetModel({.paths = {model_name}, .type = ResourceType::kModel, .load_type = load_type});
 }
 
+std::shared_ptr<LibGcp::Shader> LibGcp::ResourceMgrBase::GetShaderVariant(
+    const std::string &shader_name, const shader_defines_t &defines
+)
+{
+    const std::string variant_name = shader_name + "#" + Shader::SerializeDefines(defines);
+
+    /* program of the asynchronous variant is measured once it is ready */
+    const MemoryTracker::OwnerScope owner_scope(variant_name);
+
+    const std::lock_guard lock(shaders_.GetMutex());
+    auto it = shader_variants_.find(variant_name);
+
+    if (it == shader_variants_.end()) {
+        if (shader_variants_.size() >= kMaxShaderVariants && !EvictShaderVariantUnlocked_()) {
+            TRACE("Shader variant cap reached with all variants compiling, using generic shader: " << variant_name);
+            return nullptr;
+        }
+
+        const size_t end = shader_name.find("//");
+        assert(end != std::string::npos);
+
+        const std::string vert = shader_name.substr(0, end);
+        const std::string frag = shader_name.substr(end + 2);
+
+        R_ASSERT(StaticShaders::g_KnownFragmentShaders.contains(frag));
+        R_ASSERT(StaticShaders::g_KnownVertexShaders.contains(vert));
+
+        auto shader = std::make_shared<Shader>(
+            StaticShaders::g_KnownVertexShaders[vert], StaticShaders::g_KnownFragmentShaders[frag],
+            program_cache_.get(), defines, true
+        );
+
+        TRACE("Requested shader variant: " << shader_name << " with " << defines.size() << " defines");
+        it = shader_variants_.emplace(variant_name, ShaderVariant{.shader = std::move(shader), .last_use = 0}).first;
+    }
+
+    it->second.last_use = use_clock_.fetch_add(1);
+
+    /* failed variants are never ready, caller keeps using the generic shader */
+    return it->second.shader->IsReady() ? it->second.shader : nullptr;
+}
+
 std::shared_ptr<LibGcp::Texture> LibGcp::ResourceMgrBase::GetTextureExternalSourceRaw(
     const std::string &path, const TextureSpec &spec
 )
@@ -150,10 +452,12 @@ std::shared_ptr<LibGcp::Texture> LibGcp::ResourceMgrBase::GetTextureExternalSour
 
     if (textures_.contains(path)) {
         TRACE(path + " texture already loaded");
+        TouchResource_(texture_usage_, path);
         return textures_.at(path);
     }
 
     TRACE(path + " texture not loaded");
+    const MemoryTracker::OwnerScope owner_scope(path);
 
     std::shared_ptr<Texture> texture;
     if (spec.height == 0) {
@@ -162,8 +466,7 @@ std::shared_ptr<LibGcp::Texture> LibGcp::ResourceMgrBase::GetTextureExternalSour
         texture = LoadTextureFromMemory_(spec.texture_data, spec.width);
     } else {
         TRACE("Received raw texture");
-        texture =
-            std::make_shared<Texture>(spec.texture_data, spec.width, spec.height, spec.channels, Texture::Type::kLast);
+        texture = CreateTexture_(spec.texture_data, spec.width, spec.height, spec.channels);
     }
 
     textures_[path] = texture;
@@ -175,8 +478,260 @@ std::shared_ptr<LibGcp::Texture> LibGcp::ResourceMgrBase::GetTextureExternalSour
     return texture;
 }
 
+std::shared_ptr<LibGcp::MeshGeometry> LibGcp::ResourceMgrBase::GetMeshGeometry(
+    std::vector<Vertex> &&vertices, std::vector<GLuint> &&indices
+)
+{
+    const Hash128 hash = HashMeshGeometry(vertices, indices);
+
+    const std::lock_guard lock(flyweight_mutex_);
+    if (auto geometry = FindMeshGeometryUnlocked_(hash)) {
+        return geometry;
+    }
+
+    auto geometry = std::make_shared<MeshGeometry>(std::move(vertices), std::move(indices));
+    InsertFlyweight(mesh_geometries_, hash, geometry, mesh_sweep_size_);
+
+    return geometry;
+}
+
+std::shared_ptr<LibGcp::MeshGeometry> LibGcp::ResourceMgrBase::GetMeshGeometry(
+    const std::span<const Vertex> vertices, const std::span<const GLuint> indices
+)
+{
+    const Hash128 hash = HashMeshGeometry(vertices, indices);
+
+    const std::lock_guard lock(flyweight_mutex_);
+    if (auto geometry = FindMeshGeometryUnlocked_(hash)) {
+        return geometry;
+    }
+
+    auto geometry = std::make_shared<MeshGeometry>(vertices, indices);
+    InsertFlyweight(mesh_geometries_, hash, geometry, mesh_sweep_size_);
+
+    return geometry;
+}
+
+std::shared_ptr<LibGcp::MeshGeometry> LibGcp::ResourceMgrBase::GetMeshGeometry(const std::span<const std::byte> encoded)
+{
+    MeshCodec::Header header{};
+    if (!MeshCodec::ReadHeader(encoded, header) || header.vertex_count == 0 || header.index_count == 0) {
+        return nullptr;
+    }
+
+    /* identical payloads encode identically, so the stream is hashed instead of the decoded mesh */
+    const Hash128 hash = HashBytes(encoded.data(), encoded.size(), kEncodedMeshHashSeed);
+
+    {
+        const std::lock_guard lock(flyweight_mutex_);
+        if (auto geometry = FindMeshGeometryUnlocked_(hash)) {
+            return geometry;
+        }
+    }
+
+    /* decoding is the expensive part, so other threads may look up meshes meanwhile */
+    auto geometry = std::make_shared<MeshGeometry>(
+        static_cast<size_t>(header.vertex_count), static_cast<size_t>(header.index_count),
+        MeshCodec::GetBoundingBox(header),
+        [encoded](const std::span<Vertex> vertices, const std::span<GLuint> indices) {
+            return MeshCodec::Decode(encoded, vertices, indices);
+        }
+    );
+
+    if (!geometry->IsValid()) {
+        return nullptr;
+    }
+
+    /* same stream might have been decoded concurrently, the first inserted one is shared */
+    const std::lock_guard lock(flyweight_mutex_);
+    if (auto existing = FindMeshGeometryUnlocked_(hash)) {
+        return existing;
+    }
+
+    InsertFlyweight(mesh_geometries_, hash, geometry, mesh_sweep_size_);
+    return geometry;
+}
+
+std::shared_ptr<LibGcp::MeshGeometry> LibGcp::ResourceMgrBase::FindMeshGeometryUnlocked_(const Hash128 &hash)
+{
+    const auto it = mesh_geometries_.find(hash);
+    if (it == mesh_geometries_.end()) {
+        return nullptr;
+    }
+
+    auto geometry = it->second.lock();
+    if (!geometry) {
+        mesh_geometries_.erase(it);
+        return nullptr;
+    }
+
+    TRACE("Reusing mesh geometry with " << geometry->GetIndicesCount() << " indices");
+
+    ++dedup_stats_.shared_meshes;
+    dedup_stats_.bytes_saved += geometry->GetSizeBytes();
+
+    return geometry;
+}
+
+bool LibGcp::ResourceMgrBase::TakePredecodedTexture_(const std::string &path, PredecodedTexture &out)
+{
+    const std::lock_guard lock(predecoded_mutex_);
+
+    const auto it = predecoded_textures_.find(path);
+    if (it == predecoded_textures_.end() || it->second.pixels.empty() ||
+        it->second.flip_texture != texture_flip_.load()) {
+        return false;
+    }
+
+    out = std::move(it->second);
+    predecoded_textures_.erase(it);
+
+    return true;
+}
+
+void LibGcp::ResourceMgrBase::SetTextureFlip(const int8_t flip_texture)
+{
+    if (flip_texture == -1) {
+        return;
+    }
+
+    /* stb keeps the flag globally, remembered value lets the shared asset cache key the decoded pixels */
+    stbi_set_flip_vertically_on_load(flip_texture);
+    texture_flip_ = flip_texture;
+}
+
+void LibGcp::ResourceMgrBase::PredecodeTexture(const std::string &path, const int8_t flip_texture)
+{
+    {
+        const std::lock_guard lock(predecoded_mutex_);
+        if (!predecoded_textures_.try_emplace(path).second) {
+            return;
+        }
+    }
+
+    {
+        const std::lock_guard lock(textures_.GetMutex());
+        if (textures_.contains(path)) {
+            return;
+        }
+    }
+
+    PredecodedTexture texture{
+        .flip_texture = flip_texture == -1 ? texture_flip_.load() : flip_texture,
+    };
+
+    /* stb flag is global, the thread one does not race with the loads on the render thread */
+    stbi_set_flip_vertically_on_load_thread(texture.flip_texture);
+
+    unsigned char *data = stbi_load(path.c_str(), &texture.width, &texture.height, &texture.channels, 0);
+    if (!data) {
+        /* reported by the regular load */
+        return;
+    }
+
+    texture.pixels.assign(
+        data, data + static_cast<size_t>(texture.width) * static_cast<size_t>(texture.height) *
+                         static_cast<size_t>(texture.channels)
+    );
+    stbi_image_free(data);
+
+    texture.allocation = MemoryTracker::Allocation(MemoryTracker::Category::kStreaming, texture.pixels.size(), path);
+
+    const std::lock_guard lock(predecoded_mutex_);
+    predecoded_textures_[path] = std::move(texture);
+}
+
+void LibGcp::ResourceMgrBase::ClearPredecodedTextures()
+{
+    const std::lock_guard lock(predecoded_mutex_);
+    predecoded_textures_.clear();
+}
+
+LibGcp::ResourceMgrBase::DedupStats LibGcp::ResourceMgrBase::GetDedupStats()
+{
+    const std::lock_guard lock(flyweight_mutex_);
+    return dedup_stats_;
+}
+
+void LibGcp::ResourceMgrBase::EnforceMemoryBudget()
+{
+    const size_t budget = GetMemoryBudget_();
+
+    if (budget == 0 || GetVramBytes_() <= budget) {
+        return;
+    }
+
+    const std::scoped_lock lock(models_.GetMutex(), textures_.GetMutex());
+
+    /**
+     * Evicting a model may release its textures, so candidates are searched again after every eviction.
+     * Storages shared with resources still in use stay allocated and do not lower the usage.
+     */
+    while (GetVramBytes_() > budget && EvictLeastRecentlyUsedUnlocked_()) {
+    }
+
+    TRACE("VRAM usage after eviction: " << GetVramBytes_() / kBytesInMb << " MiB of " << budget / kBytesInMb << " MiB");
+}
+
+LibGcp::ResourceMgrBase::MemoryStats LibGcp::ResourceMgrBase::GetMemoryStats() const
+{
+    return {
+        .vram_bytes        = GetVramBytes_(),
+        .ram_bytes         = MemoryTracker::GetPoolBytes(MemoryTracker::Pool::kRam),
+        .budget_bytes      = GetMemoryBudget_(),
+        .evicted_resources = evicted_count_,
+    };
+}
+
+std::vector<LibGcp::ResourceSpec> LibGcp::ResourceMgrBase::GetEvictedSceneResources()
+{
+    const std::scoped_lock lock(models_.GetMutex(), textures_.GetMutex());
+
+    std::vector<ResourceSpec> resources{};
+    for (const auto *evicted : {&evicted_models_, &evicted_textures_}) {
+        for (const auto &[name, spec] : *evicted) {
+            if (spec.is_serializable) {
+                resources.push_back(spec);
+            }
+        }
+    }
+
+    return resources;
+}
+
+void LibGcp::ResourceMgrBase::ProcessHotReloads()
+{
+    if constexpr (!kUseHotReload) {
+        return;
+    }
+
+    std::vector<PendingReload> reloads{};
+    {
+        const std::lock_guard lock(hot_reload_mutex_);
+        reloads.swap(pending_reloads_);
+    }
+
+    for (const auto &reload : reloads) {
+        switch (reload.type) {
+            case ResourceType::kTexture:
+                ReloadTexture_(reload);
+                break;
+            case ResourceType::kShader:
+                ReloadShader_(reload);
+                break;
+            case ResourceType::kModel:
+                ReloadModel_(reload);
+                break;
+            default:
+                R_ASSERT(false);
+        }
+    }
+}
+
 LibGcp::Rc LibGcp::ResourceMgrBase::LoadTextureUnlocked_(const ResourceSpec &resource)
 {
+    const MemoryTracker::OwnerScope owner_scope(resource.paths[0]);
+
     switch (resource.load_type) {
         case LoadType::kExternal:
             return LoadTextureFromExternal_(resource);
@@ -191,6 +746,8 @@ LibGcp::Rc LibGcp::ResourceMgrBase::LoadTextureUnlocked_(const ResourceSpec &res
 
 LibGcp::Rc LibGcp::ResourceMgrBase::LoadShaderUnlocked_(const ResourceSpec &resource)
 {
+    const MemoryTracker::OwnerScope owner_scope(resource.paths[0] + "//" + resource.paths[1]);
+
     switch (resource.load_type) {
         case LoadType::kExternal:
             return LoadShaderFromExternal_(resource);
@@ -208,9 +765,9 @@ LibGcp::Rc LibGcp::ResourceMgrBase::LoadModelUnlocked_(const ResourceSpec &resou
     switch (resource.load_type) {
         case LoadType::kExternal:
             return LoadModelFromExternal_(resource);
-        case LoadType::kMemory:
-            [[fallthrough]];
         case LoadType::kInternal:
+            return LoadModelFromInternal_(resource);
+        case LoadType::kMemory:
             NOT_IMPLEMENTED;
         default:
             R_ASSERT(false);
@@ -219,43 +776,106 @@ LibGcp::Rc LibGcp::ResourceMgrBase::LoadModelUnlocked_(const ResourceSpec &resou
 
 LibGcp::Rc LibGcp::ResourceMgrBase::LoadTextureFromExternal_(const ResourceSpec &resource)
 {
-    int width{};
-    int height{};
-    int channels{};
-
     const std::string &texture_name = resource.paths[0];
+    SetTextureFlip(resource.flip_texture);
 
-    if (resource.flip_texture != -1) {
-        stbi_set_flip_vertically_on_load(resource.flip_texture);
-    }
-
-    unsigned char *data = stbi_load(texture_name.c_str(), &width, &height, &channels, 0);
-    if (!data) {
+    const auto texture = LoadSharedTexture_(texture_name);
+    if (!texture) {
         TRACE("Failed to load texture: " + texture_name);
         return Rc::kFailedToLoad;
     }
 
-    const auto texture = std::make_shared<Texture>(data, width, height, channels, Texture::Type::kLast);
-    stbi_image_free(data);
-
     assert(!textures_.contains(texture_name));
     textures_[texture_name] = texture;
-    textures_.GetListeners().NotifyListeners<CxxUtils::ContainerEvents::kAdd>(&texture_name);
     texture->SaveSpec(resource);
+    textures_.GetListeners().NotifyListeners<CxxUtils::ContainerEvents::kAdd>(&texture_name);
 
     return Rc::kSuccess;
 }
 
-std::shared_ptr<LibGcp::Texture> LibGcp::ResourceMgrBase::LoadTextureFromMemory_(
-    const unsigned char *data, const int len
-)
+std::shared_ptr<LibGcp::Texture> LibGcp::ResourceMgrBase::LoadSharedTexture_(const std::string &path)
 {
-    int width;
-    int height;
-    int channels;
+    std::optional<Hash128> key{};
+    if (shared_asset_cache_) {
+        if (const auto identity = HashFileIdentity(path, kSharedTextureHashSeed)) {
+            ContentHasher hasher(kSharedTextureHashSeed);
+            hasher.Update(*identity);
+            hasher.Update(texture_flip_.load());
+            key = hasher.Finalize();
+        }
+    }
 
-    unsigned char *imageData = stbi_load_from_memory(data, len, &width, &height, &channels, 0);
-    auto texture             = std::make_shared<Texture>(imageData, width, height, channels, Texture::Type::kLast);
+    if (key) {
+        const auto payload = shared_asset_cache_->Find(*key);
+
+        if (payload.size() >= sizeof(SharedTextureHeader)) {
+            SharedTextureHeader header{};
+            std::memcpy(&header, payload.data(), sizeof(SharedTextureHeader));
+
+            /* pixels are uploaded straight from the shared pages */
+            if (IsSharedTextureValid(payload, header)) {
+                const auto *pixels =
+                    reinterpret_cast<const unsigned char *>(payload.data() + sizeof(SharedTextureHeader));
+                return CreateTexture_(pixels, header.width, header.height, header.channels);
+            }
+
+            TRACE("Broken shared asset cache entry of texture: " << path << ", decoding the file");
+        }
+    }
+
+    int width{};
+    int height{};
+    int channels{};
+
+    unsigned char *data{};
+    PredecodedTexture predecoded{};
+
+    if (TakePredecodedTexture_(path, predecoded)) {
+        width    = predecoded.width;
+        height   = predecoded.height;
+        channels = predecoded.channels;
+        data     = predecoded.pixels.data();
+    } else {
+        data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+    }
+
+    if (!data) {
+        return nullptr;
+    }
+
+    if (key) {
+        const SharedTextureHeader header{
+            .width    = width,
+            .height   = height,
+            .channels = channels,
+            .reserved = 0,
+        };
+        const size_t pixels_size =
+            static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(channels);
+
+        shared_asset_cache_->Store(
+            *key, {std::as_bytes(std::span(&header, 1)), std::as_bytes(std::span(data, pixels_size))}
+        );
+    }
+
+    auto texture = CreateTexture_(data, width, height, channels);
+    if (predecoded.pixels.empty()) {
+        stbi_image_free(data);
+    }
+
+    return texture;
+}
+
+std::shared_ptr<LibGcp::Texture> LibGcp::ResourceMgrBase::LoadTextureFromMemory_(
+    const unsigned char *data, const int len
+)
+{
+    int width;
+    int height;
+    int channels;
+
+    unsigned char *imageData = stbi_load_from_memory(data, len, &width, &height, &channels, 0);
+    auto texture             = CreateTexture_(imageData, width, height, channels);
     stbi_image_free(imageData);
 
     return texture;
@@ -270,14 +890,14 @@ LibGcp::Rc LibGcp::ResourceMgrBase::LoadShaderFromMemory_(const ResourceSpec &re
     R_ASSERT(StaticShaders::g_KnownVertexShaders.contains(vert));
 
     const auto shader = std::make_shared<Shader>(
-        StaticShaders::g_KnownVertexShaders[vert], StaticShaders::g_KnownFragmentShaders[frag]
+        StaticShaders::g_KnownVertexShaders[vert], StaticShaders::g_KnownFragmentShaders[frag], program_cache_.get()
     );
 
     const auto full_name = vert + "//" + frag;
     assert(!shaders_.contains(full_name));
     shaders_[full_name] = shader;
-    shaders_.GetListeners().NotifyListeners<CxxUtils::ContainerEvents::kAdd>(&full_name);
     shader->SaveSpec(resource);
+    shaders_.GetListeners().NotifyListeners<CxxUtils::ContainerEvents::kAdd>(&full_name);
 
     return Rc::kSuccess;
 }
@@ -328,13 +948,15 @@ LibGcp::Rc LibGcp::ResourceMgrBase::LoadShaderFromExternal_(const ResourceSpec &
     vertex_shader_code   = vertex_shader_stream.str();
     fragment_shader_code = fragment_shader_stream.str();
 
-    const auto shader = std::make_shared<Shader>(vertex_shader_code.c_str(), fragment_shader_code.c_str());
+    const auto shader = std::make_shared<Shader>(
+        vertex_shader_code.c_str(), fragment_shader_code.c_str(), program_cache_.get()
+    );
 
     const auto full_name = vert + "//" + frag;
     assert(!shaders_.contains(full_name));
     shaders_[full_name] = shader;
-    shaders_.GetListeners().NotifyListeners<CxxUtils::ContainerEvents::kAdd>(&full_name);
     shader->SaveSpec(resource);
+    shaders_.GetListeners().NotifyListeners<CxxUtils::ContainerEvents::kAdd>(&full_name);
 
     return Rc::kSuccess;
 }
@@ -343,12 +965,29 @@ LibGcp::Rc LibGcp::ResourceMgrBase::LoadModelFromExternal_(const ResourceSpec &r
 {
     const std::string &model_name = resource.paths[0];
     ModelSerializer serializer{};
+    SetTextureFlip(resource.flip_texture);
+
+    const auto model = serializer.LoadModelFromExternalFormat(model_name);
 
-    if (resource.flip_texture != -1) {
-        stbi_set_flip_vertically_on_load(resource.flip_texture);
+    if (!model) {
+        TRACE("Failed to load model: " + model_name);
+        return Rc::kFailedToLoad;
     }
 
-    const auto model = serializer.LoadModelFromExternalFormat(model_name);
+    assert(!models_.contains(model_name));
+    models_[model_name] = model;
+    model->SaveSpec(resource);
+    models_.GetListeners().NotifyListeners<CxxUtils::ContainerEvents::kAdd>(&model_name);
+
+    return Rc::kSuccess;
+}
+
+LibGcp::Rc LibGcp::ResourceMgrBase::LoadModelFromInternal_(const ResourceSpec &resource)
+{
+    const std::string &model_name = resource.paths[0];
+    ModelSerializer serializer{};
+
+    const auto model = serializer.LoadModelFromInternalFormat(model_name);
 
     if (!model) {
         TRACE("Failed to load model: " + model_name);
@@ -357,8 +996,556 @@ LibGcp::Rc LibGcp::ResourceMgrBase::LoadModelFromExternal_(const ResourceSpec &r
 
     assert(!models_.contains(model_name));
     models_[model_name] = model;
+    model->SaveSpec(resource);
     models_.GetListeners().NotifyListeners<CxxUtils::ContainerEvents::kAdd>(&model_name);
+
+    return Rc::kSuccess;
+}
+
+LibGcp::Rc LibGcp::ResourceMgrBase::LoadModelPlaceholderUnlocked_(const ResourceSpec &resource)
+{
+    const std::string &model_name = resource.paths[0];
+    const auto bounds             = bounds_cache_->Load(model_name);
+
+    ModelSerializer serializer{};
+    const auto model = serializer.CreatePlaceholderModel(bounds ? &*bounds : nullptr);
+
+    assert(!models_.contains(model_name));
+    models_[model_name] = model;
     model->SaveSpec(resource);
+    models_.GetListeners().NotifyListeners<CxxUtils::ContainerEvents::kAdd>(&model_name);
+
+    /* placeholder without bounds cannot be culled, so the model is imported right away */
+    if (!bounds) {
+        RequestModelLoadUnlocked_(model_name);
+    }
 
     return Rc::kSuccess;
 }
+
+void LibGcp::ResourceMgrBase::RequestModelLoadUnlocked_(const std::string &model_name)
+{
+    /* broken files keep their placeholders, they are not imported again every frame */
+    if (!failed_models_.contains(model_name) && requested_models_.insert(model_name).second) {
+        model_importer_->Request(model_name);
+    }
+}
+
+std::shared_ptr<LibGcp::Texture> LibGcp::ResourceMgrBase::CreateTexture_(
+    const unsigned char *data, const int width, const int height, const int channels
+)
+{
+    return std::make_shared<Texture>(GetTextureStorage_(data, width, height, channels), Texture::Type::kLast);
+}
+
+std::shared_ptr<LibGcp::TextureStorage> LibGcp::ResourceMgrBase::GetTextureStorage_(
+    const unsigned char *data, const int width, const int height, const int channels
+)
+{
+    const Hash128 hash = HashTexture(data, width, height, channels);
+
+    const std::lock_guard lock(flyweight_mutex_);
+    if (const auto it = texture_storages_.find(hash); it != texture_storages_.end()) {
+        if (auto storage = it->second.lock()) {
+            TRACE("Reusing texture storage of size " << width << "x" << height);
+
+            ++dedup_stats_.shared_textures;
+            dedup_stats_.bytes_saved += storage->GetSizeBytes();
+            return storage;
+        }
+    }
+
+    auto storage = CreateTextureStorage_(data, width, height, channels, hash);
+    InsertFlyweight(texture_storages_, hash, storage, texture_sweep_size_);
+
+    return storage;
+}
+
+std::shared_ptr<LibGcp::TextureStorage> LibGcp::ResourceMgrBase::CreateTextureStorage_(
+    const unsigned char *data, const int width, const int height, const int channels, const Hash128 &hash
+)
+{
+    const bool is_streamed = SettingsMgr::GetInstance().GetSetting<Setting::kTextureStreaming, bool>() &&
+                             std::max(width, height) > TextureStorage::kResidentTailSize;
+
+    if (!is_streamed) {
+        return std::make_shared<TextureStorage>(data, width, height, channels);
+    }
+
+    /* mip files are content addressed, identical payloads share one file */
+    return std::make_shared<TextureStorage>(
+        data, width, height, channels, GetCachePath(kMipCacheDir) + "/" + ToHexString(hash) + ".mip"
+    );
+}
+
+void LibGcp::ResourceMgrBase::AdoptModel(const ResourceSpec &resource, const std::shared_ptr<Model> &model)
+{
+    assert(resource.type == ResourceType::kModel);
+
+    const std::lock_guard lock(models_.GetMutex());
+    const std::string &model_name = resource.paths[0];
+
+    if (models_.contains(model_name)) {
+        return;
+    }
+
+    models_[model_name] = model;
+    model->SaveSpec(resource);
+    models_.GetListeners().NotifyListeners<CxxUtils::ContainerEvents::kAdd>(&model_name);
+    evicted_models_.erase(model_name);
+}
+
+void LibGcp::ResourceMgrBase::RequestModelLoad(const Model &model)
+{
+    if (!model.IsPlaceholder()) {
+        return;
+    }
+
+    const std::lock_guard lock(models_.GetMutex());
+    RequestModelLoadUnlocked_(model.paths[0]);
+}
+
+void LibGcp::ResourceMgrBase::ProcessLazyModels()
+{
+    for (auto &[path, importer, blob] : model_importer_->TakeImported(kMaxLazyModelsPerFrame)) {
+        const std::lock_guard lock(models_.GetMutex());
+
+        /* reloads are requested only for loaded models, every other import resolves a placeholder */
+        const auto reload    = reloading_models_.find(path);
+        const bool is_reload = reload != reloading_models_.end();
+
+        if (is_reload && --reload->second == 0) {
+            reloading_models_.erase(reload);
+        } else if (!is_reload) {
+            requested_models_.erase(path);
+        }
+
+        if (!importer && blob.empty()) {
+            if (is_reload) {
+                TRACE("Failed to hot reload model: " + path + ", keeping previous version");
+            } else {
+                failed_models_.insert(path);
+            }
+            continue;
+        }
+
+        /* model might be released or loaded synchronously in the meantime */
+        const auto it = models_.find(path);
+        if (it == models_.end() || it->second->IsPlaceholder() == is_reload) {
+            continue;
+        }
+
+        SetTextureFlip(it->second->flip_texture);
+
+        ModelSerializer serializer{};
+        const auto model =
+            importer ? serializer.BuildModelFromImport(*importer, path) : serializer.LoadModelFromBlob(blob, path);
+
+        if (!model) {
+            if (is_reload) {
+                TRACE("Failed to hot reload model: " + path + ", keeping previous version");
+            } else {
+                failed_models_.insert(path);
+            }
+            continue;
+        }
+
+        /* objects and lights keep referring to the placeholder instance */
+        it->second->SwapMeshes(*model);
+        bounds_cache_->Store(path, it->second->GetBoundingBox());
+
+        if (is_reload) {
+            failed_models_.erase(path);
+            TRACE("Hot reloaded model: " + path);
+        } else {
+            ++resolved_models_;
+            TRACE("Lazily loaded model: " + path);
+        }
+    }
+}
+
+LibGcp::ResourceMgrBase::LazyModelStats LibGcp::ResourceMgrBase::GetLazyModelStats()
+{
+    const std::lock_guard lock(models_.GetMutex());
+
+    return {
+        .placeholders = static_cast<size_t>(std::ranges::count_if(
+            models_,
+            [](const auto &entry) {
+                return entry.second->IsPlaceholder();
+            }
+        )),
+        .pending_imports = model_importer_->GetPendingCount(),
+        .resolved_models = resolved_models_,
+        .failed_models   = failed_models_.size(),
+    };
+}
+
+template <class T>
+void LibGcp::ResourceMgrBase::TrackUsage_(
+    CxxUtils::ExtendedMap<std::string, std::shared_ptr<T>> &map, std::unordered_map<std::string, ResourceUsage> &usage
+)
+{
+    /* listeners are invoked by the loaders with the map mutex already taken */
+    map.GetListeners().template AddListener<CxxUtils::ContainerEvents::kAdd>([this, &usage](const std::string *name) {
+        usage[*name] = {.last_use = use_clock_.fetch_add(1)};
+    });
+
+    map.GetListeners().template AddListener<CxxUtils::ContainerEvents::kRemove>([&usage](const std::string *name) {
+        usage.erase(*name);
+    });
+
+    map.GetListeners().template AddListener<CxxUtils::ContainerEvents::kClear>([&usage](const std::string *) {
+        usage.clear();
+    });
+}
+
+template <class T>
+bool LibGcp::ResourceMgrBase::IsEvictable_(const std::shared_ptr<T> &resource)
+{
+    /* only the manager holds the resource and it can be loaded again from its path */
+    if (resource.use_count() != 1 || resource->load_type != LoadType::kExternal) {
+        return false;
+    }
+
+    /* lights are edited in place, reloading would lose them */
+    if constexpr (std::is_same_v<T, Model>) {
+        return resource->GetLights().IsEmpty();
+    }
+
+    return true;
+}
+
+template <class T>
+void LibGcp::ResourceMgrBase::EvictUnlocked_(
+    CxxUtils::ExtendedMap<std::string, std::shared_ptr<T>> &map,
+    std::unordered_map<std::string, ResourceSpec> &evicted, const std::string &name, const ResourceType type
+)
+{
+    const auto &resource = map.at(name);
+
+    evicted[name] = {
+        .paths           = {name, ""},
+        .type            = type,
+        .load_type       = resource->load_type,
+        .flip_texture    = resource->flip_texture,
+        .is_serializable = resource->is_serializable,
+    };
+
+    TRACE("Evicting resource: " << name);
+
+    map.GetListeners().template NotifyListeners<CxxUtils::ContainerEvents::kRemove>(&name);
+    map.erase(name);
+    ++evicted_count_;
+}
+
+bool LibGcp::ResourceMgrBase::EvictLeastRecentlyUsedUnlocked_()
+{
+    std::string victim{};
+    bool is_model{};
+    uint64_t oldest = std::numeric_limits<uint64_t>::max();
+
+    for (const auto &[name, model] : models_) {
+        if (IsEvictable_(model) && model_usage_.at(name).last_use < oldest) {
+            oldest   = model_usage_.at(name).last_use;
+            victim   = name;
+            is_model = true;
+        }
+    }
+
+    for (const auto &[name, texture] : textures_) {
+        if (IsEvictable_(texture) && texture_usage_.at(name).last_use < oldest) {
+            oldest   = texture_usage_.at(name).last_use;
+            victim   = name;
+            is_model = false;
+        }
+    }
+
+    if (oldest == std::numeric_limits<uint64_t>::max()) {
+        return false;
+    }
+
+    if (is_model) {
+        EvictUnlocked_(models_, evicted_models_, victim, ResourceType::kModel);
+    } else {
+        EvictUnlocked_(textures_, evicted_textures_, victim, ResourceType::kTexture);
+    }
+
+    return true;
+}
+
+bool LibGcp::ResourceMgrBase::EvictShaderVariantUnlocked_()
+{
+    auto victim     = shader_variants_.end();
+    uint64_t oldest = std::numeric_limits<uint64_t>::max();
+
+    for (auto it = shader_variants_.begin(); it != shader_variants_.end(); ++it) {
+        auto &variant = it->second;
+
+        const bool is_compiling = !variant.shader->IsReady() && !variant.shader->IsFailed();
+        if (!is_compiling && variant.last_use < oldest) {
+            oldest = variant.last_use;
+            victim = it;
+        }
+    }
+
+    if (victim == shader_variants_.end()) {
+        return false;
+    }
+
+    TRACE("Shader variant cap reached, evicting: " << victim->first);
+    shader_variants_.erase(victim);
+
+    return true;
+}
+
+template <class T>
+void LibGcp::ResourceMgrBase::ReleaseUnlocked_(
+    CxxUtils::ExtendedMap<std::string, std::shared_ptr<T>> &map, const std::vector<std::string> &names
+)
+{
+    for (const auto &name : names) {
+        TRACE("Releasing resource: " << name);
+
+        map.GetListeners().template NotifyListeners<CxxUtils::ContainerEvents::kRemove>(&name);
+        map.erase(name);
+    }
+}
+
+template <class T>
+size_t LibGcp::ResourceMgrBase::ReleaseUnwantedUnlocked_(
+    CxxUtils::ExtendedMap<std::string, std::shared_ptr<T>> &map,
+    const std::unordered_map<std::string, const ResourceSpec *> &wanted
+)
+{
+    std::vector<std::string> unwanted{};
+
+    for (const auto &[name, resource] : map) {
+        if (!resource->is_serializable) {
+            /* owned by the engine or by other resources */
+            continue;
+        }
+
+        const auto it = wanted.find(name);
+        if (it == wanted.end()) {
+            unwanted.push_back(name);
+            continue;
+        }
+
+        /* resource loaded differently must be loaded again */
+        const ResourceSpec *spec = it->second;
+        if (spec != nullptr &&
+            (spec->load_type != resource->load_type || spec->flip_texture != resource->flip_texture)) {
+            unwanted.push_back(name);
+        }
+    }
+
+    ReleaseUnlocked_(map, unwanted);
+    return unwanted.size();
+}
+
+template <class T>
+size_t LibGcp::ResourceMgrBase::ReleaseOrphanedUnlocked_(CxxUtils::ExtendedMap<std::string, std::shared_ptr<T>> &map)
+{
+    std::vector<std::string> orphaned{};
+
+    for (const auto &[name, resource] : map) {
+        if (!resource->is_serializable && resource.use_count() == 1) {
+            orphaned.push_back(name);
+        }
+    }
+
+    ReleaseUnlocked_(map, orphaned);
+    return orphaned.size();
+}
+
+size_t LibGcp::ResourceMgrBase::GetMemoryBudget_()
+{
+    return SettingsMgr::GetInstance().GetSetting<Setting::kGpuMemoryBudgetMb, uint64_t>() * kBytesInMb;
+}
+
+void LibGcp::ResourceMgrBase::OnMemoryBudgetChanged_(UNUSED uint64_t new_value)
+{
+    ResourceMgr::GetInstance().EnforceMemoryBudget();
+}
+
+void LibGcp::ResourceMgrBase::InitHotReload_()
+{
+    file_watcher_ = std::make_unique<FileWatcher>([this](const std::string &path) {
+        OnFileChanged_(path);
+    });
+
+    /* loaders notify with the map mutex taken and spec already saved */
+    textures_.GetListeners().AddListener<CxxUtils::ContainerEvents::kAdd>([this](const std::string *name) {
+        WatchResource_(ResourceType::kTexture, *name, *textures_.at(*name));
+    });
+    shaders_.GetListeners().AddListener<CxxUtils::ContainerEvents::kAdd>([this](const std::string *name) {
+        WatchResource_(ResourceType::kShader, *name, *shaders_.at(*name));
+    });
+    models_.GetListeners().AddListener<CxxUtils::ContainerEvents::kAdd>([this](const std::string *name) {
+        WatchResource_(ResourceType::kModel, *name, *models_.at(*name));
+    });
+
+    file_watcher_->Start();
+}
+
+void LibGcp::ResourceMgrBase::WatchResource_(
+    const ResourceType type, const std::string &name, const Resource &resource
+)
+{
+    if (resource.load_type != LoadType::kExternal) {
+        return;
+    }
+
+    for (const auto &path : resource.paths) {
+        if (path.empty()) {
+            continue;
+        }
+
+        {
+            const std::lock_guard lock(hot_reload_mutex_);
+            auto &watched = watched_resources_[FileWatcher::NormalizePath(path)];
+
+            /* resource may be loaded again after eviction */
+            const bool is_watched = std::ranges::any_of(watched, [&](const WatchedResource &entry) {
+                return entry.type == type && entry.name == name;
+            });
+
+            if (!is_watched) {
+                watched.push_back({.type = type, .name = name, .flip_texture = resource.flip_texture});
+            }
+        }
+
+        file_watcher_->Watch(path);
+    }
+}
+
+void LibGcp::ResourceMgrBase::OnFileChanged_(const std::string &path)
+{
+    std::vector<WatchedResource> resources{};
+    {
+        const std::lock_guard lock(hot_reload_mutex_);
+
+        const auto it = watched_resources_.find(path);
+        if (it == watched_resources_.end()) {
+            return;
+        }
+
+        resources = it->second;
+    }
+
+    for (const auto &resource : resources) {
+        PendingReload reload{
+            .type = resource.type,
+            .name = resource.name,
+        };
+
+        switch (resource.type) {
+            case ResourceType::kTexture: {
+                if (resource.flip_texture != -1) {
+                    stbi_set_flip_vertically_on_load_thread(resource.flip_texture);
+                }
+
+                unsigned char *data = stbi_load(path.c_str(), &reload.width, &reload.height, &reload.channels, 0);
+                if (!data) {
+                    TRACE("Failed to decode changed texture: " + path);
+                    continue;
+                }
+
+                reload.pixels.assign(
+                    data, data + static_cast<size_t>(reload.width) * static_cast<size_t>(reload.height) *
+                                     static_cast<size_t>(reload.channels)
+                );
+                stbi_image_free(data);
+            } break;
+            case ResourceType::kShader: {
+                const size_t pos = resource.name.find("//");
+
+                if (!ReadWholeFile(resource.name.substr(0, pos), reload.vertex_code) ||
+                    !ReadWholeFile(resource.name.substr(pos + 2), reload.fragment_code)) {
+                    TRACE("Failed to read changed shader: " + resource.name);
+                    continue;
+                }
+            } break;
+            case ResourceType::kModel:
+                /* model import is requested from the render thread, meshes creating GL objects are swapped there */
+                break;
+            default:
+                R_ASSERT(false);
+        }
+
+        const std::lock_guard lock(hot_reload_mutex_);
+
+        /* keep only the latest change of the resource */
+        std::erase_if(pending_reloads_, [&](const PendingReload &pending) {
+            return pending.type == reload.type && pending.name == reload.name;
+        });
+        pending_reloads_.push_back(std::move(reload));
+    }
+}
+
+void LibGcp::ResourceMgrBase::ReloadTexture_(const PendingReload &reload)
+{
+    const std::lock_guard lock(textures_.GetMutex());
+
+    const auto it = textures_.find(reload.name);
+    if (it == textures_.end()) {
+        /* removed or evicted in the meantime */
+        return;
+    }
+
+    const MemoryTracker::OwnerScope owner_scope(reload.name);
+    const auto old_storage = it->second->GetStorage();
+    const auto storage     = GetTextureStorage_(reload.pixels.data(), reload.width, reload.height, reload.channels);
+
+    /**
+     * Storage is shared by every texture of identical content. Textures of the same file, e.g. referenced by the
+     * relative and the canonical path, are moved to the new storage, those of other files keep their pixels.
+     */
+    const std::string source = FileWatcher::NormalizePath(reload.name);
+    for (auto &[name, texture] : textures_) {
+        if (texture->GetStorage() == old_storage && FileWatcher::NormalizePath(name) == source) {
+            texture->SwapStorage(storage);
+        }
+    }
+
+    TRACE("Hot reloaded texture: " + reload.name);
+}
+
+void LibGcp::ResourceMgrBase::ReloadShader_(const PendingReload &reload)
+{
+    const std::lock_guard lock(shaders_.GetMutex());
+
+    const auto it = shaders_.find(reload.name);
+    if (it == shaders_.end()) {
+        return;
+    }
+
+    if (const Rc rc = it->second->Recompile(reload.vertex_code.c_str(), reload.fragment_code.c_str());
+        IsFailure(rc)) {
+        TRACE("Failed to hot reload shader: " + reload.name + ", keeping previous program");
+        return;
+    }
+
+    TRACE("Hot reloaded shader: " + reload.name);
+}
+
+void LibGcp::ResourceMgrBase::ReloadModel_(const PendingReload &reload)
+{
+    const std::lock_guard lock(models_.GetMutex());
+
+    const auto it = models_.find(reload.name);
+    if (it == models_.end()) {
+        return;
+    }
+
+    /* placeholder imports the current file once it passes culling, a broken one gets another chance */
+    if (it->second->IsPlaceholder()) {
+        failed_models_.erase(reload.name);
+        return;
+    }
+
+    /* import runs in the background, meshes are swapped by ProcessLazyModels without stalling the frame */
+    ++reloading_models_[reload.name];
+    model_importer_->Request(reload.name);
+}
@@ -7,14 +7,26 @@
 #include <libcgp/primitives/shader.hpp>
 #include <libcgp/primitives/texture.hpp>
 #include <libcgp/rc.hpp>
+#include <libcgp/utils/file_watcher.hpp>
+#include <libcgp/utils/hash.hpp>
+#include <libcgp/utils/memory_tracker.hpp>
+#include <libcgp/utils/model_bounds_cache.hpp>
+#include <libcgp/utils/model_importer.hpp>
+#include <libcgp/utils/program_cache.hpp>
+#include <libcgp/utils/shared_asset_cache.hpp>
 
 #include <CxxUtils/data_types/extended_map.hpp>
 #include <CxxUtils/static_singleton.hpp>
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 LIBGCP_DECL_START_
 /**
@@ -26,13 +38,93 @@ LIBGCP_DECL_START_
 
 /**
  * TODO:
- * - flyweight pattern for meshes
- * - memory usage optimization
- * - implement multi-threaded async loading
+ * - implement multi-threaded async loading of textures and shaders
  */
 class ResourceMgrBase final : public CxxUtils::StaticSingletonHelper
 {
-    static constexpr size_t kDefaultMapSize = 16384;
+    static constexpr size_t kDefaultMapSize        = 16384;
+    static constexpr size_t kMaxShaderVariants     = 64;
+    static constexpr size_t kMaxLazyModelsPerFrame = 1;
+
+#ifdef USE_HOT_RELOAD_
+    static constexpr bool kUseHotReload = true;
+#else
+    static constexpr bool kUseHotReload = false;
+#endif
+
+#ifdef USE_SHARED_ASSET_CACHE_
+    static constexpr bool kUseSharedAssetCache = true;
+#else
+    static constexpr bool kUseSharedAssetCache = false;
+#endif
+
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    struct DedupStats {
+        size_t shared_textures;
+        size_t shared_meshes;
+        size_t bytes_saved;
+    };
+
+    struct MemoryStats {
+        size_t vram_bytes;
+        size_t ram_bytes;
+        size_t budget_bytes;
+        size_t evicted_resources;
+    };
+
+    struct LazyModelStats {
+        size_t placeholders;
+        size_t pending_imports;
+        size_t resolved_models;
+        size_t failed_models;
+    };
+
+    /* memory itself is accounted by the MemoryTracker, shared storages are counted once */
+    struct ResourceUsage {
+        uint64_t last_use;
+    };
+
+    /* least recently used variant is replaced once the cap is reached */
+    struct ShaderVariant {
+        std::shared_ptr<Shader> shader;
+        uint64_t last_use;
+    };
+
+    struct WatchedResource {
+        ResourceType type;
+        std::string name;
+        int8_t flip_texture;
+    };
+
+    /* CPU side of the reload is prepared on the watcher thread, GPU side is done on the render thread */
+    struct PendingReload {
+        ResourceType type;
+        std::string name;
+
+        /* texture payload */
+        std::vector<unsigned char> pixels;
+        int width;
+        int height;
+        int channels;
+
+        /* shader payload */
+        std::string vertex_code;
+        std::string fragment_code;
+    };
+
+    /* Pixels decoded ahead of the GL context, taken by the first load of the file with the same flip */
+    struct PredecodedTexture {
+        int8_t flip_texture;
+        std::vector<unsigned char> pixels;
+        int width;
+        int height;
+        int channels;
+        MemoryTracker::Allocation allocation;
+    };
 
     // ------------------------------
     // Object creation
@@ -42,12 +134,24 @@ class ResourceMgrBase final : public CxxUtils::StaticSingletonHelper
     ResourceMgrBase();
     ~ResourceMgrBase() override;
 
+    /* Creates parts requiring GL context, the rest of the manager may be used before the window is initialized */
+    void InitContext();
+
+    /* Maps the cache shared between the engine processes, must be called before any texture is loaded */
+    void OpenSharedAssetCache();
+
     // ------------------------------
     // Class interaction
     // ------------------------------
 
     void LoadResourceFromScene(const Scene &scene);
 
+    /* Releases scene resources missing from the new scene or requested with a different spec, loads only new ones */
+    void ReconcileResourcesWithScene(const Scene &scene);
+
+    /* Releases non-scene resources, e.g. model textures, which are no longer referenced outside the manager */
+    void ReleaseOrphanedResources();
+
     std::shared_ptr<Texture> GetTexture(const ResourceSpec &resource);
     std::shared_ptr<Shader> GetShader(const ResourceSpec &resource);
     std::shared_ptr<Model> GetModel(const ResourceSpec &resource);
@@ -56,8 +160,64 @@ class ResourceMgrBase final : public CxxUtils::StaticSingletonHelper
     std::shared_ptr<Shader> GetShader(const std::string &shader_name, LoadType load_type);
     std::shared_ptr<Model> GetModel(const std::string &model_name, LoadType load_type);
 
+    /**
+     * Returns variant of the memory shader compiled with given defines, nullptr until background compilation ends.
+     * Once kMaxShaderVariants exist the least recently used finished variant is evicted, holders keep their copy.
+     */
+    std::shared_ptr<Shader> GetShaderVariant(const std::string &shader_name, const shader_defines_t &defines);
+
     std::shared_ptr<Texture> GetTextureExternalSourceRaw(const std::string &path, const TextureSpec &spec);
 
+    /* Returns GPU buffers shared with every already loaded mesh of identical content */
+    std::shared_ptr<MeshGeometry> GetMeshGeometry(std::vector<Vertex> &&vertices, std::vector<GLuint> &&indices);
+
+    /* Views must outlive the geometry, used for the geometry mapped from the shared asset cache */
+    std::shared_ptr<MeshGeometry> GetMeshGeometry(std::span<const Vertex> vertices, std::span<const GLuint> indices);
+
+    /* Decodes MeshCodec stream straight into the GPU buffers, returns nullptr for the malformed one */
+    std::shared_ptr<MeshGeometry> GetMeshGeometry(std::span<const std::byte> encoded);
+
+    /* Sets vertical flip of the textures loaded from files, -1 keeps the current one */
+    void SetTextureFlip(int8_t flip_texture);
+
+    /* Decodes the file ahead of its load without touching GL, thread safe, -1 assumes the current flip */
+    void PredecodeTexture(const std::string &path, int8_t flip_texture);
+
+    /* Drops pixels decoded ahead but never loaded */
+    void ClearPredecodedTextures();
+
+    NDSCRD DedupStats GetDedupStats();
+
+    /* Evicts least recently used resources held only by the manager until VRAM usage fits the budget */
+    void EnforceMemoryBudget();
+
+    NDSCRD MemoryStats GetMemoryStats() const;
+
+    /* Specs of the scene resources evicted to fit the budget, they are still part of the scene */
+    NDSCRD std::vector<ResourceSpec> GetEvictedSceneResources();
+
+    /* Applies reloads of changed files, must be called from the thread owning GL context */
+    void ProcessHotReloads();
+
+    /* Registers model created outside the manager, e.g. staged by the scene preloader, already loaded one is kept */
+    void AdoptModel(const ResourceSpec &resource, const std::shared_ptr<Model> &model);
+
+    /* Starts background import of the model when it is still a placeholder, called once it passes culling */
+    void RequestModelLoad(const Model &model);
+
+    /**
+     * Replaces placeholders with imported models and swaps in models re-imported by hot reload,
+     * must be called from the thread owning GL context
+     */
+    void ProcessLazyModels();
+
+    NDSCRD LazyModelStats GetLazyModelStats();
+
+    NDSCRD FAST_CALL ProgramCache::Stats GetProgramCacheStats() const { return program_cache_->GetStats(); }
+
+    /* Returns nullptr when the cache is disabled, thread safe */
+    NDSCRD FAST_CALL SharedAssetCache *GetSharedAssetCache() const noexcept { return shared_asset_cache_.get(); }
+
     FAST_CALL CxxUtils::ExtendedMap<std::string, std::shared_ptr<Texture>> &GetTextures() { return textures_; }
 
     FAST_CALL CxxUtils::ExtendedMap<std::string, std::shared_ptr<Shader>> &GetShaders() { return shaders_; }
@@ -77,21 +237,152 @@ class ResourceMgrBase final : public CxxUtils::StaticSingletonHelper
 
     Rc LoadTextureFromExternal_(const ResourceSpec &resource);
 
+    /* Decodes the file only when no process stored its pixels in the shared asset cache yet */
+    std::shared_ptr<Texture> LoadSharedTexture_(const std::string &path);
+
     std::shared_ptr<Texture> LoadTextureFromMemory_(const unsigned char *data, int len);
 
+    /* Creates texture sharing the GPU storage with already loaded texture of identical content */
+    std::shared_ptr<Texture> CreateTexture_(const unsigned char *data, int width, int height, int channels);
+
+    /* Returns already created storage of identical content or registers the new one */
+    std::shared_ptr<TextureStorage> GetTextureStorage_(const unsigned char *data, int width, int height, int channels);
+
+    /* Large textures are streamed when enabled in settings */
+    NDSCRD static std::shared_ptr<TextureStorage> CreateTextureStorage_(
+        const unsigned char *data, int width, int height, int channels, const Hash128 &hash
+    );
+
     Rc LoadShaderFromMemory_(const ResourceSpec &resource);
 
     Rc LoadShaderFromExternal_(const ResourceSpec &resource);
 
     Rc LoadModelFromExternal_(const ResourceSpec &resource);
 
+    Rc LoadModelFromInternal_(const ResourceSpec &resource);
+
+    /* Registers placeholder resolved later by ProcessLazyModels */
+    Rc LoadModelPlaceholderUnlocked_(const ResourceSpec &resource);
+
+    void RequestModelLoadUnlocked_(const std::string &model_name);
+
+    template <class T>
+    void TrackUsage_(
+        CxxUtils::ExtendedMap<std::string, std::shared_ptr<T>> &map,
+        std::unordered_map<std::string, ResourceUsage> &usage
+    );
+
+    FAST_CALL void TouchResource_(std::unordered_map<std::string, ResourceUsage> &usage, const std::string &name)
+    {
+        usage.at(name).last_use = use_clock_.fetch_add(1);
+    }
+
+    template <class T>
+    NDSCRD static bool IsEvictable_(const std::shared_ptr<T> &resource);
+
+    template <class T>
+    void EvictUnlocked_(
+        CxxUtils::ExtendedMap<std::string, std::shared_ptr<T>> &map,
+        std::unordered_map<std::string, ResourceSpec> &evicted, const std::string &name, ResourceType type
+    );
+
+    bool EvictLeastRecentlyUsedUnlocked_();
+
+    /* Variants still compiling are kept, returns false when there is none to evict, requires the shaders mutex */
+    bool EvictShaderVariantUnlocked_();
+
+    template <class T>
+    void ReleaseUnlocked_(
+        CxxUtils::ExtendedMap<std::string, std::shared_ptr<T>> &map, const std::vector<std::string> &names
+    );
+
+    template <class T>
+    size_t ReleaseUnwantedUnlocked_(
+        CxxUtils::ExtendedMap<std::string, std::shared_ptr<T>> &map,
+        const std::unordered_map<std::string, const ResourceSpec *> &wanted
+    );
+
+    template <class T>
+    size_t ReleaseOrphanedUnlocked_(CxxUtils::ExtendedMap<std::string, std::shared_ptr<T>> &map);
+
+    NDSCRD static size_t GetMemoryBudget_();
+
+    /* Tracked GPU memory, including render targets which are never evicted, estimated shader sizes are left out */
+    NDSCRD FAST_CALL static size_t GetVramBytes_() noexcept
+    {
+        return MemoryTracker::GetPoolBytes(MemoryTracker::Pool::kVram);
+    }
+
+    static void OnMemoryBudgetChanged_(uint64_t new_value);
+
+    void InitHotReload_();
+
+    void WatchResource_(ResourceType type, const std::string &name, const Resource &resource);
+
+    void OnFileChanged_(const std::string &path);
+
+    void ReloadTexture_(const PendingReload &reload);
+
+    void ReloadShader_(const PendingReload &reload);
+
+    void ReloadModel_(const PendingReload &reload);
+
+    /* Returns already created geometry of identical content, must be called with the flyweight mutex taken */
+    std::shared_ptr<MeshGeometry> FindMeshGeometryUnlocked_(const Hash128 &hash);
+
+    /* Returns false when the file was not decoded ahead with the current flip */
+    bool TakePredecodedTexture_(const std::string &path, PredecodedTexture &out);
+
     // ------------------------------
     // Class fields
     // ------------------------------
 
+    /* mapped pages must outlive the geometries uploaded from them */
+    std::unique_ptr<SharedAssetCache> shared_asset_cache_{};
+    std::atomic<int8_t> texture_flip_{};
+
     CxxUtils::ExtendedMap<std::string, std::shared_ptr<Texture>> textures_;
     CxxUtils::ExtendedMap<std::string, std::shared_ptr<Shader>> shaders_;
     CxxUtils::ExtendedMap<std::string, std::shared_ptr<Model>> models_;
+
+    /* permutations of shaders, guarded by the shaders mutex */
+    std::unordered_map<std::string, ShaderVariant> shader_variants_{};
+
+    /* flyweight caches keyed by payload hash */
+    std::mutex flyweight_mutex_{};
+    std::unordered_map<Hash128, std::weak_ptr<TextureStorage>, Hash128Hasher> texture_storages_{};
+    std::unordered_map<Hash128, std::weak_ptr<MeshGeometry>, Hash128Hasher> mesh_geometries_{};
+    size_t texture_sweep_size_{};
+    size_t mesh_sweep_size_{};
+    DedupStats dedup_stats_{};
+
+    /* eviction order, guarded by the mutex of the corresponding map */
+    std::unordered_map<std::string, ResourceUsage> texture_usage_{};
+    std::unordered_map<std::string, ResourceUsage> model_usage_{};
+    std::unordered_map<std::string, ResourceSpec> evicted_textures_{};
+    std::unordered_map<std::string, ResourceSpec> evicted_models_{};
+    std::atomic<uint64_t> use_clock_{};
+    std::atomic<size_t> evicted_count_{};
+
+    std::unique_ptr<ProgramCache> program_cache_{};
+
+    /* lazy model loading, requested, reloading and failed names are guarded by the models mutex */
+    std::unique_ptr<ModelBoundsCache> bounds_cache_{};
+    std::unique_ptr<ModelImporter> model_importer_{};
+    std::unordered_set<std::string> requested_models_{};
+    std::unordered_map<std::string, size_t> reloading_models_{};
+    std::unordered_set<std::string> failed_models_{};
+    size_t resolved_models_{};
+
+    /* hot reload */
+    std::mutex hot_reload_mutex_{};
+    std::unordered_map<std::string, std::vector<WatchedResource>> watched_resources_{};
+    std::vector<PendingReload> pending_reloads_{};
+    std::unique_ptr<FileWatcher> file_watcher_{};
+
+    /* startup decoding, paths being decoded are reserved with empty pixels */
+    std::mutex predecoded_mutex_{};
+    std::unordered_map<std::string, PredecodedTexture> predecoded_textures_{};
 };
 
 using ResourceMgr = CxxUtils::StaticSingleton<ResourceMgrBase>;
@@ -22,4 +22,9 @@ void LibGcp::SettingsMgrBase::LoadDefaultSettings()
     SetSetting<Setting::kFar, float>(10000.0f);
     SetSetting<Setting::kProjectionType, ProjectionType>(ProjectionType::kPerspective);
     SetSetting<Setting::kOrthoHeight, float>(10.0f);
+    SetSetting<Setting::kGpuMemoryBudgetMb, uint64_t>(2048);  // 0 disables eviction
+    SetSetting<Setting::kTextureStreaming, bool>(true);
+    SetSetting<Setting::kTextureUploadBudgetKb, uint64_t>(8192);
+    SetSetting<Setting::kWorldStreamingRadius, uint64_t>(1);
+    SetSetting<Setting::kLazyModelLoading, bool>(false);
 }
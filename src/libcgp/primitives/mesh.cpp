@@ -49,23 +49,115 @@ void LibGcp::Quad::Init()
 
 void LibGcp::Quad::Draw() const
 {
-    glBindVertexArray(vao_);
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+    GlBindVertexArray(vao_);
+    GlDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    GlBindVertexArray(0);
 }
 
-LibGcp::Mesh::Mesh(
-    std::vector<Vertex> &&vertices, std::vector<GLuint> &&indices, std::vector<std::shared_ptr<Texture> > &&textures
-)
-    : vertices_(std::move(vertices)), indices_(std::move(indices)), textures_(std::move(textures))
+LibGcp::MeshGeometry::MeshGeometry(std::vector<Vertex> &&vertices, std::vector<GLuint> &&indices)
+    : vertices_(std::move(vertices)),
+      indices_(std::move(indices)),
+      vertices_view_(vertices_),
+      indices_view_(indices_),
+      vertex_count_(vertices_view_.size()),
+      index_count_(indices_view_.size())
 {
-    R_ASSERT(vertices_.size() > 0);
-    R_ASSERT(indices_.size() > 0);
+    ComputeBoundingBox_();
+    SetupMesh_();
 
+    copies_allocation_ = MemoryTracker::Allocation(
+        MemoryTracker::Category::kMeshCopies,
+        vertices_.capacity() * sizeof(Vertex) + indices_.capacity() * sizeof(GLuint)
+    );
+}
+
+LibGcp::MeshGeometry::MeshGeometry(const std::span<const Vertex> vertices, const std::span<const GLuint> indices)
+    : vertices_view_(vertices),
+      indices_view_(indices),
+      vertex_count_(vertices_view_.size()),
+      index_count_(indices_view_.size())
+{
+    ComputeBoundingBox_();
     SetupMesh_();
 }
 
-void LibGcp::Mesh::SetupMesh_()
+LibGcp::MeshGeometry::MeshGeometry(
+    const size_t vertex_count, const size_t index_count, const BoundingBox &bounds, const fill_t &fill
+)
+    : vertex_count_(vertex_count), index_count_(index_count), bounding_box_(bounds)
+{
+    R_ASSERT(vertex_count_ > 0);
+    R_ASSERT(index_count_ > 0);
+
+    const auto vertices_bytes = static_cast<ssize_t>(vertex_count_ * sizeof(Vertex));
+    const auto indices_bytes  = static_cast<ssize_t>(index_count_ * sizeof(GLuint));
+
+    glGenVertexArrays(1, &VAO_);
+    glGenBuffers(1, &VBO_);
+    glGenBuffers(1, &EBO_);
+
+    glBindVertexArray(VAO_);
+
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_);
+    GlBufferData(GL_ARRAY_BUFFER, vertices_bytes, nullptr, GL_STATIC_DRAW);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO_);
+    GlBufferData(GL_ELEMENT_ARRAY_BUFFER, indices_bytes, nullptr, GL_STATIC_DRAW);
+
+    /* whole buffers are written, so the driver does not need to preserve anything */
+    static constexpr GLbitfield kMapFlags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT;
+
+    auto *vertices = static_cast<Vertex *>(GlMapBufferRange(GL_ARRAY_BUFFER, 0, vertices_bytes, kMapFlags));
+    auto *indices  = static_cast<GLuint *>(GlMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, indices_bytes, kMapFlags));
+
+    is_valid_ = vertices != nullptr && indices != nullptr &&
+                fill(std::span(vertices, vertex_count_), std::span(indices, index_count_));
+
+    /* unmapping fails when the content was lost in the meantime */
+    if (vertices != nullptr) {
+        is_valid_ = glUnmapBuffer(GL_ARRAY_BUFFER) == GL_TRUE && is_valid_;
+    }
+
+    if (indices != nullptr) {
+        is_valid_ = glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER) == GL_TRUE && is_valid_;
+    }
+
+    SetupAttributes_();
+
+    buffers_allocation_ = MemoryTracker::Allocation(MemoryTracker::Category::kMeshBuffers, GetSizeBytes());
+}
+
+LibGcp::MeshGeometry::~MeshGeometry()
+{
+    if (VAO_) {
+        glDeleteVertexArrays(1, &VAO_);
+        VAO_ = 0;
+    }
+
+    if (VBO_) {
+        glDeleteBuffers(1, &VBO_);
+        VBO_ = 0;
+    }
+
+    if (EBO_) {
+        glDeleteBuffers(1, &EBO_);
+        EBO_ = 0;
+    }
+}
+
+void LibGcp::MeshGeometry::ComputeBoundingBox_()
+{
+    R_ASSERT(vertices_view_.size() > 0);
+    R_ASSERT(indices_view_.size() > 0);
+
+    bounding_box_ = {vertices_view_[0].position, vertices_view_[0].position};
+    for (const auto &vertex : vertices_view_) {
+        bounding_box_.min = glm::min(bounding_box_.min, vertex.position);
+        bounding_box_.max = glm::max(bounding_box_.max, vertex.position);
+    }
+}
+
+void LibGcp::MeshGeometry::SetupMesh_()
 {
     glGenVertexArrays(1, &VAO_);
     glGenBuffers(1, &VBO_);
@@ -74,15 +166,22 @@ void LibGcp::Mesh::SetupMesh_()
     glBindVertexArray(VAO_);
 
     glBindBuffer(GL_ARRAY_BUFFER, VBO_);
-    glBufferData(
-        GL_ARRAY_BUFFER, static_cast<ssize_t>(vertices_.size() * sizeof(Vertex)), vertices_.data(), GL_STATIC_DRAW
+    GlBufferData(
+        GL_ARRAY_BUFFER, static_cast<ssize_t>(vertices_view_.size_bytes()), vertices_view_.data(), GL_STATIC_DRAW
     );
 
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO_);
-    glBufferData(
-        GL_ELEMENT_ARRAY_BUFFER, static_cast<ssize_t>(indices_.size() * sizeof(GLuint)), indices_.data(), GL_STATIC_DRAW
+    GlBufferData(
+        GL_ELEMENT_ARRAY_BUFFER, static_cast<ssize_t>(indices_view_.size_bytes()), indices_view_.data(), GL_STATIC_DRAW
     );
 
+    SetupAttributes_();
+
+    buffers_allocation_ = MemoryTracker::Allocation(MemoryTracker::Category::kMeshBuffers, GetSizeBytes());
+}
+
+void LibGcp::MeshGeometry::SetupAttributes_()
+{
     /* vertices */
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), nullptr);
@@ -106,6 +205,33 @@ void LibGcp::Mesh::SetupMesh_()
     glBindVertexArray(0);
 }
 
+void LibGcp::MeshGeometry::ReadBack(std::vector<Vertex> &vertices, std::vector<GLuint> &indices) const
+{
+    if (!vertices_view_.empty()) {
+        vertices.assign(vertices_view_.begin(), vertices_view_.end());
+        indices.assign(indices_view_.begin(), indices_view_.end());
+        return;
+    }
+
+    vertices.resize(vertex_count_);
+    indices.resize(index_count_);
+
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_);
+    glGetBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<ssize_t>(vertex_count_ * sizeof(Vertex)), vertices.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    /* element buffer binding belongs to the VAO */
+    glBindVertexArray(VAO_);
+    glGetBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, static_cast<ssize_t>(index_count_ * sizeof(GLuint)), indices.data());
+    glBindVertexArray(0);
+}
+
+LibGcp::Mesh::Mesh(std::shared_ptr<MeshGeometry> geometry, std::vector<std::shared_ptr<Texture> > &&textures)
+    : geometry_(std::move(geometry)), textures_(std::move(textures))
+{
+    R_ASSERT(geometry_ != nullptr);
+}
+
 void LibGcp::Mesh::BindMaterial_(Shader &shader) const noexcept
 {
     static constexpr uint8_t kMaxTextures = 16;
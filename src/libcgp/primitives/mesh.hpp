@@ -1,11 +1,15 @@
 #ifndef LIBGCP_MESH_HPP_
 #define LIBGCP_MESH_HPP_
 
+#include <functional>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include <libcgp/defines.hpp>
+#include <libcgp/engine/render_stats.hpp>
 #include <libcgp/intf.hpp>
+#include <libcgp/utils/memory_tracker.hpp>
 
 #include <glad/gl.h>
 #include <glm/glm.hpp>
@@ -15,6 +19,95 @@ LIBGCP_DECL_START_
 class Shader;
 class Texture;
 
+// ------------------------------
+// Mesh geometry class
+// ------------------------------
+
+/* GPU buffers of the mesh, shared between all meshes with identical vertex and index payload */
+class MeshGeometry
+{
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    /* Writes the whole content of the mapped buffers, returns false on failure */
+    using fill_t = std::function<bool(std::span<Vertex> vertices, std::span<GLuint> indices)>;
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    MeshGeometry(std::vector<Vertex> &&vertices, std::vector<GLuint> &&indices);
+
+    /* Uploads straight from the views without a copy, they must outlive the geometry, e.g. shared asset cache pages */
+    MeshGeometry(std::span<const Vertex> vertices, std::span<const GLuint> indices);
+
+    /* Buffers are filled in place through the mapping, e.g. decoded straight into the GPU memory */
+    MeshGeometry(size_t vertex_count, size_t index_count, const BoundingBox &bounds, const fill_t &fill);
+
+    ~MeshGeometry();
+
+    MeshGeometry(const MeshGeometry &) = delete;
+
+    MeshGeometry &operator=(const MeshGeometry &) = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    NDSCRD FAST_CALL GLuint GetVAO() const noexcept { return VAO_; }
+
+    NDSCRD FAST_CALL GLsizei GetIndicesCount() const noexcept { return static_cast<GLsizei>(index_count_); }
+
+    NDSCRD FAST_CALL size_t GetSizeBytes() const noexcept
+    {
+        return vertex_count_ * sizeof(Vertex) + index_count_ * sizeof(GLuint);
+    }
+
+    /* False when filling of the mapped buffers failed */
+    NDSCRD FAST_CALL bool IsValid() const noexcept { return is_valid_; }
+
+    /* Copies the payload, geometry filled through the mapping is read back from the GPU */
+    void ReadBack(std::vector<Vertex> &vertices, std::vector<GLuint> &indices) const;
+
+    /* Model space bounds of the vertices */
+    NDSCRD FAST_CALL const BoundingBox &GetBoundingBox() const noexcept { return bounding_box_; }
+
+    // ------------------------------
+    // Implementation methods
+    // ------------------------------
+
+    protected:
+    void ComputeBoundingBox_();
+
+    void SetupMesh_();
+
+    void SetupAttributes_();
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    /* owned payload, empty when the geometry only views external memory */
+    std::vector<Vertex> vertices_;
+    std::vector<GLuint> indices_;
+
+    std::span<const Vertex> vertices_view_{};
+    std::span<const GLuint> indices_view_{};
+    size_t vertex_count_{};
+    size_t index_count_{};
+    BoundingBox bounding_box_{};
+    bool is_valid_{true};
+
+    GLuint VAO_{};
+    GLuint VBO_{};
+    GLuint EBO_{};
+
+    MemoryTracker::Allocation buffers_allocation_{};
+    MemoryTracker::Allocation copies_allocation_{};
+};
+
 // ------------------------------
 // Mesh class
 // ------------------------------
@@ -34,9 +127,7 @@ class Mesh
 
     ~Mesh() = default;
 
-    Mesh(
-        std::vector<Vertex> &&vertices, std::vector<GLuint> &&indices, std::vector<std::shared_ptr<Texture> > &&textures
-    );
+    Mesh(std::shared_ptr<MeshGeometry> geometry, std::vector<std::shared_ptr<Texture> > &&textures);
 
     Mesh(const Mesh &) = delete;
 
@@ -53,21 +144,23 @@ class Mesh
     FAST_CALL void Draw(Shader &shader) const
     {
         BindMaterial_(shader);
-        glBindVertexArray(VAO_);
-        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices_.size()), GL_UNSIGNED_INT, nullptr);
-        glBindVertexArray(0);
+        GlBindVertexArray(geometry_->GetVAO());
+        GlDrawElements(GL_TRIANGLES, geometry_->GetIndicesCount(), GL_UNSIGNED_INT, nullptr);
+        GlBindVertexArray(0);
     }
 
     NDSCRD double &GetOpacity() noexcept { return opacity_; }
     NDSCRD double &GetShininess() noexcept { return shininess_; }
 
+    NDSCRD FAST_CALL const std::shared_ptr<MeshGeometry> &GetGeometry() const noexcept { return geometry_; }
+
+    NDSCRD FAST_CALL const std::vector<std::shared_ptr<Texture> > &GetTextures() const noexcept { return textures_; }
+
     // ------------------------------
     // Implementation methods
     // ------------------------------
 
     protected:
-    void SetupMesh_();
-
     void BindMaterial_(Shader &shader) const noexcept;
 
     // ------------------------------
@@ -77,13 +170,8 @@ class Mesh
     double opacity_{1.0};
     double shininess_{32.0};
 
-    std::vector<Vertex> vertices_;
-    std::vector<GLuint> indices_;
+    std::shared_ptr<MeshGeometry> geometry_;
     std::vector<std::shared_ptr<Texture> > textures_;
-
-    GLuint VAO_{};
-    GLuint VBO_{};
-    GLuint EBO_{};
 };
 
 LIBGCP_DECL_END_
@@ -1,14 +1,25 @@
 #include <libcgp/mgr/resource_mgr.hpp>
 #include <libcgp/primitives/mesh.hpp>
 #include <libcgp/primitives/model.hpp>
+#include <libcgp/serialization/mesh_codec.hpp>
 #include <libcgp/utils/files.hpp>
+#include <libcgp/utils/hash.hpp>
 #include <libcgp/utils/macros.hpp>
-#include <libcgp/utils/timer.hpp>
+#include <libcgp/utils/memory_tracker.hpp>
+#include <libcgp/utils/mip_file.hpp>
+#include <libcgp/utils/profiler.hpp>
+#include <libcgp/utils/shared_asset_cache.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstddef>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -89,75 +100,496 @@ L_FAST_CALL void TraceMaterialInfo(aiMaterial *material)
     }
 }
 
+L_FAST_CALL void AppendBlob(std::vector<std::byte> &blob, const void *data, const size_t size)
+{
+    const auto *bytes = static_cast<const std::byte *>(data);
+    blob.insert(blob.end(), bytes, bytes + size);
+}
+
+/* Arrays are viewed in place, so they are aligned relative to the blob start, which is aligned by the cache */
+L_FAST_CALL void AlignBlob(std::vector<std::byte> &blob, const size_t alignment)
+{
+    blob.resize((blob.size() + alignment - 1) / alignment * alignment);
+}
+
+/* Bounds checked cursor over the blob */
+class BlobReader
+{
+    public:
+    explicit BlobReader(const std::span<const std::byte> blob) : blob_(blob) {}
+
+    template <class T>
+    NDSCRD bool Read(T &out) noexcept
+    {
+        if (blob_.size() - offset_ < sizeof(T)) {
+            return false;
+        }
+
+        std::memcpy(&out, blob_.data() + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    template <class T>
+    NDSCRD bool View(std::span<const T> &out, const size_t count) noexcept
+    {
+        offset_ = (offset_ + alignof(T) - 1) / alignof(T) * alignof(T);
+        if (offset_ > blob_.size() || (blob_.size() - offset_) / sizeof(T) < count) {
+            return false;
+        }
+
+        out = {reinterpret_cast<const T *>(blob_.data() + offset_), count};
+        offset_ += count * sizeof(T);
+        return true;
+    }
+
+    private:
+    std::span<const std::byte> blob_;
+    size_t offset_{};
+};
+
+/* Reads texture records following the mesh record, shared by the blob and the internal format */
+static bool ReadBlobTextures(
+    BlobReader &reader, const uint32_t count, std::vector<std::shared_ptr<LibGcp::Texture> > &textures
+)
+{
+    using LibGcp::ModelSerializer;
+    using LibGcp::ResourceMgr;
+    using LibGcp::Texture;
+
+    textures.reserve(count);
+
+    for (uint32_t texture_idx = 0; texture_idx < count; ++texture_idx) {
+        ModelSerializer::BlobTexture record{};
+        std::span<const char> name{};
+        std::span<const unsigned char> data{};
+
+        if (!reader.Read(record) || !reader.View(name, record.name_size) || !reader.View(data, record.data_size) ||
+            record.type >= static_cast<uint32_t>(Texture::Type::kLast)) {
+            return false;
+        }
+
+        const std::string texture_name(name.begin(), name.end());
+
+        std::shared_ptr<Texture> texture{};
+        if (static_cast<ModelSerializer::BlobTextureKind>(record.kind) == ModelSerializer::BlobTextureKind::kFile) {
+            texture = ResourceMgr::GetInstance().GetTexture({
+                .paths           = {texture_name},
+                .type            = LibGcp::ResourceType::kTexture,
+                .load_type       = LibGcp::LoadType::kExternal,
+                .is_serializable = false,
+            });
+        } else {
+            if (data.size() != static_cast<size_t>(record.width) * static_cast<size_t>(record.height) *
+                                   static_cast<size_t>(record.channels)) {
+                return false;
+            }
+
+            texture = ResourceMgr::GetInstance().GetTextureExternalSourceRaw(
+                texture_name,
+                {
+                    .texture_data = data.data(),
+                    .width        = record.width,
+                    .height       = record.height,
+                    .channels     = record.channels,
+                }
+            );
+        }
+
+        texture->SetType(static_cast<Texture::Type>(record.type));
+        textures.push_back(texture);
+    }
+
+    return true;
+}
+
 // ------------------------------
 // Implementations
 // ------------------------------
 
-LibGcp::Model::Model(std::vector<std::shared_ptr<Mesh> > &&meshes) : meshes_(std::move(meshes)) {}
+LibGcp::Model::Model(std::vector<std::shared_ptr<Mesh> > &&meshes, const bool is_placeholder)
+    : meshes_(std::move(meshes)), is_placeholder_(is_placeholder)
+{
+    ComputeBoundingBox_();
+}
+
+void LibGcp::Model::ComputeBoundingBox_() noexcept
+{
+    if (meshes_.empty()) {
+        bounding_box_ = {};
+        return;
+    }
+
+    bounding_box_ = meshes_[0]->GetGeometry()->GetBoundingBox();
+    for (const auto &mesh : meshes_) {
+        bounding_box_.Extend(mesh->GetGeometry()->GetBoundingBox());
+    }
+}
 
 std::shared_ptr<LibGcp::Model> LibGcp::ModelSerializer::LoadModelFromExternalFormat(const std::string &path)
 {
-    Timer timer{};
-    timer.Start(0);
+    PROFILE_SCOPE("ModelSerializer::LoadModelFromExternalFormat");
+    const MemoryTracker::OwnerScope owner_scope(path);
 
-    meshes_.clear();
-    Assimp::Importer importer{};
+    std::shared_ptr<Model> model{};
+    if (const auto blob = FindSharedBlob(path); !blob.empty()) {
+        model = LoadModelFromBlob(blob, path);
+    }
+
+    if (!model) {
+        const auto importer = ImportExternalFormat(path);
+        if (!importer) {
+            return nullptr;
+        }
+
+        model = BuildModelFromImport(*importer, path);
+    }
 
-    const auto *scene = importer.ReadFile(
+    return model;
+}
+
+std::unique_ptr<Assimp::Importer> LibGcp::ModelSerializer::ImportExternalFormat(const std::string &path)
+{
+    auto importer = std::make_unique<Assimp::Importer>();
+
+    const auto *scene = importer->ReadFile(
         path, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_GenNormals | aiProcess_JoinIdenticalVertices |
                   aiProcess_ImproveCacheLocality | aiProcess_RemoveRedundantMaterials | aiProcess_OptimizeMeshes |
                   aiProcess_CalcTangentSpace
     );
 
     if (scene == nullptr || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || scene->mRootNode == nullptr) {
-        TRACE(importer.GetErrorString());
+        TRACE(importer->GetErrorString());
         return nullptr;
     }
 
+    return importer;
+}
+
+std::shared_ptr<LibGcp::Model> LibGcp::ModelSerializer::BuildModelFromImport(
+    const Assimp::Importer &importer, const std::string &path
+)
+{
+    const MemoryTracker::OwnerScope owner_scope(path);
+
+    const aiScene *scene = importer.GetScene();
+    assert(scene != nullptr);
+
+    meshes_.clear();
     format_    = GetFileFormat(path);
     full_path_ = path;
     directory_ = path.substr(0, path.find_last_of('/'));
 
+    is_recording_ = ResourceMgr::GetInstance().GetSharedAssetCache() != nullptr;
+    blob_.clear();
+    blob_textures_.clear();
+    blob_texture_count_ = 0;
+    blob_mesh_count_    = 0;
+
+    const BlobHeader header{};
+    AppendBlob(blob_, &header, sizeof(BlobHeader));
+
     TraceSceneInfo(scene);
     ProcessNode_(scene->mRootNode, scene);
-    timer.StopAndPrint(0);
+
+    if (is_recording_) {
+        StoreSharedBlob_(path);
+        is_recording_ = false;
+    }
 
     return std::make_shared<Model>(std::move(meshes_));
 }
 
-std::shared_ptr<LibGcp::Model> LibGcp::ModelSerializer::LoadModelFromInternalFormat(const std::string &){NOT_IMPLEMENTED
+std::vector<std::string> LibGcp::ModelSerializer::GetExternalTexturePaths(
+    const Assimp::Importer &importer, const std::string &path
+)
+{
+    const aiScene *scene = importer.GetScene();
+    assert(scene != nullptr);
+
+    /* same resolution as in LoadMaterialTextures_, height maps are used as normals for obj only */
+    const std::filesystem::path dir_path = std::filesystem::absolute(path.substr(0, path.find_last_of('/')));
+    const bool use_height_maps           = GetFileFormat(path) == "obj";
+
+    std::vector<std::string> paths{};
+    for (size_t material_idx = 0; material_idx < scene->mNumMaterials; ++material_idx) {
+        const aiMaterial *material = scene->mMaterials[material_idx];
+
+        const bool has_normals = material->GetTextureCount(aiTextureType_NORMALS) != 0;
+
+        for (const auto type :
+             {aiTextureType_DIFFUSE, aiTextureType_SPECULAR, aiTextureType_NORMALS, aiTextureType_HEIGHT}) {
+            if (type == aiTextureType_HEIGHT && (has_normals || !use_height_maps)) {
+                continue;
+            }
+
+            for (unsigned idx = 0; idx < material->GetTextureCount(type); ++idx) {
+                aiString str;
+                material->GetTexture(type, idx, &str);
+
+                if (scene->GetEmbeddedTexture(str.C_Str()) == nullptr) {
+                    paths.push_back(weakly_canonical(dir_path / str.C_Str()).string());
+                }
+            }
+        }
+    }
+
+    std::ranges::sort(paths);
+    paths.erase(std::ranges::unique(paths).begin(), paths.end());
+
+    return paths;
 }
 
-std::shared_ptr<LibGcp::Model> LibGcp::ModelSerializer::DumpModelToInternalFormat(const Model &, const std::string &)
+LibGcp::ModelSerializer::blob_t LibGcp::ModelSerializer::FindSharedBlob(const std::string &path)
 {
-    NOT_IMPLEMENTED
+    auto *cache = ResourceMgr::GetInstance().GetSharedAssetCache();
+    if (cache == nullptr) {
+        return {};
+    }
+
+    const auto key = HashFileIdentity(path, kBlobHashSeed);
+    return key ? cache->Find(*key) : blob_t{};
 }
 
-void LibGcp::ModelSerializer::ProcessNode_(const aiNode *node, const aiScene *scene)
+std::shared_ptr<LibGcp::Model> LibGcp::ModelSerializer::LoadModelFromBlob(const blob_t blob, const std::string &path)
 {
-    assert(node != nullptr);
-    assert(scene != nullptr);
+    const MemoryTracker::OwnerScope owner_scope(path);
 
-    for (size_t idx = 0; idx < node->mNumMeshes; ++idx) {
-        const auto *mesh = scene->mMeshes[node->mMeshes[idx]];
-        meshes_.push_back(ProcessMesh_(mesh, scene));
+    BlobReader reader(blob);
+
+    BlobHeader header{};
+    if (!reader.Read(header) || header.magic != kBlobMagic || header.version != kBlobVersion) {
+        TRACE("Malformed shared model blob: " << path);
+        return nullptr;
     }
 
-    for (size_t idx = 0; idx < node->mNumChildren; ++idx) {
-        ProcessNode_(node->mChildren[idx], scene);
+    std::vector<std::shared_ptr<Mesh> > meshes{};
+    meshes.reserve(header.mesh_count);
+
+    for (uint32_t mesh_idx = 0; mesh_idx < header.mesh_count; ++mesh_idx) {
+        BlobMesh record{};
+        std::span<const Vertex> vertices{};
+        std::span<const GLuint> indices{};
+
+        if (!reader.Read(record) || !reader.View(vertices, record.vertex_count) ||
+            !reader.View(indices, record.index_count)) {
+            TRACE("Malformed shared model blob: " << path);
+            return nullptr;
+        }
+
+        std::vector<std::shared_ptr<Texture> > textures{};
+        if (!ReadBlobTextures(reader, record.texture_count, textures)) {
+            TRACE("Malformed shared model blob: " << path);
+            return nullptr;
+        }
+
+        auto geometry = ResourceMgr::GetInstance().GetMeshGeometry(vertices, indices);
+        auto mesh_ptr = std::make_shared<Mesh>(std::move(geometry), std::move(textures));
+
+        mesh_ptr->GetShininess() = record.shininess;
+        mesh_ptr->GetOpacity()   = record.opacity;
+
+        meshes.push_back(std::move(mesh_ptr));
     }
+
+    TRACE("Loaded model from the shared asset cache: " << path);
+    return std::make_shared<Model>(std::move(meshes));
 }
 
-std::shared_ptr<LibGcp::Mesh> LibGcp::ModelSerializer::ProcessMesh_(const aiMesh *mesh, const aiScene *scene)
+std::shared_ptr<LibGcp::Model> LibGcp::ModelSerializer::CreatePlaceholderModel(const BoundingBox *bounds)
 {
-    assert(mesh != nullptr);
-    assert(scene != nullptr);
+    static constexpr size_t kFaceCount = 6;
+    static constexpr unsigned char kColorData[4] = {160, 160, 160, 255};
+
+    std::vector<std::shared_ptr<Mesh> > meshes{};
+
+    if (bounds != nullptr) {
+        /* normal, first and second axis spanning the face, tangent follows the first axis */
+        static const std::array<std::array<glm::vec3, 3>, kFaceCount> kFaces{{
+            {{{1, 0, 0}, {0, 0, -1}, {0, 1, 0}}},
+            {{{-1, 0, 0}, {0, 0, 1}, {0, 1, 0}}},
+            {{{0, 1, 0}, {1, 0, 0}, {0, 0, -1}}},
+            {{{0, -1, 0}, {1, 0, 0}, {0, 0, 1}}},
+            {{{0, 0, 1}, {1, 0, 0}, {0, 1, 0}}},
+            {{{0, 0, -1}, {-1, 0, 0}, {0, 1, 0}}},
+        }};
+
+        const glm::vec3 center = bounds->GetCenter();
+        const glm::vec3 extent = (bounds->max - bounds->min) * 0.5f;
+
+        std::vector<Vertex> vertices{};
+        std::vector<GLuint> indices{};
+        vertices.reserve(kFaceCount * 4);
+        indices.reserve(kFaceCount * 6);
+
+        for (const auto &[normal, axis_u, axis_v] : kFaces) {
+            const auto base = static_cast<GLuint>(vertices.size());
+
+            for (const glm::vec2 corner : {glm::vec2{-1, -1}, glm::vec2{1, -1}, glm::vec2{1, 1}, glm::vec2{-1, 1}}) {
+                const glm::vec3 offset = normal + axis_u * corner.x + axis_v * corner.y;
+                vertices.push_back({
+                    .position   = center + offset * extent,
+                    .normal     = normal,
+                    .tex_coords = {(corner.x + 1.0f) * 0.5f, (corner.y + 1.0f) * 0.5f},
+                    .tangent    = axis_u,
+                });
+            }
+
+            for (const GLuint idx : {0u, 1u, 2u, 0u, 2u, 3u}) {
+                indices.push_back(base + idx);
+            }
+        }
 
-    std::vector<Vertex> vertices{};
-    std::vector<GLuint> indices{};
-    std::vector<std::shared_ptr<Texture> > textures{};
+        std::vector<std::shared_ptr<Texture> > textures{};
+        const auto color = ResourceMgr::GetInstance().GetTextureExternalSourceRaw(
+            "placeholder_texture",
+            {
+                .texture_data = const_cast<unsigned char *>(kColorData),
+                .width        = 1,
+                .height       = 1,
+                .channels     = 4,
+            }
+        );
+        color->SetType(Texture::Type::kDiffuse);
+        textures.push_back(color);
+        FallBackNormal(textures);
 
-    TraceMeshInfo(mesh);
+        auto geometry = ResourceMgr::GetInstance().GetMeshGeometry(std::move(vertices), std::move(indices));
+        meshes.push_back(std::make_shared<Mesh>(std::move(geometry), std::move(textures)));
+    }
+
+    return std::make_shared<Model>(std::move(meshes), true);
+}
+
+std::shared_ptr<LibGcp::Model> LibGcp::ModelSerializer::LoadModelFromInternalFormat(const std::string &path)
+{
+    PROFILE_SCOPE("ModelSerializer::LoadModelFromInternalFormat");
+    const MemoryTracker::OwnerScope owner_scope(path);
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        TRACE("Failed to open internal model: " << path);
+        return nullptr;
+    }
+
+    std::vector<std::byte> content(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char *>(content.data()), static_cast<std::streamsize>(content.size()))) {
+        TRACE("Failed to read internal model: " << path);
+        return nullptr;
+    }
+
+    BlobReader reader(content);
+
+    InternalHeader header{};
+    if (!reader.Read(header) || header.magic != kInternalMagic || header.version != kInternalVersion) {
+        TRACE("Malformed internal model: " << path);
+        return nullptr;
+    }
+
+    std::vector<std::shared_ptr<Mesh> > meshes{};
+    meshes.reserve(header.mesh_count);
+
+    for (uint32_t mesh_idx = 0; mesh_idx < header.mesh_count; ++mesh_idx) {
+        InternalMesh record{};
+        std::vector<std::shared_ptr<Texture> > textures{};
+        std::span<const std::byte> encoded{};
+
+        if (!reader.Read(record) || !ReadBlobTextures(reader, record.texture_count, textures) ||
+            !reader.View(encoded, record.geometry_size)) {
+            TRACE("Malformed internal model: " << path);
+            return nullptr;
+        }
+
+        auto geometry = ResourceMgr::GetInstance().GetMeshGeometry(encoded);
+        if (!geometry) {
+            TRACE("Malformed mesh geometry of internal model: " << path);
+            return nullptr;
+        }
+
+        auto mesh_ptr = std::make_shared<Mesh>(std::move(geometry), std::move(textures));
+
+        mesh_ptr->GetShininess() = record.shininess;
+        mesh_ptr->GetOpacity()   = record.opacity;
+
+        meshes.push_back(std::move(mesh_ptr));
+    }
+
+    return std::make_shared<Model>(std::move(meshes));
+}
+
+LibGcp::Rc LibGcp::ModelSerializer::DumpModelToInternalFormat(const Model &model, const std::string &path)
+{
+    /* textures are referenced by the name they are registered with in the manager */
+    std::unordered_map<const Texture *, std::string> texture_names{};
+    ResourceMgr::GetInstance().GetTextures().Lock();
+    for (const auto &[name, texture] : ResourceMgr::GetInstance().GetTextures()) {
+        texture_names[texture.get()] = name;
+    }
+    ResourceMgr::GetInstance().GetTextures().Unlock();
+
+    const InternalHeader header{
+        .magic      = kInternalMagic,
+        .version    = kInternalVersion,
+        .mesh_count = static_cast<uint32_t>(model.GetMeshesCount()),
+    };
+
+    std::vector<std::byte> content{};
+    AppendBlob(content, &header, sizeof(InternalHeader));
+
+    for (size_t mesh_idx = 0; mesh_idx < model.GetMeshesCount(); ++mesh_idx) {
+        const auto mesh = model.GetMesh(mesh_idx);
+
+        std::vector<Vertex> vertices{};
+        std::vector<GLuint> indices{};
+        mesh->GetGeometry()->ReadBack(vertices, indices);
+
+        const auto encoded = MeshCodec::Encode(vertices, indices);
+        if (encoded.empty()) {
+            return Rc::kInvalidArgument;
+        }
+
+        const InternalMesh record{
+            .geometry_size = encoded.size(),
+            .texture_count = static_cast<uint32_t>(mesh->GetTextures().size()),
+            .reserved      = 0,
+            .shininess     = mesh->GetShininess(),
+            .opacity       = mesh->GetOpacity(),
+        };
+        AppendBlob(content, &record, sizeof(InternalMesh));
+
+        for (const auto &texture : mesh->GetTextures()) {
+            const auto name_it = texture_names.find(texture.get());
+            if (name_it == texture_names.end()) {
+                TRACE("Texture of the model is not registered in the manager: " << path);
+                return Rc::kInvalidArgument;
+            }
+
+            if (!AppendInternalTexture_(content, *texture, name_it->second)) {
+                return Rc::kFailedToLoad;
+            }
+        }
+
+        AppendBlob(content, encoded.data(), encoded.size());
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return Rc::kFailedToOpenFile;
+    }
+
+    file.write(reinterpret_cast<const char *>(content.data()), static_cast<std::streamsize>(content.size()));
+    return file.good() ? Rc::kSuccess : Rc::kUnknownFailure;
+}
+
+void LibGcp::ModelSerializer::ConvertMeshGeometry(
+    const aiMesh *mesh, std::vector<Vertex> &vertices, std::vector<GLuint> &indices
+)
+{
+    assert(mesh != nullptr);
+
+    vertices.clear();
+    indices.clear();
 
     // process vertices
     vertices.reserve(mesh->mNumVertices);
@@ -185,6 +617,35 @@ std::shared_ptr<LibGcp::Mesh> LibGcp::ModelSerializer::ProcessMesh_(const aiMesh
             indices.push_back(face.mIndices[jdx]);
         }
     }
+}
+
+void LibGcp::ModelSerializer::ProcessNode_(const aiNode *node, const aiScene *scene)
+{
+    assert(node != nullptr);
+    assert(scene != nullptr);
+
+    for (size_t idx = 0; idx < node->mNumMeshes; ++idx) {
+        const auto *mesh = scene->mMeshes[node->mMeshes[idx]];
+        meshes_.push_back(ProcessMesh_(mesh, scene));
+    }
+
+    for (size_t idx = 0; idx < node->mNumChildren; ++idx) {
+        ProcessNode_(node->mChildren[idx], scene);
+    }
+}
+
+std::shared_ptr<LibGcp::Mesh> LibGcp::ModelSerializer::ProcessMesh_(const aiMesh *mesh, const aiScene *scene)
+{
+    assert(mesh != nullptr);
+    assert(scene != nullptr);
+
+    std::vector<Vertex> vertices{};
+    std::vector<GLuint> indices{};
+    std::vector<std::shared_ptr<Texture> > textures{};
+
+    TraceMeshInfo(mesh);
+
+    ConvertMeshGeometry(mesh, vertices, indices);
 
     aiMaterial *material = scene->mMaterials[mesh->mMaterialIndex];
     TraceMaterialInfo(material);
@@ -218,8 +679,6 @@ std::shared_ptr<LibGcp::Mesh> LibGcp::ModelSerializer::ProcessMesh_(const aiMesh
         LoadMaterialTextures_(textures, scene, material, aiTextureType_NORMALS, Texture::Type::kNormal);
     }
 
-    auto mesh_ptr = std::make_shared<Mesh>(std::move(vertices), std::move(indices), std::move(textures));
-
     /* process properties */
     float shininess;
     R_ASSERT(material->Get(AI_MATKEY_SHININESS, shininess) == aiReturn_SUCCESS);
@@ -227,6 +686,13 @@ std::shared_ptr<LibGcp::Mesh> LibGcp::ModelSerializer::ProcessMesh_(const aiMesh
     float opacity;
     R_ASSERT(material->Get(AI_MATKEY_OPACITY, opacity) == aiReturn_SUCCESS);
 
+    if (is_recording_) {
+        RecordMesh_(vertices, indices, shininess, opacity);
+    }
+
+    auto geometry = ResourceMgr::GetInstance().GetMeshGeometry(std::move(vertices), std::move(indices));
+    auto mesh_ptr = std::make_shared<Mesh>(std::move(geometry), std::move(textures));
+
     mesh_ptr->GetShininess() = shininess;
     mesh_ptr->GetOpacity()   = opacity;
 
@@ -262,18 +728,18 @@ void LibGcp::ModelSerializer::LoadMaterialTextures_(
                 .load_type       = LoadType::kExternal,
                 .is_serializable = false,
             });
+            RecordTexture_(BlobTextureKind::kFile, texture_type, texture_full_path.string());
         } else {
             const std::string full_path = full_path_ + "/" + str.C_Str();
-
-            texture = ResourceMgr::GetInstance().GetTextureExternalSourceRaw(
-                full_path,
-                {
-                    .texture_data = reinterpret_cast<unsigned char *>(ai_texture->pcData),
-                    .width        = static_cast<int>(ai_texture->mWidth),
-                    .height       = static_cast<int>(ai_texture->mHeight),
-                    .channels     = 4,
-                }
-            );
+            const TextureSpec spec{
+                .texture_data = reinterpret_cast<unsigned char *>(ai_texture->pcData),
+                .width        = static_cast<int>(ai_texture->mWidth),
+                .height       = static_cast<int>(ai_texture->mHeight),
+                .channels     = 4,
+            };
+
+            texture = ResourceMgr::GetInstance().GetTextureExternalSourceRaw(full_path, spec);
+            RecordTexture_(BlobTextureKind::kRaw, texture_type, full_path, &spec);
         }
 
         texture->SetType(texture_type);
@@ -297,16 +763,18 @@ void LibGcp::ModelSerializer::FallBackToColor(
         static_cast<unsigned char>(color.b * 255), 255
     };
 
-    const auto texture = ResourceMgr::GetInstance().GetTextureExternalSourceRaw(
-        "fallback_texture_" + std::to_string(color.r) + "_" + std::to_string(color.g) + "_" + std::to_string(color.b),
-        {
-            .texture_data = color_data,
-            .width        = 1,
-            .height       = 1,
-            .channels     = 4,
-        }
-    );
+    const std::string name =
+        "fallback_texture_" + std::to_string(color.r) + "_" + std::to_string(color.g) + "_" + std::to_string(color.b);
+    const TextureSpec spec{
+        .texture_data = color_data,
+        .width        = 1,
+        .height       = 1,
+        .channels     = 4,
+    };
+
+    const auto texture = ResourceMgr::GetInstance().GetTextureExternalSourceRaw(name, spec);
     texture->SetType(Texture::Type::kDiffuse);
+    RecordTexture_(BlobTextureKind::kRaw, Texture::Type::kDiffuse, name, &spec);
 
     textures.push_back(texture);
 }
@@ -316,16 +784,132 @@ void LibGcp::ModelSerializer::FallBackNormal(std::vector<std::shared_ptr<Texture
     static constexpr unsigned char normal_data[4] = {128, 128, 255, 255};
     TRACE("Loading fallback normal map...");
 
-    const auto texture = ResourceMgr::GetInstance().GetTextureExternalSourceRaw(
-        "fallback_normals",
-        {
-            .texture_data = const_cast<unsigned char *>(normal_data),
-            .width        = 1,
-            .height       = 1,
-            .channels     = 4,
-        }
-    );
+    const TextureSpec spec{
+        .texture_data = const_cast<unsigned char *>(normal_data),
+        .width        = 1,
+        .height       = 1,
+        .channels     = 4,
+    };
+
+    const auto texture = ResourceMgr::GetInstance().GetTextureExternalSourceRaw("fallback_normals", spec);
     texture->SetType(Texture::Type::kNormal);
+    RecordTexture_(BlobTextureKind::kRaw, Texture::Type::kNormal, "fallback_normals", &spec);
 
     textures.push_back(texture);
 }
+
+void LibGcp::ModelSerializer::RecordTexture_(
+    const BlobTextureKind kind, const Texture::Type type, const std::string &name, const TextureSpec *raw_spec
+)
+{
+    if (!is_recording_) {
+        return;
+    }
+
+    const size_t data_size = raw_spec == nullptr ? 0
+                                                 : static_cast<size_t>(raw_spec->width) *
+                                                       static_cast<size_t>(raw_spec->height) *
+                                                       static_cast<size_t>(raw_spec->channels);
+
+    const BlobTexture record{
+        .kind      = static_cast<uint32_t>(kind),
+        .type      = static_cast<uint32_t>(type),
+        .width     = raw_spec == nullptr ? 0 : raw_spec->width,
+        .height    = raw_spec == nullptr ? 0 : raw_spec->height,
+        .channels  = raw_spec == nullptr ? 0 : raw_spec->channels,
+        .name_size = static_cast<uint32_t>(name.size()),
+        .data_size = data_size,
+    };
+
+    AppendBlob(blob_textures_, &record, sizeof(BlobTexture));
+    AppendBlob(blob_textures_, name.data(), name.size());
+    if (raw_spec != nullptr) {
+        AppendBlob(blob_textures_, raw_spec->texture_data, data_size);
+    }
+
+    ++blob_texture_count_;
+}
+
+void LibGcp::ModelSerializer::RecordMesh_(
+    const std::vector<Vertex> &vertices, const std::vector<GLuint> &indices, const double shininess,
+    const double opacity
+)
+{
+    const BlobMesh record{
+        .vertex_count  = vertices.size(),
+        .index_count   = indices.size(),
+        .texture_count = blob_texture_count_,
+        .reserved      = 0,
+        .shininess     = shininess,
+        .opacity       = opacity,
+    };
+
+    AppendBlob(blob_, &record, sizeof(BlobMesh));
+    AlignBlob(blob_, alignof(Vertex));
+    AppendBlob(blob_, vertices.data(), vertices.size() * sizeof(Vertex));
+    AlignBlob(blob_, alignof(GLuint));
+    AppendBlob(blob_, indices.data(), indices.size() * sizeof(GLuint));
+
+    /* textures were recorded while the mesh was processed */
+    blob_.insert(blob_.end(), blob_textures_.begin(), blob_textures_.end());
+    blob_textures_.clear();
+    blob_texture_count_ = 0;
+
+    ++blob_mesh_count_;
+}
+
+bool LibGcp::ModelSerializer::AppendInternalTexture_(
+    std::vector<std::byte> &content, const Texture &texture, const std::string &name
+)
+{
+    const auto &storage = *texture.GetStorage();
+
+    BlobTexture record{
+        .kind      = static_cast<uint32_t>(BlobTextureKind::kFile),
+        .type      = static_cast<uint32_t>(texture.GetType()),
+        .width     = 0,
+        .height    = 0,
+        .channels  = 0,
+        .name_size = static_cast<uint32_t>(name.size()),
+        .data_size = 0,
+    };
+
+    /* textures without source file carry their pixels, the full level is kept only in the mip file */
+    std::vector<unsigned char> pixels{};
+    if (!std::filesystem::is_regular_file(name)) {
+        if (!storage.IsStreamed() || !ReadMipLevel(storage.GetMipPath(), 0, pixels)) {
+            TRACE("Pixels of the texture are not available: " << name);
+            return false;
+        }
+
+        record.kind      = static_cast<uint32_t>(BlobTextureKind::kRaw);
+        record.width     = storage.GetWidth();
+        record.height    = storage.GetHeight();
+        record.channels  = storage.GetChannels();
+        record.data_size = pixels.size();
+    }
+
+    AppendBlob(content, &record, sizeof(BlobTexture));
+    AppendBlob(content, name.data(), name.size());
+    AppendBlob(content, pixels.data(), pixels.size());
+
+    return true;
+}
+
+void LibGcp::ModelSerializer::StoreSharedBlob_(const std::string &path)
+{
+    const auto key = HashFileIdentity(path, kBlobHashSeed);
+    if (!key) {
+        return;
+    }
+
+    const BlobHeader header{
+        .magic      = kBlobMagic,
+        .version    = kBlobVersion,
+        .mesh_count = blob_mesh_count_,
+    };
+    std::memcpy(blob_.data(), &header, sizeof(BlobHeader));
+
+    ResourceMgr::GetInstance().GetSharedAssetCache()->Store(*key, {blob_t{blob_}});
+    blob_.clear();
+}
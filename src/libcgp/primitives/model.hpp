@@ -6,11 +6,15 @@
 #include <libcgp/intf.hpp>
 #include <libcgp/primitives/mesh.hpp>
 #include <libcgp/primitives/texture.hpp>
+#include <libcgp/rc.hpp>
 
 #include <CxxUtils/data_types/multi_vector.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <assimp/material.h>
@@ -21,6 +25,11 @@ struct aiScene;
 struct aiMesh;
 struct aiMaterial;
 
+namespace Assimp
+{
+class Importer;
+}  // namespace Assimp
+
 LIBGCP_DECL_START_
 
 /* Forward declarations */
@@ -51,7 +60,7 @@ class Model : public Resource
 
     Model &operator=(const Model &) = delete;
 
-    explicit Model(std::vector<std::shared_ptr<Mesh>> &&meshes);
+    explicit Model(std::vector<std::shared_ptr<Mesh>> &&meshes, bool is_placeholder = false);
 
     // ------------------------------
     // Class interaction
@@ -72,17 +81,35 @@ class Model : public Resource
 
     NDSCRD FAST_CALL const LightContainer &GetLights() const { return lights_; }
 
+    /* Takes geometry and materials of the other model, lights are preserved */
+    FAST_CALL void SwapMeshes(Model &other) noexcept
+    {
+        meshes_.swap(other.meshes_);
+        std::swap(bounding_box_, other.bounding_box_);
+        std::swap(is_placeholder_, other.is_placeholder_);
+    }
+
+    /* Stands in for the model until it is loaded in the background, bounds are unknown when it has no meshes */
+    NDSCRD FAST_CALL bool IsPlaceholder() const noexcept { return is_placeholder_; }
+
+    /* Model space bounds of all meshes */
+    NDSCRD FAST_CALL const BoundingBox &GetBoundingBox() const noexcept { return bounding_box_; }
+
     // ---------------------------------
     // Class implementation methods
     // ---------------------------------
 
     protected:
+    void ComputeBoundingBox_() noexcept;
+
     // ------------------------------
     // Class fields
     // ------------------------------
 
     LightContainer lights_{};
     std::vector<std::shared_ptr<Mesh>> meshes_{};
+    BoundingBox bounding_box_{};
+    bool is_placeholder_{};
 };
 
 // ------------------------------
@@ -91,7 +118,74 @@ class Model : public Resource
 
 class ModelSerializer
 {
+    static constexpr uint64_t kBlobMagic    = 0x474D4F44424C4F42ULL;
+    static constexpr uint32_t kBlobVersion  = 1;
+    static constexpr uint64_t kBlobHashSeed = 0xB10B;
+
+    static constexpr uint64_t kInternalMagic   = 0x474D4F44494E544CULL;
+    static constexpr uint32_t kInternalVersion = 1;
+
     public:
+    static constexpr const char *kInternalExtension = ".libgcp_model";
+
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    using blob_t = std::span<const std::byte>;
+
+    /**
+     * Imported model stored in the shared asset cache: header followed by the meshes, each mesh record is followed
+     * by its vertices, indices and textures. Textures are referenced by path or carry their pixels.
+     */
+    enum class BlobTextureKind : uint32_t {
+        kFile,
+        kRaw,
+    };
+
+    struct PACK BlobHeader {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t mesh_count;
+    };
+
+    struct PACK BlobMesh {
+        uint64_t vertex_count;
+        uint64_t index_count;
+        uint32_t texture_count;
+        uint32_t reserved;
+        double shininess;
+        double opacity;
+    };
+
+    struct PACK BlobTexture {
+        uint32_t kind;
+        uint32_t type;
+        int32_t width;
+        int32_t height;
+        int32_t channels;
+        uint32_t name_size;
+        uint64_t data_size;
+    };
+
+    /**
+     * Internal model file: header followed by the meshes, each mesh record is followed by its textures,
+     * stored the same way as in the blob, and by its geometry encoded with MeshCodec.
+     */
+    struct PACK InternalHeader {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t mesh_count;
+    };
+
+    struct PACK InternalMesh {
+        uint64_t geometry_size;
+        uint32_t texture_count;
+        uint32_t reserved;
+        double shininess;
+        double opacity;
+    };
+
     // ------------------------------
     // Object creation
     // ------------------------------
@@ -102,11 +196,37 @@ class ModelSerializer
     // Class interaction
     // ------------------------------
 
+    /* Takes the model from the shared asset cache when another process already imported it */
     NDSCRD std::shared_ptr<Model> LoadModelFromExternalFormat(const std::string &path);
 
+    /* Parses and post-processes the file without touching GL, may be called from any thread */
+    NDSCRD static std::unique_ptr<Assimp::Importer> ImportExternalFormat(const std::string &path);
+
+    /* Creates GPU resources of the imported model, must be called from the thread owning GL context */
+    NDSCRD std::shared_ptr<Model> BuildModelFromImport(const Assimp::Importer &importer, const std::string &path);
+
+    /* Paths of the external material textures BuildModelFromImport will load, touches neither GL nor the members */
+    NDSCRD static std::vector<std::string> GetExternalTexturePaths(
+        const Assimp::Importer &importer, const std::string &path
+    );
+
+    /* Returns the model stored in the shared asset cache, empty when missing, may be called from any thread */
+    NDSCRD static blob_t FindSharedBlob(const std::string &path);
+
+    /* Geometry is uploaded straight from the blob, returns nullptr for the malformed one */
+    NDSCRD std::shared_ptr<Model> LoadModelFromBlob(blob_t blob, const std::string &path);
+
+    /* Grey box of given bounds, box is skipped when bounds are unknown */
+    NDSCRD std::shared_ptr<Model> CreatePlaceholderModel(const BoundingBox *bounds);
+
+    /* Geometry is decoded straight into the mapped GPU buffers, must be called from the thread owning GL context */
     NDSCRD std::shared_ptr<Model> LoadModelFromInternalFormat(const std::string &path);
 
-    NDSCRD std::shared_ptr<Model> DumpModelToInternalFormat(const Model &model, const std::string &path);
+    /* Textures must be registered in the resource manager, those without source file are stored with their pixels */
+    NDSCRD Rc DumpModelToInternalFormat(const Model &model, const std::string &path);
+
+    /* Converts the vertices and flattens the faces of the imported mesh, touches neither GL nor the members */
+    static void ConvertMeshGeometry(const aiMesh *mesh, std::vector<Vertex> &vertices, std::vector<GLuint> &indices);
 
     // ----------------------------------
     // Class implementation methods
@@ -124,6 +244,20 @@ class ModelSerializer
 
     void FallBackNormal(std::vector<std::shared_ptr<Texture>> &textures);
 
+    void RecordTexture_(
+        BlobTextureKind kind, Texture::Type type, const std::string &name, const TextureSpec *raw_spec = nullptr
+    );
+
+    void RecordMesh_(
+        const std::vector<Vertex> &vertices, const std::vector<GLuint> &indices, double shininess, double opacity
+    );
+
+    void StoreSharedBlob_(const std::string &path);
+
+    NDSCRD static bool AppendInternalTexture_(
+        std::vector<std::byte> &content, const Texture &texture, const std::string &name
+    );
+
     // ------------------------------
     // Class fields
     // ------------------------------
@@ -132,6 +266,13 @@ class ModelSerializer
     std::string directory_{};
     std::string full_path_{};
     std::string format_{"unknown"};
+
+    /* blob of the model being imported, textures are recorded before the mesh owning them */
+    bool is_recording_{};
+    std::vector<std::byte> blob_{};
+    std::vector<std::byte> blob_textures_{};
+    uint32_t blob_texture_count_{};
+    uint32_t blob_mesh_count_{};
 };
 
 LIBGCP_DECL_END_
@@ -2,54 +2,221 @@
 
 #include <libcgp/primitives/shader.hpp>
 #include <libcgp/utils/macros.hpp>
+#include <libcgp/utils/program_cache.hpp>
 #include <shaders/static_header.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
-LibGcp::Shader::Shader(const char *vertex_shader_code, const char *fragment_shader_code) noexcept
+LibGcp::Shader::Shader(
+    const char *vertex_shader_code, const char *fragment_shader_code, ProgramCache *cache, shader_defines_t defines,
+    const bool is_async
+) noexcept
+    : defines_(std::move(defines)), cache_(cache)
+{
+    const std::string serialized_defines = SerializeDefines(defines_);
+    const bool use_cache                 = cache_ != nullptr && cache_->IsEnabled();
+
+    if (use_cache) {
+        cache_key_      = cache_->ComputeKey(vertex_shader_code, fragment_shader_code, serialized_defines);
+        shader_program_ = cache_->LoadProgram(cache_key_);
+    }
+
+    if (shader_program_ == 0) {
+        const std::string vertex_code   = InjectDefines_(vertex_shader_code, serialized_defines);
+        const std::string fragment_code = InjectDefines_(fragment_shader_code, serialized_defines);
+
+        pending_ = StartCompilation_(vertex_code.c_str(), fragment_code.c_str(), use_cache);
+
+        /* without the extension status query blocks anyway */
+        if (!is_async || !GLAD_GL_KHR_parallel_shader_compile) {
+            CompletePending_();
+        }
+    } else {
+        TrackProgramSize_();
+    }
+
+    R_ASSERT(is_async || shader_program_ != 0);
+}
+
+LibGcp::Shader::~Shader() noexcept
+{
+    if (pending_.program != 0) {
+        glDeleteShader(pending_.vertex_shader);
+        glDeleteShader(pending_.fragment_shader);
+        glDeleteProgram(pending_.program);
+    }
+
+    if (shader_program_ != 0) {
+        glDeleteProgram(shader_program_);
+        shader_program_ = 0;
+    }
+}
+
+LibGcp::Rc LibGcp::Shader::Recompile(const char *vertex_shader_code, const char *fragment_shader_code) noexcept
+{
+    const std::string serialized_defines = SerializeDefines(defines_);
+    const GLuint shader_program          = CompileProgram_(
+        InjectDefines_(vertex_shader_code, serialized_defines).c_str(),
+        InjectDefines_(fragment_shader_code, serialized_defines).c_str()
+    );
+
+    if (shader_program == 0) {
+        return Rc::kFailedToCompile;
+    }
+
+    glDeleteProgram(shader_program_);
+    shader_program_ = shader_program;
+    TrackProgramSize_();
+
+    return Rc::kSuccess;
+}
+
+bool LibGcp::Shader::IsReady() noexcept
+{
+    if (pending_.program == 0) {
+        return !is_failed_;
+    }
+
+    GLint is_completed = GL_TRUE;
+    glGetProgramiv(pending_.program, GL_COMPLETION_STATUS_KHR, &is_completed);
+
+    if (is_completed == GL_FALSE) {
+        return false;
+    }
+
+    CompletePending_();
+    return !is_failed_;
+}
+
+std::string LibGcp::Shader::SerializeDefines(const shader_defines_t &defines)
+{
+    std::string serialized{};
+
+    for (const auto &[name, value] : defines) {
+        serialized += "#define " + name + " " + value + "\n";
+    }
+
+    return serialized;
+}
+
+std::string LibGcp::Shader::InjectDefines_(const char *shader_code, const std::string &serialized_defines)
+{
+    std::string code(shader_code);
+
+    if (serialized_defines.empty()) {
+        return code;
+    }
+
+    /* version directive must stay the first statement of the shader */
+    size_t insert_pos = 0;
+    if (const size_t version_pos = code.find("#version"); version_pos != std::string::npos) {
+        const size_t line_end = code.find('\n', version_pos);
+
+        if (line_end == std::string::npos) {
+            code += '\n';
+        }
+        insert_pos = line_end == std::string::npos ? code.size() : line_end + 1;
+    }
+
+    code.insert(insert_pos, serialized_defines);
+    return code;
+}
+
+LibGcp::Shader::PendingProgram LibGcp::Shader::StartCompilation_(
+    const char *vertex_shader_code, const char *fragment_shader_code, const bool is_retrievable
+) noexcept
 {
     // Load VertexShader
     const auto vertex_shader = glCreateShader(GL_VERTEX_SHADER);
     glShaderSource(vertex_shader, 1, &vertex_shader_code, nullptr);
     glCompileShader(vertex_shader);
 
-    // Check for shader compile errors
-    ENSURE_SUCCESS_SHADER_OPENGL(vertex_shader);
-
     // Load FragmentShader
     const auto fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
     glShaderSource(fragment_shader, 1, &fragment_shader_code, nullptr);
     glCompileShader(fragment_shader);
 
-    // Check for shader compile errors
-    ENSURE_SUCCESS_SHADER_OPENGL(fragment_shader);
-
     // create shader program
     const auto shader_program = glCreateProgram();
 
     glAttachShader(shader_program, vertex_shader);
     glAttachShader(shader_program, fragment_shader);
+
+    if (is_retrievable) {
+        glProgramParameteri(shader_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    /* link fails on its own when any of the stages failed to compile */
     glLinkProgram(shader_program);
 
+    return {
+        .program         = shader_program,
+        .vertex_shader   = vertex_shader,
+        .fragment_shader = fragment_shader,
+    };
+}
+
+GLuint LibGcp::Shader::FinishCompilation_(const PendingProgram &pending) noexcept
+{
+    // Check for shader compile errors
+    const bool is_compiled =
+        IS_SUCCESS_SHADER_OPENGL(pending.vertex_shader) && IS_SUCCESS_SHADER_OPENGL(pending.fragment_shader);
+
     // Check for linking errors
-    ENSURE_SUCCESS_PROGRAM_OPENGL(shader_program);
+    const bool is_linked = is_compiled && IS_SUCCESS_PROGRAM_OPENGL(pending.program);
 
     // delete shaders
-    glDeleteShader(vertex_shader);
-    glDeleteShader(fragment_shader);
+    glDeleteShader(pending.vertex_shader);
+    glDeleteShader(pending.fragment_shader);
 
-    // store shader program
-    shader_program_ = shader_program;
+    if (!is_linked) {
+        glDeleteProgram(pending.program);
+        return 0;
+    }
+
+    return pending.program;
 }
 
-LibGcp::Shader::~Shader() noexcept
+GLuint LibGcp::Shader::CompileProgram_(
+    const char *vertex_shader_code, const char *fragment_shader_code, const bool is_retrievable
+) noexcept
 {
-    if (shader_program_ != 0) {
-        glDeleteProgram(shader_program_);
-        shader_program_ = 0;
+    return FinishCompilation_(StartCompilation_(vertex_shader_code, fragment_shader_code, is_retrievable));
+}
+
+void LibGcp::Shader::CompletePending_() noexcept
+{
+    shader_program_ = FinishCompilation_(pending_);
+    is_failed_      = shader_program_ == 0;
+    pending_        = {};
+
+    if (is_failed_) {
+        return;
+    }
+
+    TrackProgramSize_();
+    if (cache_ != nullptr && cache_->IsEnabled()) {
+        cache_->StoreProgram(cache_key_, shader_program_);
+    }
+}
+
+void LibGcp::Shader::TrackProgramSize_() noexcept
+{
+    /* binary length is only a proxy of the driver memory, the shaders category is reported as an estimate */
+    GLint binary_length = 0;
+    glGetProgramiv(shader_program_, GL_PROGRAM_BINARY_LENGTH, &binary_length);
+
+    const auto size_bytes = static_cast<size_t>(std::max(binary_length, 0));
+    if (!allocation_.IsRegistered()) {
+        allocation_ = MemoryTracker::Allocation(MemoryTracker::Category::kShaders, size_bytes);
+        return;
     }
+
+    allocation_.Resize(size_bytes);
 }
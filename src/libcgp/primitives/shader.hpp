@@ -7,16 +7,18 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include <libcgp/defines.hpp>
+#include <libcgp/engine/render_stats.hpp>
 #include <libcgp/intf.hpp>
+#include <libcgp/rc.hpp>
+#include <libcgp/utils/hash.hpp>
+#include <libcgp/utils/memory_tracker.hpp>
 
 #include <CxxUtils/instance_counter.hpp>
 
 #include <cassert>
+#include <map>
+#include <string>
 
-/**
- * TODO:
- * - separate compilation from constructor and add return code
- */
 
 // ------------------------------
 // Helper macros
@@ -27,7 +29,7 @@
     {                                                                       \
         const GLint location = glGetUniformLocation(shader_program_, name); \
         assert(!kUniformsDropsWhenNotFound || location != -1);              \
-        UniformFunc(location, value);                                       \
+        GlUniform(UniformFunc, location, value);                            \
     }
 
 #define GENERATE_MATRIX_UNIFORM_SETTER_SAFE_(funcName, TypeName, UniformFunc)             \
@@ -35,7 +37,7 @@
     {                                                                                     \
         const GLint location = glGetUniformLocation(shader_program_, name);               \
         assert(!kUniformsDropsWhenNotFound || location != -1);                            \
-        UniformFunc(location, count, GL_FALSE, glm::value_ptr(values));                   \
+        GlUniform(UniformFunc, location, count, GL_FALSE, glm::value_ptr(values));        \
     }
 
 #define GENERATE_VECTOR_UNIFORM_SETTER_SAFE_(funcName, TypeName, UniformFunc)            \
@@ -43,7 +45,7 @@
     {                                                                                    \
         const GLint location = glGetUniformLocation(shader_program_, name);              \
         assert(!kUniformsDropsWhenNotFound || location != -1);                           \
-        UniformFunc(location, count, glm::value_ptr(value));                             \
+        GlUniform(UniformFunc, location, count, glm::value_ptr(value));                  \
     }
 
 #define GENERATE_UNIFORM_SETTER_(TypeName, UniformFunc) GENERATE_UNIFORM_SETTER_SAFE_(TypeName, UniformFunc)
@@ -55,6 +57,13 @@
     GENERATE_VECTOR_UNIFORM_SETTER_SAFE_(funcName, TypeName, UniformFunc)
 
 LIBGCP_DECL_START_
+
+/* Forward declarations */
+class ProgramCache;
+
+/* Preprocessor definitions injected after the version directive, ordered to keep variant names canonical */
+using shader_defines_t = std::map<std::string, std::string>;
+
 // ------------------------------
 // Shader class
 // ------------------------------
@@ -65,12 +74,26 @@ class Shader : public Resource, public CxxUtils::InstanceCounter<Shader>
     // Inner types
     // ------------------------------
 
+    struct PendingProgram {
+        GLuint program;
+        GLuint vertex_shader;
+        GLuint fragment_shader;
+    };
+
     public:
     // ------------------------------
     // Object creation
     // ------------------------------
 
-    Shader(const char *vertex_shader_code, const char *fragment_shader_code) noexcept;
+    /**
+     * When cache is given, the program is loaded from its binary if possible and stored there otherwise.
+     * Asynchronous shaders are linked by driver threads when GL_KHR_parallel_shader_compile is available,
+     * IsReady must be polled before use and compilation failure is reported through IsFailed instead of aborting.
+     */
+    Shader(
+        const char *vertex_shader_code, const char *fragment_shader_code, ProgramCache *cache = nullptr,
+        shader_defines_t defines = {}, bool is_async = false
+    ) noexcept;
 
     ~Shader() noexcept;
 
@@ -88,10 +111,24 @@ class Shader : public Resource, public CxxUtils::InstanceCounter<Shader>
     // Class interaction
     // ------------------------------
 
-    WRAP_CALL void Activate() const noexcept { glUseProgram(shader_program_); }
+    WRAP_CALL void Activate() const noexcept { GlUseProgram(shader_program_); }
 
     NDSCRD WRAP_CALL GLuint GetProgram() const noexcept { return shader_program_; }
 
+    /* Replaces the program with newly compiled one, on failure the old program stays active */
+    Rc Recompile(const char *vertex_shader_code, const char *fragment_shader_code) noexcept;
+
+    /* Finishes background compilation once the driver is done, never blocks when the extension is present */
+    NDSCRD bool IsReady() noexcept;
+
+    NDSCRD FAST_CALL bool IsFailed() const noexcept { return is_failed_; }
+
+    NDSCRD FAST_CALL const shader_defines_t &GetDefines() const noexcept { return defines_; }
+
+    NDSCRD FAST_CALL bool HasDefine(const std::string &name) const { return defines_.contains(name); }
+
+    NDSCRD static std::string SerializeDefines(const shader_defines_t &defines);
+
     /* simple uniform setters */
     GENERATE_UNIFORM_SETTER_(GLint, glUniform1i)
     GENERATE_UNIFORM_SETTER_(GLfloat, glUniform1f)
@@ -108,11 +145,45 @@ class Shader : public Resource, public CxxUtils::InstanceCounter<Shader>
     GENERATE_VECTOR_UNIFORM_SETTER_(Vec4, glm::vec4, glUniform4fv)
 
     // ------------------------------
-    // Class fields
+    // Class implementation methods
     // ------------------------------
 
     protected:
+    static std::string InjectDefines_(const char *shader_code, const std::string &serialized_defines);
+
+    /* Issues compilation and linking without querying any status, so the driver may process it in background */
+    static PendingProgram StartCompilation_(
+        const char *vertex_shader_code, const char *fragment_shader_code, bool is_retrievable
+    ) noexcept;
+
+    /* Returns 0 on failure, blocks if compilation is still in progress */
+    static GLuint FinishCompilation_(const PendingProgram &pending) noexcept;
+
+    /* Returns 0 on failure */
+    static GLuint CompileProgram_(
+        const char *vertex_shader_code, const char *fragment_shader_code, bool is_retrievable = false
+    ) noexcept;
+
+    /* Stores finished program in the cache and releases the pending state */
+    void CompletePending_() noexcept;
+
+    /* Driver side size of the linked program is approximated by the length of its binary */
+    void TrackProgramSize_() noexcept;
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
     GLuint shader_program_{};
+    shader_defines_t defines_{};
+
+    /* background compilation state */
+    PendingProgram pending_{};
+    ProgramCache *cache_{};
+    Hash128 cache_key_{};
+    bool is_failed_{};
+
+    MemoryTracker::Allocation allocation_{};
 };
 
 LIBGCP_DECL_END_
@@ -35,8 +35,8 @@ class StaticObject
 
     StaticObject &operator=(StaticObject &&) = default;
 
-    StaticObject(const ObjectPosition &position, const std::shared_ptr<Model> &model)
-        : id_(id_counter_.fetch_add(1)), position_(position), model_(model)
+    StaticObject(const ObjectPosition &position, const std::shared_ptr<Model> &model, const bool is_serializable = true)
+        : id_(id_counter_.fetch_add(1)), position_(position), model_(model), is_serializable_(is_serializable)
     {
         TRACE(
             "Created static object at: " << position.position.x << " " << position.position.y << " "
@@ -58,6 +58,12 @@ class StaticObject
 
     NDSCRD FAST_CALL std::shared_ptr<Model> GetModel() const { return model_; }
 
+    /* Avoids reference counting in per-frame loops */
+    NDSCRD FAST_CALL const Model &GetModelRef() const { return *model_; }
+
+    /* Objects owned by streamed world cells are not saved with the scene */
+    NDSCRD FAST_CALL bool IsSerializable() const { return is_serializable_; }
+
     // ------------------------------
     // Class fields
     // ------------------------------
@@ -66,6 +72,7 @@ class StaticObject
     uint64_t id_;
     ObjectPosition position_;
     std::shared_ptr<Model> model_;
+    bool is_serializable_;
 };
 
 LIBGCP_DECL_END_
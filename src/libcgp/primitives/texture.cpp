@@ -1,23 +1,47 @@
 #include <libcgp/primitives/texture.hpp>
 #include <libcgp/utils/macros.hpp>
+#include <libcgp/utils/mip_file.hpp>
 
 #include <glad/gl.h>
 
+#include <algorithm>
 #include <array>
+#include <cassert>
 #include <cstdlib>
 #include <string>
 #include <utility>
 
-LibGcp::Texture::Texture(
-    const unsigned char *texture_data, const int width, const int height, const int channels, const Type type
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static constexpr std::array kDescTable = {
+    0, GL_RED, GL_RG, GL_RGB, GL_RGBA,
+};
+
+static constexpr std::array kSizedDescTable = {
+    0, GL_R8, GL_RG8, GL_RGB8, GL_RGBA8,
+};
+
+L_FAST_CALL void SetupSampling(const int channels) noexcept
+{
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, channels == 4 ? GL_CLAMP_TO_EDGE : GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, channels == 4 ? GL_CLAMP_TO_EDGE : GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::TextureStorage::TextureStorage(
+    const unsigned char *texture_data, const int width, const int height, const int channels
 ) noexcept
-    : type_(type)
+    : width_(width), height_(height), channels_(channels), mip_count_(LibGcp::GetMipCount(width, height))
 {
     R_ASSERT(channels == 3 || channels == 4 || channels == 2 || channels == 1);
 
-    static constexpr std::array kDescTable = {
-        0, GL_RED, GL_RG, GL_RGB, GL_RGBA,
-    };
     const auto format = kDescTable[channels];
 
     GLuint texture_id{};
@@ -26,19 +50,176 @@ LibGcp::Texture::Texture(
     glBindTexture(GL_TEXTURE_2D, texture_id);
     glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, texture_data);
     glGenerateMipmap(GL_TEXTURE_2D);
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, channels == 4 ? GL_CLAMP_TO_EDGE : GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, channels == 4 ? GL_CLAMP_TO_EDGE : GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    SetupSampling(channels);
 
     texture_id_ = texture_id;
+
+    /* full mip chain adds roughly one third of the base level */
+    const size_t size_bytes =
+        static_cast<size_t>(width) * static_cast<size_t>(height) * static_cast<size_t>(channels) * 4 / 3;
+    allocation_ = MemoryTracker::Allocation(MemoryTracker::Category::kTextures, size_bytes);
 }
 
-LibGcp::Texture::~Texture() noexcept
+LibGcp::TextureStorage::TextureStorage(
+    const unsigned char *texture_data, const int width, const int height, const int channels, std::string mip_path
+) noexcept
+    : width_(width),
+      height_(height),
+      channels_(channels),
+      mip_count_(LibGcp::GetMipCount(width, height)),
+      mip_path_(std::move(mip_path))
+{
+    R_ASSERT(channels == 3 || channels == 4 || channels == 2 || channels == 1);
+
+    while (tail_level_ + 1 < mip_count_ &&
+           std::max(GetMipDimension(width_, tail_level_), GetMipDimension(height_, tail_level_)) > kResidentTailSize) {
+        ++tail_level_;
+    }
+
+    /* file written by an earlier load already holds the chain, only the resident tail is read from it */
+    mip_chain_t chain{};
+    if (HasValidMipFile(mip_path_, width, height, channels)) {
+        chain.resize(static_cast<size_t>(mip_count_));
+
+        for (int level = tail_level_; level < mip_count_; ++level) {
+            if (!ReadMipLevel(mip_path_, level, chain[level])) {
+                chain.clear();
+                break;
+            }
+        }
+    }
+
+    if (chain.empty()) {
+        chain = GenerateMipChain(texture_data, width, height, channels);
+
+        if (!WriteMipFile(mip_path_, width, height, channels, chain)) {
+            TRACE("Failed to write mip file: " << mip_path_ << ", texture will be fully resident");
+
+            mip_path_.clear();
+            tail_level_ = 0;
+        }
+    }
+
+    texture_id_      = AllocateLevels_(tail_level_);
+    allocated_level_ = tail_level_;
+    resident_level_  = tail_level_;
+
+    for (int level = tail_level_; level < mip_count_; ++level) {
+        UploadLevelRows(level, 0, GetMipDimension(height_, level), chain[level].data());
+    }
+
+    UpdateSizeBytes_();
+}
+
+LibGcp::TextureStorage::~TextureStorage() noexcept
 {
     if (texture_id_ != 0) {
         glDeleteTextures(1, &texture_id_);
         texture_id_ = 0;
     }
 }
+
+void LibGcp::TextureStorage::ResizeToLevel(int top_level) noexcept
+{
+    top_level = std::clamp(top_level, 0, tail_level_);
+
+    if (!IsStreamed() || top_level == allocated_level_) {
+        return;
+    }
+
+    const GLuint texture_id = AllocateLevels_(top_level);
+    const int first_kept    = std::max(top_level, resident_level_);
+
+    for (int level = first_kept; level < mip_count_; ++level) {
+        glCopyImageSubData(
+            texture_id_, GL_TEXTURE_2D, level - allocated_level_, 0, 0, 0, texture_id, GL_TEXTURE_2D, level - top_level,
+            0, 0, 0, GetMipDimension(width_, level), GetMipDimension(height_, level), 1
+        );
+    }
+
+    glDeleteTextures(1, &texture_id_);
+
+    texture_id_      = texture_id;
+    allocated_level_ = top_level;
+    resident_level_  = first_kept;
+
+    /* levels without pixels yet must not be sampled */
+    glBindTexture(GL_TEXTURE_2D, texture_id_);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, resident_level_ - allocated_level_);
+
+    UpdateSizeBytes_();
+}
+
+void LibGcp::TextureStorage::UploadLevelRows(
+    const int level, const int row_begin, const int row_end, const unsigned char *level_data
+) noexcept
+{
+    assert(level >= allocated_level_ && level < mip_count_);
+    assert(row_begin >= 0 && row_begin <= row_end && row_end <= GetMipDimension(height_, level));
+
+    const int level_width = GetMipDimension(width_, level);
+    const size_t offset   = static_cast<size_t>(row_begin) * static_cast<size_t>(level_width) * channels_;
+
+    glBindTexture(GL_TEXTURE_2D, texture_id_);
+
+    /* rows of odd sized levels are not 4 byte aligned */
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(
+        GL_TEXTURE_2D, level - allocated_level_, 0, row_begin, level_width, row_end - row_begin, kDescTable[channels_],
+        GL_UNSIGNED_BYTE, level_data + offset
+    );
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+void LibGcp::TextureStorage::CommitLevel(const int level) noexcept
+{
+    assert(level == resident_level_ - 1 && level >= allocated_level_);
+
+    resident_level_ = level;
+
+    glBindTexture(GL_TEXTURE_2D, texture_id_);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, resident_level_ - allocated_level_);
+}
+
+GLuint LibGcp::TextureStorage::AllocateLevels_(const int top_level) const noexcept
+{
+    GLuint texture_id{};
+
+    glGenTextures(1, &texture_id);
+    glBindTexture(GL_TEXTURE_2D, texture_id);
+    glTexStorage2D(
+        GL_TEXTURE_2D, mip_count_ - top_level, kSizedDescTable[channels_], GetMipDimension(width_, top_level),
+        GetMipDimension(height_, top_level)
+    );
+    SetupSampling(channels_);
+
+    return texture_id;
+}
+
+void LibGcp::TextureStorage::UpdateSizeBytes_() noexcept
+{
+    size_t size_bytes = 0;
+    for (int level = allocated_level_; level < mip_count_; ++level) {
+        size_bytes += GetMipSizeBytes(width_, height_, channels_, level);
+    }
+
+    if (!allocation_.IsRegistered()) {
+        allocation_ = MemoryTracker::Allocation(MemoryTracker::Category::kTextures, size_bytes);
+        return;
+    }
+
+    allocation_.Resize(size_bytes);
+}
+
+LibGcp::Texture::Texture(
+    const unsigned char *texture_data, const int width, const int height, const int channels, const Type type
+) noexcept
+    : storage_(std::make_shared<TextureStorage>(texture_data, width, height, channels)), type_(type)
+{
+}
+
+LibGcp::Texture::Texture(std::shared_ptr<TextureStorage> storage, const Type type) noexcept
+    : storage_(std::move(storage)), type_(type)
+{
+    assert(storage_ != nullptr);
+}
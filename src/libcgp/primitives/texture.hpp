@@ -9,9 +9,112 @@
 #include <unordered_map>
 
 #include <libcgp/defines.hpp>
+#include <libcgp/engine/render_stats.hpp>
 #include <libcgp/intf.hpp>
+#include <libcgp/utils/memory_tracker.hpp>
 
 LIBGCP_DECL_START_
+// ------------------------------
+// Texture storage class
+// ------------------------------
+
+/* GPU side of the texture, shared between all textures with identical pixel payload */
+class TextureStorage
+{
+    public:
+    /* Streamed storages never drop below the level of this size */
+    static constexpr int kResidentTailSize = 64;
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    TextureStorage(const unsigned char *texture_data, int width, int height, int channels) noexcept;
+
+    /**
+     * Streamed storage: whole mip chain is saved to the mip file and only the low resolution tail stays resident.
+     * Finer levels are uploaded later on demand. When the file cannot be written all levels are uploaded instead.
+     */
+    TextureStorage(
+        const unsigned char *texture_data, int width, int height, int channels, std::string mip_path
+    ) noexcept;
+
+    ~TextureStorage() noexcept;
+
+    TextureStorage(const TextureStorage &) = delete;
+
+    TextureStorage &operator=(const TextureStorage &) = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    NDSCRD FAST_CALL GLuint GetTextureId() const noexcept { return texture_id_; }
+
+    /* Approximate size including the mip chain */
+    NDSCRD FAST_CALL size_t GetSizeBytes() const noexcept { return allocation_.GetBytes(); }
+
+    NDSCRD FAST_CALL bool IsStreamed() const noexcept { return !mip_path_.empty(); }
+
+    NDSCRD FAST_CALL const std::string &GetMipPath() const noexcept { return mip_path_; }
+
+    NDSCRD FAST_CALL int GetWidth() const noexcept { return width_; }
+
+    NDSCRD FAST_CALL int GetHeight() const noexcept { return height_; }
+
+    NDSCRD FAST_CALL int GetChannels() const noexcept { return channels_; }
+
+    NDSCRD FAST_CALL int GetMipCount() const noexcept { return mip_count_; }
+
+    /* Most detailed level available for sampling */
+    NDSCRD FAST_CALL int GetResidentLevel() const noexcept { return resident_level_; }
+
+    /* Most detailed level with allocated memory, may still wait for its pixels */
+    NDSCRD FAST_CALL int GetAllocatedLevel() const noexcept { return allocated_level_; }
+
+    NDSCRD FAST_CALL int GetTailLevel() const noexcept { return tail_level_; }
+
+    /**
+     * Reallocates the texture so that levels from top_level down to the smallest one exist.
+     * Resident levels shared by both allocations are copied on the GPU, new levels stay hidden until committed.
+     * Changes the texture id.
+     */
+    void ResizeToLevel(int top_level) noexcept;
+
+    /* Uploads rows [row_begin, row_end) of an allocated level, data points to the whole level */
+    void UploadLevelRows(int level, int row_begin, int row_end, const unsigned char *level_data) noexcept;
+
+    /* Makes fully uploaded level, directly above the resident one, available for sampling */
+    void CommitLevel(int level) noexcept;
+
+    // ------------------------------
+    // Class implementation methods
+    // ------------------------------
+
+    protected:
+    NDSCRD GLuint AllocateLevels_(int top_level) const noexcept;
+
+    void UpdateSizeBytes_() noexcept;
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    GLuint texture_id_{};
+
+    /* owned by the resource which created the storage first, shared holders are not counted again */
+    MemoryTracker::Allocation allocation_{};
+
+    int width_{};
+    int height_{};
+    int channels_{};
+    int mip_count_{};
+    int tail_level_{};
+    int allocated_level_{};
+    int resident_level_{};
+    std::string mip_path_{};
+};
+
 // ------------------------------
 // Texture class
 // ------------------------------
@@ -42,7 +145,9 @@ class Texture : public Resource
 
     Texture(const unsigned char *texture_data, int width, int height, int channels, Type type) noexcept;
 
-    ~Texture() noexcept;
+    Texture(std::shared_ptr<TextureStorage> storage, Type type) noexcept;
+
+    ~Texture() noexcept = default;
 
     /* prohibit copying */
     Texture(const Texture &) = delete;
@@ -58,16 +163,21 @@ class Texture : public Resource
     // Class interaction
     // ------------------------------
 
-    NDSCRD FAST_CALL GLuint GetTextureId() const noexcept { return texture_id_; }
+    NDSCRD FAST_CALL GLuint GetTextureId() const noexcept { return storage_->GetTextureId(); }
+
+    NDSCRD FAST_CALL const std::shared_ptr<TextureStorage> &GetStorage() const noexcept { return storage_; }
 
     NDSCRD FAST_CALL Type GetType() const noexcept { return type_; }
 
     FAST_CALL void SetType(const Type type) noexcept { type_ = type; }
 
+    /* Replaces GPU side of the texture, all holders observe the new storage */
+    FAST_CALL void SwapStorage(std::shared_ptr<TextureStorage> storage) noexcept { storage_ = std::move(storage); }
+
     FAST_CALL void Bind(const int texture_unit) const noexcept
     {
         glActiveTexture(GL_TEXTURE0 + texture_unit);
-        glBindTexture(GL_TEXTURE_2D, texture_id_);
+        GlBindTexture(GL_TEXTURE_2D, storage_->GetTextureId());
     }
 
     // ------------------------------
@@ -75,7 +185,7 @@ class Texture : public Resource
     // ------------------------------
 
     protected:
-    GLuint texture_id_{};
+    std::shared_ptr<TextureStorage> storage_{};
     Type type_{};
 };
 
@@ -21,6 +21,8 @@ enum class Rc {
     kOutdatedProtocol,
     kTooOldSoftware,
     kCorruptedFile,
+    kFailedToCompile,
+    kInvalidArgument,
     kLast,
 };
 
@@ -38,6 +40,8 @@ static constexpr std::array kRcDescriptions{
     "Too old data format to process",
     "Version of the program is too old",
     "Corrupted file",
+    "Failed to compile",
+    "Invalid argument",
 };
 
 static_assert(kRcDescriptions.size() == static_cast<size_t>(Rc::kLast), "Rc descriptions list is incomplete");
@@ -0,0 +1,350 @@
+#include <libcgp/serialization/mesh_codec.hpp>
+#include <libcgp/utils/chunk_codec.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+/* Components of the vertex, each one is stored as a separate stream */
+enum Stream : size_t {
+    kPositionX,
+    kPositionY,
+    kPositionZ,
+    kNormalU,
+    kNormalV,
+    kTexCoordU,
+    kTexCoordV,
+    kTangentU,
+    kTangentV,
+    kStreamCount,
+};
+
+static constexpr size_t kDecodeBatch      = 256;
+static constexpr float kQuantizationSteps = 65535.0f;
+static constexpr float kSnormSteps        = 32767.0f;
+static constexpr uint32_t kUnusedVertex   = std::numeric_limits<uint32_t>::max();
+
+L_FAST_CALL uint16_t Quantize(const float value, const float min, const float extent) noexcept
+{
+    if (extent <= 0.0f) {
+        return 0;
+    }
+
+    const float normalized = std::clamp((value - min) / extent, 0.0f, 1.0f);
+    return static_cast<uint16_t>(std::lround(normalized * kQuantizationSteps));
+}
+
+L_FAST_CALL uint16_t QuantizeSnorm(const float value) noexcept
+{
+    const auto quantized = static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * kSnormSteps));
+    return static_cast<uint16_t>(quantized);
+}
+
+/* Projects the unit vector on the octahedron and unfolds its lower half onto the plane */
+L_FAST_CALL void EncodeOctahedral(const glm::vec3 &vector, uint16_t &u, uint16_t &v) noexcept
+{
+    const float length = std::abs(vector.x) + std::abs(vector.y) + std::abs(vector.z);
+    if (length <= 0.0f) {
+        u = QuantizeSnorm(0.0f);
+        v = QuantizeSnorm(0.0f);
+        return;
+    }
+
+    float x = vector.x / length;
+    float y = vector.y / length;
+
+    if (vector.z < 0.0f) {
+        const float folded_x = (1.0f - std::abs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        const float folded_y = (1.0f - std::abs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+
+        x = folded_x;
+        y = folded_y;
+    }
+
+    u = QuantizeSnorm(x);
+    v = QuantizeSnorm(y);
+}
+
+L_FAST_CALL uint16_t ZigZag16(const uint16_t delta) noexcept
+{
+    const auto value = static_cast<int16_t>(delta);
+    return static_cast<uint16_t>((static_cast<uint16_t>(value) << 1) ^ static_cast<uint16_t>(value >> 15));
+}
+
+L_FAST_CALL uint16_t UnZigZag16(const uint16_t value) noexcept
+{
+    return static_cast<uint16_t>((value >> 1) ^ static_cast<uint16_t>(-(value & 1)));
+}
+
+L_FAST_CALL uint32_t ZigZag32(const uint32_t delta) noexcept
+{
+    const auto value = static_cast<int32_t>(delta);
+    return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+}
+
+L_FAST_CALL uint32_t UnZigZag32(const uint32_t value) noexcept { return (value >> 1) ^ (0u - (value & 1)); }
+
+/* Loops below work on contiguous arrays without branches, so they are vectorized by the compiler */
+static void DequantizeBatch(
+    const uint16_t *quantized, const size_t count, const float min, const float extent, float *out
+) noexcept
+{
+    const float scale = extent / kQuantizationSteps;
+
+    for (size_t idx = 0; idx < count; ++idx) {
+        out[idx] = min + static_cast<float>(quantized[idx]) * scale;
+    }
+}
+
+static void DecodeOctahedralBatch(
+    const uint16_t *u, const uint16_t *v, const size_t count, float (*out)[kDecodeBatch]
+) noexcept
+{
+    for (size_t idx = 0; idx < count; ++idx) {
+        float x       = std::max(static_cast<float>(static_cast<int16_t>(u[idx])) / kSnormSteps, -1.0f);
+        float y       = std::max(static_cast<float>(static_cast<int16_t>(v[idx])) / kSnormSteps, -1.0f);
+        const float z = 1.0f - std::abs(x) - std::abs(y);
+
+        /* folds the lower half back */
+        const float fold = std::max(-z, 0.0f);
+        x += x >= 0.0f ? -fold : fold;
+        y += y >= 0.0f ? -fold : fold;
+
+        const float inv_length = 1.0f / std::sqrt(x * x + y * y + z * z);
+        out[0][idx]            = x * inv_length;
+        out[1][idx]            = y * inv_length;
+        out[2][idx]            = z * inv_length;
+    }
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+std::vector<std::byte> LibGcp::MeshCodec::Encode(
+    const std::span<const Vertex> vertices, const std::span<const GLuint> indices
+)
+{
+    const size_t count = vertices.size();
+
+    /* vertices in order of the first use, unused ones at the end */
+    std::vector<uint32_t> remap(count, kUnusedVertex);
+    std::vector<uint32_t> order{};
+    order.reserve(count);
+
+    for (const GLuint index : indices) {
+        if (index >= count) {
+            return {};
+        }
+
+        if (remap[index] == kUnusedVertex) {
+            remap[index] = static_cast<uint32_t>(order.size());
+            order.push_back(index);
+        }
+    }
+
+    for (uint32_t idx = 0; idx < count; ++idx) {
+        if (remap[idx] == kUnusedVertex) {
+            remap[idx] = static_cast<uint32_t>(order.size());
+            order.push_back(idx);
+        }
+    }
+
+    BoundingBox position_bounds{};
+    glm::vec2 uv_min{};
+    glm::vec2 uv_max{};
+
+    if (count > 0) {
+        position_bounds = {vertices[0].position, vertices[0].position};
+        uv_min          = vertices[0].tex_coords;
+        uv_max          = vertices[0].tex_coords;
+    }
+
+    for (const auto &vertex : vertices) {
+        position_bounds.Extend({vertex.position, vertex.position});
+        uv_min = {std::min(uv_min.x, vertex.tex_coords.x), std::min(uv_min.y, vertex.tex_coords.y)};
+        uv_max = {std::max(uv_max.x, vertex.tex_coords.x), std::max(uv_max.y, vertex.tex_coords.y)};
+    }
+
+    Header header{
+        .magic              = kMagic,
+        .version            = kVersion,
+        .vertex_count       = count,
+        .index_count        = indices.size(),
+        .position_min       = {position_bounds.min.x, position_bounds.min.y, position_bounds.min.z},
+        .position_extent    = {},
+        .uv_min             = {uv_min.x, uv_min.y},
+        .uv_extent          = {uv_max.x - uv_min.x, uv_max.y - uv_min.y},
+        .vertex_stream_size = 0,
+        .index_stream_size  = 0,
+    };
+
+    for (int axis = 0; axis < 3; ++axis) {
+        header.position_extent[axis] = position_bounds.max[axis] - position_bounds.min[axis];
+    }
+
+    /* quantize into the streams */
+    std::vector<uint16_t> streams(kStreamCount * count);
+    const auto stream = [&](const Stream component) {
+        return streams.data() + component * count;
+    };
+
+    for (size_t idx = 0; idx < count; ++idx) {
+        const Vertex &vertex = vertices[order[idx]];
+
+        for (int axis = 0; axis < 3; ++axis) {
+            stream(static_cast<Stream>(kPositionX + axis))[idx] =
+                Quantize(vertex.position[axis], header.position_min[axis], header.position_extent[axis]);
+        }
+
+        stream(kTexCoordU)[idx] = Quantize(vertex.tex_coords.x, header.uv_min[0], header.uv_extent[0]);
+        stream(kTexCoordV)[idx] = Quantize(vertex.tex_coords.y, header.uv_min[1], header.uv_extent[1]);
+
+        EncodeOctahedral(vertex.normal, stream(kNormalU)[idx], stream(kNormalV)[idx]);
+        EncodeOctahedral(vertex.tangent, stream(kTangentU)[idx], stream(kTangentV)[idx]);
+    }
+
+    for (size_t component = 0; component < kStreamCount; ++component) {
+        uint16_t *values = streams.data() + component * count;
+        uint16_t prev    = 0;
+
+        for (size_t idx = 0; idx < count; ++idx) {
+            const uint16_t value = values[idx];
+            values[idx]          = ZigZag16(static_cast<uint16_t>(value - prev));
+            prev                 = value;
+        }
+    }
+
+    std::vector<uint32_t> index_codes(indices.size());
+    uint32_t prev_index = 0;
+    for (size_t idx = 0; idx < indices.size(); ++idx) {
+        const uint32_t index = remap[indices[idx]];
+        index_codes[idx]     = ZigZag32(index - prev_index);
+        prev_index           = index;
+    }
+
+    const auto vertex_stream =
+        ChunkCodec::Encode(std::as_bytes(std::span(streams)), ChunkCodec::Filter::kShuffle, sizeof(uint16_t));
+    const auto index_stream =
+        ChunkCodec::Encode(std::as_bytes(std::span(index_codes)), ChunkCodec::Filter::kShuffle, sizeof(uint32_t));
+
+    header.vertex_stream_size = vertex_stream.size();
+    header.index_stream_size  = index_stream.size();
+
+    std::vector<std::byte> encoded(sizeof(Header));
+    std::memcpy(encoded.data(), &header, sizeof(Header));
+    encoded.insert(encoded.end(), vertex_stream.begin(), vertex_stream.end());
+    encoded.insert(encoded.end(), index_stream.begin(), index_stream.end());
+
+    return encoded;
+}
+
+bool LibGcp::MeshCodec::ReadHeader(const std::span<const std::byte> encoded, Header &out) noexcept
+{
+    if (encoded.size() < sizeof(Header)) {
+        return false;
+    }
+    std::memcpy(&out, encoded.data(), sizeof(Header));
+
+    const size_t streams_size = encoded.size() - sizeof(Header);
+    return out.magic == kMagic && out.version == kVersion && out.vertex_stream_size <= streams_size &&
+           out.index_stream_size == streams_size - out.vertex_stream_size;
+}
+
+LibGcp::BoundingBox LibGcp::MeshCodec::GetBoundingBox(const Header &header) noexcept
+{
+    const glm::vec3 min{header.position_min[0], header.position_min[1], header.position_min[2]};
+    const glm::vec3 extent{header.position_extent[0], header.position_extent[1], header.position_extent[2]};
+
+    return {min, min + extent};
+}
+
+bool LibGcp::MeshCodec::Decode(
+    const std::span<const std::byte> encoded, const std::span<Vertex> vertices, const std::span<GLuint> indices
+)
+{
+    Header header{};
+    if (!ReadHeader(encoded, header) || vertices.size() != header.vertex_count ||
+        indices.size() != header.index_count) {
+        return false;
+    }
+
+    const size_t count      = header.vertex_count;
+    const auto vertex_chunk = encoded.subspan(sizeof(Header), header.vertex_stream_size);
+    const auto index_chunk  = encoded.subspan(sizeof(Header) + header.vertex_stream_size);
+
+    /* mapped memory is slow to read, so deltas are resolved before anything is written to the output */
+    std::vector<uint16_t> streams(kStreamCount * count);
+    std::vector<uint32_t> index_codes(indices.size());
+
+    if (count > 0 && !ChunkCodec::Decode(vertex_chunk, std::as_writable_bytes(std::span(streams)))) {
+        return false;
+    }
+
+    if (!indices.empty() && !ChunkCodec::Decode(index_chunk, std::as_writable_bytes(std::span(index_codes)))) {
+        return false;
+    }
+
+    for (size_t component = 0; component < kStreamCount; ++component) {
+        uint16_t *values = streams.data() + component * count;
+        uint16_t prev    = 0;
+
+        for (size_t idx = 0; idx < count; ++idx) {
+            prev        = static_cast<uint16_t>(prev + UnZigZag16(values[idx]));
+            values[idx] = prev;
+        }
+    }
+
+    uint32_t prev_index = 0;
+    for (auto &code : index_codes) {
+        prev_index += UnZigZag32(code);
+        if (prev_index >= count) {
+            return false;
+        }
+
+        code = prev_index;
+    }
+
+    const auto stream = [&](const Stream component) {
+        return streams.data() + component * count;
+    };
+
+    float positions[3][kDecodeBatch];
+    float normals[3][kDecodeBatch];
+    float tangents[3][kDecodeBatch];
+    float tex_coords[2][kDecodeBatch];
+
+    for (size_t base = 0; base < count; base += kDecodeBatch) {
+        const size_t batch = std::min(kDecodeBatch, count - base);
+
+        for (int axis = 0; axis < 3; ++axis) {
+            DequantizeBatch(
+                stream(static_cast<Stream>(kPositionX + axis)) + base, batch, header.position_min[axis],
+                header.position_extent[axis], positions[axis]
+            );
+        }
+
+        DequantizeBatch(stream(kTexCoordU) + base, batch, header.uv_min[0], header.uv_extent[0], tex_coords[0]);
+        DequantizeBatch(stream(kTexCoordV) + base, batch, header.uv_min[1], header.uv_extent[1], tex_coords[1]);
+        DecodeOctahedralBatch(stream(kNormalU) + base, stream(kNormalV) + base, batch, normals);
+        DecodeOctahedralBatch(stream(kTangentU) + base, stream(kTangentV) + base, batch, tangents);
+
+        for (size_t idx = 0; idx < batch; ++idx) {
+            vertices[base + idx] = {
+                .position   = {positions[0][idx], positions[1][idx], positions[2][idx]},
+                .normal     = {normals[0][idx], normals[1][idx], normals[2][idx]},
+                .tex_coords = {tex_coords[0][idx], tex_coords[1][idx]},
+                .tangent    = {tangents[0][idx], tangents[1][idx], tangents[2][idx]},
+            };
+        }
+    }
+
+    std::memcpy(indices.data(), index_codes.data(), indices.size_bytes());
+    return true;
+}
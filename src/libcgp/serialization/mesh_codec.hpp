@@ -0,0 +1,78 @@
+#ifndef SERIALIZATION_MESH_CODEC_HPP_
+#define SERIALIZATION_MESH_CODEC_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/intf.hpp>
+
+#include <glad/gl.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+LIBGCP_DECL_START_
+/**
+ * Geometry specific encoding of the mesh used by the internal model format.
+ * Vertices are reordered by their first use in the index buffer, so both streams follow the order of drawing:
+ *  - positions and texture coordinates are quantized to 16 bits over the mesh bounds,
+ *  - normals and tangents are stored in octahedral mapping with two 16-bit components,
+ *  - every component is a separate stream of zigzag encoded deltas from the previous vertex,
+ *  - indices are zigzag encoded deltas from the previous index.
+ * Both streams are then compressed with ChunkCodec using the shuffle filter.
+ *
+ * Decoding dequantizes in batches over contiguous component arrays, which the compiler vectorizes,
+ * and writes the vertices in order, so the output may be a mapped GPU buffer.
+ *
+ * Layout:
+ *  Header, vertex stream chunk, index stream chunk
+ */
+class MeshCodec
+{
+    static constexpr uint32_t kMagic   = 0x4853454D;
+    static constexpr uint32_t kVersion = 1;
+
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    struct PACK Header {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t vertex_count;
+        uint64_t index_count;
+        float position_min[3];
+        float position_extent[3];
+        float uv_min[2];
+        float uv_extent[2];
+        uint64_t vertex_stream_size;
+        uint64_t index_stream_size;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    MeshCodec() = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    NDSCRD static std::vector<std::byte> Encode(std::span<const Vertex> vertices, std::span<const GLuint> indices);
+
+    /* Fails when the header does not describe the whole encoded mesh */
+    NDSCRD static bool ReadHeader(std::span<const std::byte> encoded, Header &out) noexcept;
+
+    NDSCRD static BoundingBox GetBoundingBox(const Header &header) noexcept;
+
+    /* Outputs must match the counts from the header, they are written only sequentially */
+    NDSCRD static bool Decode(
+        std::span<const std::byte> encoded, std::span<Vertex> vertices, std::span<GLuint> indices
+    );
+};
+
+LIBGCP_DECL_END_
+
+#endif  // SERIALIZATION_MESH_CODEC_HPP_
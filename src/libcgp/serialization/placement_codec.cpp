@@ -0,0 +1,339 @@
+#include <libcgp/serialization/placement_codec.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <tuple>
+#include <vector>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static constexpr size_t kMinPlacementBytes = 4;
+static constexpr size_t kPrefabBytes       = 1 + 6 * sizeof(float);
+
+/* Placement ready to be written, sorted by cell first so that deltas stay small */
+struct QuantizedPlacement {
+    int32_t cell[3];
+    uint32_t prefab;
+    int32_t steps[3];
+
+    NDSCRD auto GetOrder() const noexcept
+    {
+        return std::tie(cell[0], cell[1], cell[2], prefab, steps[0], steps[1], steps[2]);
+    }
+};
+
+L_FAST_CALL bool IsSameCell(const QuantizedPlacement &lhs, const QuantizedPlacement &rhs) noexcept
+{
+    return lhs.cell[0] == rhs.cell[0] && lhs.cell[1] == rhs.cell[1] && lhs.cell[2] == rhs.cell[2];
+}
+
+L_FAST_CALL uint64_t ZigZag(const int64_t value) noexcept
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+L_FAST_CALL int64_t UnZigZag(const uint64_t value) noexcept
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+L_FAST_CALL void WriteVarint(std::vector<std::byte> &out, uint64_t value)
+{
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::byte>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::byte>(value));
+}
+
+L_FAST_CALL void WriteFloat(std::vector<std::byte> &out, const float value)
+{
+    std::byte bytes[sizeof(float)];
+    std::memcpy(bytes, &value, sizeof(float));
+    out.insert(out.end(), std::begin(bytes), std::end(bytes));
+}
+
+/* Bounds checked cursor over the stream */
+class StreamReader
+{
+    public:
+    explicit StreamReader(const std::span<const std::byte> stream) : stream_(stream) {}
+
+    NDSCRD bool ReadVarint(uint64_t &out) noexcept
+    {
+        out = 0;
+        for (uint32_t shift = 0; shift < 64 && offset_ < stream_.size(); shift += 7) {
+            const auto byte = static_cast<uint64_t>(stream_[offset_++]);
+            out |= (byte & 0x7F) << shift;
+
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    NDSCRD bool ReadSigned(int64_t &out) noexcept
+    {
+        uint64_t value;
+        if (!ReadVarint(value)) {
+            return false;
+        }
+
+        out = UnZigZag(value);
+        return true;
+    }
+
+    NDSCRD bool ReadFloat(float &out) noexcept
+    {
+        if (GetRemaining() < sizeof(float)) {
+            return false;
+        }
+
+        std::memcpy(&out, stream_.data() + offset_, sizeof(float));
+        offset_ += sizeof(float);
+        return true;
+    }
+
+    NDSCRD size_t GetRemaining() const noexcept { return stream_.size() - offset_; }
+
+    private:
+    std::span<const std::byte> stream_;
+    size_t offset_{};
+};
+
+/* Kept as a plain loop over contiguous arrays, so it is vectorized by the compiler */
+static void ExpandAxis(
+    const std::vector<float> &origins, const std::vector<int32_t> &steps, std::vector<float> &out
+) noexcept
+{
+    const size_t count  = steps.size();
+    const float *origin = origins.data();
+    const int32_t *step = steps.data();
+    float *result       = out.data();
+
+    for (size_t idx = 0; idx < count; ++idx) {
+        result[idx] = origin[idx] + static_cast<float>(step[idx]) * LibGcp::PlacementCodec::kPositionStep;
+    }
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+std::vector<std::byte> LibGcp::PlacementCodec::Encode(const std::span<const Placement> placements)
+{
+    using PrefabKey = std::tuple<size_t, float, float, float, float, float, float>;
+
+    std::map<PrefabKey, uint32_t> prefab_ids{};
+    std::vector<const Placement *> prefabs{};
+    std::vector<QuantizedPlacement> quantized{};
+    quantized.reserve(placements.size());
+
+    for (const auto &placement : placements) {
+        const auto &[position, rotation, scale] = placement.position;
+
+        const PrefabKey key{placement.name, rotation.x, rotation.y, rotation.z, scale.x, scale.y, scale.z};
+        const auto [it, inserted] = prefab_ids.try_emplace(key, static_cast<uint32_t>(prefabs.size()));
+        if (inserted) {
+            prefabs.push_back(&placement);
+        }
+
+        QuantizedPlacement entry{};
+        entry.prefab = it->second;
+
+        for (int axis = 0; axis < 3; ++axis) {
+            const float cell = std::floor(position[axis] / kCellSize);
+            const auto steps = static_cast<int64_t>(std::lround((position[axis] - cell * kCellSize) / kPositionStep));
+
+            /* rounding may reach the next cell */
+            entry.cell[axis]  = static_cast<int32_t>(cell);
+            entry.steps[axis] = static_cast<int32_t>(std::clamp<int64_t>(steps, 0, kCellSteps - 1));
+        }
+
+        quantized.push_back(entry);
+    }
+
+    std::ranges::sort(quantized, [](const QuantizedPlacement &lhs, const QuantizedPlacement &rhs) {
+        return lhs.GetOrder() < rhs.GetOrder();
+    });
+
+    std::vector<std::byte> stream{};
+    stream.reserve(prefabs.size() * kPrefabBytes + quantized.size() * kMinPlacementBytes);
+
+    WriteVarint(stream, prefabs.size());
+    for (const auto *prefab : prefabs) {
+        WriteVarint(stream, prefab->name);
+
+        for (int axis = 0; axis < 3; ++axis) {
+            WriteFloat(stream, prefab->position.rotation[axis]);
+        }
+
+        for (int axis = 0; axis < 3; ++axis) {
+            WriteFloat(stream, prefab->position.scale[axis]);
+        }
+    }
+
+    /* count cells up front */
+    size_t num_cells = 0;
+    for (size_t idx = 0; idx < quantized.size(); ++idx) {
+        if (idx == 0 || !IsSameCell(quantized[idx], quantized[idx - 1])) {
+            ++num_cells;
+        }
+    }
+    WriteVarint(stream, num_cells);
+
+    int32_t prev_cell[3]{};
+    for (size_t begin = 0; begin < quantized.size();) {
+        size_t end = begin + 1;
+        while (end < quantized.size() && IsSameCell(quantized[end], quantized[begin])) {
+            ++end;
+        }
+
+        for (int axis = 0; axis < 3; ++axis) {
+            WriteVarint(stream, ZigZag(static_cast<int64_t>(quantized[begin].cell[axis]) - prev_cell[axis]));
+            prev_cell[axis] = quantized[begin].cell[axis];
+        }
+        WriteVarint(stream, end - begin);
+
+        /* x grows within the prefab, so its delta is unsigned */
+        uint32_t prev_prefab = 0;
+        int32_t prev_steps[3]{};
+        for (size_t idx = begin; idx < end; ++idx) {
+            const auto &entry = quantized[idx];
+
+            if (entry.prefab != prev_prefab) {
+                prev_steps[0] = 0;
+            }
+
+            WriteVarint(stream, entry.prefab - prev_prefab);
+            WriteVarint(stream, static_cast<uint64_t>(entry.steps[0] - prev_steps[0]));
+            WriteVarint(stream, ZigZag(entry.steps[1] - prev_steps[1]));
+            WriteVarint(stream, ZigZag(entry.steps[2] - prev_steps[2]));
+
+            prev_prefab = entry.prefab;
+            std::memcpy(prev_steps, entry.steps, sizeof(prev_steps));
+        }
+
+        begin = end;
+    }
+
+    return stream;
+}
+
+bool LibGcp::PlacementCodec::Decode(const std::span<const std::byte> stream, std::vector<Placement> &out)
+{
+    StreamReader reader(stream);
+
+    uint64_t num_prefabs;
+    if (!reader.ReadVarint(num_prefabs) || num_prefabs > reader.GetRemaining() / kPrefabBytes) {
+        return false;
+    }
+
+    std::vector<Placement> prefabs(num_prefabs);
+    for (auto &prefab : prefabs) {
+        uint64_t name;
+        if (!reader.ReadVarint(name)) {
+            return false;
+        }
+        prefab.name = name;
+
+        for (int axis = 0; axis < 3; ++axis) {
+            if (!reader.ReadFloat(prefab.position.rotation[axis])) {
+                return false;
+            }
+        }
+
+        for (int axis = 0; axis < 3; ++axis) {
+            if (!reader.ReadFloat(prefab.position.scale[axis])) {
+                return false;
+            }
+        }
+    }
+
+    uint64_t num_cells;
+    if (!reader.ReadVarint(num_cells)) {
+        return false;
+    }
+
+    /* varints are decoded first, positions are expanded afterward in one pass per axis */
+    std::vector<uint32_t> prefab_ids{};
+    std::array<std::vector<int32_t>, 3> steps{};
+    std::array<std::vector<float>, 3> origins{};
+
+    int64_t cell[3]{};
+    for (uint64_t cell_idx = 0; cell_idx < num_cells; ++cell_idx) {
+        uint64_t num_placements;
+
+        for (auto &coord : cell) {
+            int64_t delta;
+            if (!reader.ReadSigned(delta)) {
+                return false;
+            }
+            coord += delta;
+        }
+
+        if (!reader.ReadVarint(num_placements) || num_placements > reader.GetRemaining() / kMinPlacementBytes) {
+            return false;
+        }
+
+        uint64_t prefab = 0;
+        int64_t prev_steps[3]{};
+        for (uint64_t idx = 0; idx < num_placements; ++idx) {
+            uint64_t prefab_delta;
+            uint64_t x_delta;
+            int64_t y_delta;
+            int64_t z_delta;
+
+            if (!reader.ReadVarint(prefab_delta) || !reader.ReadVarint(x_delta) || !reader.ReadSigned(y_delta) ||
+                !reader.ReadSigned(z_delta)) {
+                return false;
+            }
+
+            if (prefab_delta != 0) {
+                prev_steps[0] = 0;
+            }
+
+            prefab += prefab_delta;
+            prev_steps[0] += static_cast<int64_t>(x_delta);
+            prev_steps[1] += y_delta;
+            prev_steps[2] += z_delta;
+
+            if (prefab >= num_prefabs) {
+                return false;
+            }
+
+            prefab_ids.push_back(static_cast<uint32_t>(prefab));
+            for (int axis = 0; axis < 3; ++axis) {
+                if (prev_steps[axis] < 0 || prev_steps[axis] >= kCellSteps) {
+                    return false;
+                }
+
+                steps[axis].push_back(static_cast<int32_t>(prev_steps[axis]));
+                origins[axis].push_back(static_cast<float>(cell[axis]) * kCellSize);
+            }
+        }
+    }
+
+    std::array<std::vector<float>, 3> positions{};
+    for (int axis = 0; axis < 3; ++axis) {
+        positions[axis].resize(prefab_ids.size());
+        ExpandAxis(origins[axis], steps[axis], positions[axis]);
+    }
+
+    out.reserve(out.size() + prefab_ids.size());
+    for (size_t idx = 0; idx < prefab_ids.size(); ++idx) {
+        Placement placement         = prefabs[prefab_ids[idx]];
+        placement.position.position = {positions[0][idx], positions[1][idx], positions[2][idx]};
+        out.push_back(placement);
+    }
+
+    return true;
+}
@@ -0,0 +1,60 @@
+#ifndef SERIALIZATION_PLACEMENT_CODEC_HPP_
+#define SERIALIZATION_PLACEMENT_CODEC_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/intf.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+LIBGCP_DECL_START_
+/**
+ * Compact encoding of the static objects section.
+ * Objects sharing model, rotation and scale form one prefab stored once in the prefab table,
+ * each object is then only a placement: prefab index and position quantized relative to the origin
+ * of its grid cell. Placements are sorted inside cells and stored as deltas in variable length integers,
+ * so dense scatters take a few bytes per object.
+ *
+ * Stream layout, all integers are varints, signed ones zigzag encoded:
+ *  num_prefabs, prefabs: { name, float rotation[3], float scale[3] }
+ *  num_cells, cells: { delta of cell coordinates x, y, z, num_placements, placements: { prefab delta, dx, dy, dz } }
+ */
+class PlacementCodec
+{
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    /* Edge of the quantization cell and number of steps along it, step is about a millimeter */
+    static constexpr float kCellSize     = 64.0f;
+    static constexpr uint32_t kCellSteps = 1 << 16;
+    static constexpr float kPositionStep = kCellSize / static_cast<float>(kCellSteps);
+
+    struct Placement {
+        size_t name;
+        ObjectPosition position;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    PlacementCodec() = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    /* Positions are rounded to kPositionStep, order of the objects is not preserved */
+    NDSCRD static std::vector<std::byte> Encode(std::span<const Placement> placements);
+
+    /* Fails on truncated or malformed stream */
+    NDSCRD static bool Decode(std::span<const std::byte> stream, std::vector<Placement> &out);
+};
+
+LIBGCP_DECL_END_
+
+#endif  // SERIALIZATION_PLACEMENT_CODEC_HPP_
@@ -1,31 +1,406 @@
 #include <libcgp/intf.hpp>
 #include <libcgp/rc.hpp>
+#include <libcgp/serialization/placement_codec.hpp>
 #include <libcgp/serialization/scene_serializer.hpp>
 #include <libcgp/utils/files.hpp>
 #include <libcgp/utils/macros.hpp>
 #include <libcgp/version.hpp>
 
+#include <libcgp/engine/lights.hpp>
 #include <libcgp/mgr/object_mgr.hpp>
 #include <libcgp/mgr/resource_mgr.hpp>
 #include <libcgp/mgr/settings_mgr.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <map>
+#include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
-LibGcp::Rc LibGcp::SceneSerializer::SerializeScene(const std::string &scene_name, const SerializationType type)
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+template <class ContainerT>
+static std::array<int, 3> AddChangeListeners(ContainerT &container, const std::function<void()> &on_change)
 {
-    if (!std::filesystem::exists(output_dir_) && !std::filesystem::create_directories(output_dir_)) {
-        return Rc::kFailedToCreateDir;
+    return {
+        container.GetListeners().template AddListener<CxxUtils::ContainerEvents::kAdd>([on_change](const auto *) {
+            on_change();
+        }),
+        container.GetListeners().template AddListener<CxxUtils::ContainerEvents::kRemove>([on_change](const auto *) {
+            on_change();
+        }),
+        container.GetListeners().template AddListener<CxxUtils::ContainerEvents::kClear>([on_change](const auto *) {
+            on_change();
+        }),
+    };
+}
+
+template <class ContainerT>
+static void RemoveChangeListeners(ContainerT &container, const std::array<int, 3> &ids)
+{
+    container.GetListeners().template RemoveListener<CxxUtils::ContainerEvents::kAdd>(ids[0]);
+    container.GetListeners().template RemoveListener<CxxUtils::ContainerEvents::kRemove>(ids[1]);
+    container.GetListeners().template RemoveListener<CxxUtils::ContainerEvents::kClear>(ids[2]);
+}
+
+/**
+ * Reads the chunk placed at given offset and passes decoded records together with chunk local strings.
+ * Every count and string offset is checked against the payload first, func returns false when the records refer to
+ * strings or values out of range, both cases end with kCorruptedFile.
+ */
+template <class T, class FuncT>
+static LibGcp::Rc ReadChunk(
+    std::ifstream &file, const size_t offset, const LibGcp::SceneSerialized::Section section, FuncT &&func
+)
+{
+    using LibGcp::SceneSerialized;
+
+    if (offset == 0) {
+        /* section was never saved */
+        return LibGcp::Rc::kSuccess;
     }
 
-    if (!std::filesystem::is_directory(output_dir_)) {
-        return Rc::kNotADirectory;
+    file.seekg(0, std::ios::end);
+    const auto file_size = static_cast<size_t>(file.tellg());
+
+    if (!file || offset > file_size || file_size - offset < sizeof(SceneSerialized::ChunkHeader)) {
+        return LibGcp::Rc::kCorruptedFile;
     }
 
-    if (!FileWriteable(output_dir_)) {
-        return Rc::kNoPermission;
+    file.seekg(static_cast<std::streamoff>(offset));
+    SceneSerialized::ChunkHeader header{};
+    file.read(reinterpret_cast<char *>(&header), sizeof(SceneSerialized::ChunkHeader));
+
+    if (!file || header.magic != SceneSerialized::kChunkMagic || header.section != section) {
+        return LibGcp::Rc::kCorruptedFile;
+    }
+
+    /* sizes are checked one by one, so none of the products can overflow */
+    const size_t payload_bytes = header.payload_bytes;
+    if (payload_bytes > file_size - offset - sizeof(SceneSerialized::ChunkHeader) ||
+        header.num_records > payload_bytes / sizeof(T)) {
+        return LibGcp::Rc::kCorruptedFile;
+    }
+
+    const size_t records_bytes = header.num_records * sizeof(T);
+    if (header.num_strings > (payload_bytes - records_bytes) / sizeof(SceneSerialized::StringTable)) {
+        return LibGcp::Rc::kCorruptedFile;
+    }
+
+    std::vector<char> payload{};
+    payload.resize(payload_bytes);
+    file.read(payload.data(), static_cast<std::streamsize>(payload_bytes));
+
+    if (!file) {
+        return LibGcp::Rc::kCorruptedFile;
+    }
+
+    const size_t table_bytes = header.num_strings * sizeof(SceneSerialized::StringTable);
+    const size_t data_bytes  = payload_bytes - records_bytes - table_bytes;
+
+    const auto records      = reinterpret_cast<const T *>(payload.data());
+    const auto string_table = reinterpret_cast<const SceneSerialized::StringTable *>(&records[header.num_records]);
+    const auto string_data  = reinterpret_cast<const char *>(&string_table[header.num_strings]);
+
+    std::vector<std::string> strings{};
+    strings.reserve(header.num_strings);
+
+    for (size_t idx = 0; idx < header.num_strings; ++idx) {
+        const size_t string_offset = string_table[idx].idx;
+        if (string_offset > data_bytes || data_bytes - string_offset < sizeof(SceneSerialized::StringSerialized)) {
+            return LibGcp::Rc::kCorruptedFile;
+        }
+
+        const auto string_struct =
+            reinterpret_cast<const SceneSerialized::StringSerialized *>(&string_data[string_offset]);
+        const size_t chars_offset = string_offset + sizeof(SceneSerialized::StringSerialized);
+
+        if (string_struct->length > data_bytes - chars_offset) {
+            return LibGcp::Rc::kCorruptedFile;
+        }
+
+        strings.emplace_back(&string_data[chars_offset], string_struct->length);
+    }
+
+    if (!func(records, header.num_records, strings)) {
+        return LibGcp::Rc::kCorruptedFile;
+    }
+
+    return LibGcp::Rc::kSuccess;
+}
+
+static LibGcp::Rc ReadResourcesChunk(std::ifstream &file, const size_t offset, LibGcp::resource_t &out)
+{
+    using LibGcp::SceneSerialized;
+
+    return ReadChunk<SceneSerialized::ResourceSerialized>(
+        file, offset, SceneSerialized::Section::kResources,
+        [&](const SceneSerialized::ResourceSerialized *resources, const size_t count,
+            const std::vector<std::string> &strings) {
+            out.reserve(count);
+            for (size_t idx = 0; idx < count; ++idx) {
+                const auto &resource = resources[idx];
+                if (resource.paths[0] >= strings.size() || resource.paths[1] >= strings.size()) {
+                    return false;
+                }
+
+                out.push_back({
+                    {strings[resource.paths[0]], strings[resource.paths[1]]},
+                    resource.type,
+                    resource.load_type,
+                    resource.flip_texture,
+                });
+            }
+
+            return true;
+        }
+    );
+}
+
+static LibGcp::Rc ReadStaticObjectsChunk(
+    std::ifstream &file, const size_t offset, const LibGcp::SceneVersion version, LibGcp::static_objects_t &out
+)
+{
+    using LibGcp::SceneSerialized;
+
+    if (version < LibGcp::SceneVersion::V0_1_3) {
+        return ReadChunk<SceneSerialized::StaticObjectSerialized>(
+            file, offset, SceneSerialized::Section::kStaticObjects,
+            [&](const SceneSerialized::StaticObjectSerialized *objects, const size_t count,
+                const std::vector<std::string> &strings) {
+                out.reserve(count);
+                for (size_t idx = 0; idx < count; ++idx) {
+                    if (objects[idx].name >= strings.size()) {
+                        return false;
+                    }
+
+                    out.push_back({
+                        objects[idx].position,
+                        strings[objects[idx].name],
+                    });
+                }
+
+                return true;
+            }
+        );
+    }
+
+    return ReadChunk<std::byte>(
+        file, offset, SceneSerialized::Section::kStaticObjects,
+        [&](const std::byte *stream, const size_t size, const std::vector<std::string> &strings) {
+            std::vector<LibGcp::PlacementCodec::Placement> placements{};
+            if (!LibGcp::PlacementCodec::Decode({stream, size}, placements)) {
+                return false;
+            }
+
+            out.reserve(placements.size());
+            for (const auto &placement : placements) {
+                if (placement.name >= strings.size()) {
+                    return false;
+                }
+
+                out.push_back({
+                    placement.position,
+                    strings[placement.name],
+                });
+            }
+
+            return true;
+        }
+    );
+}
+
+static LibGcp::Rc ReadPointLightsChunk(std::ifstream &file, const size_t offset, LibGcp::point_lights_t &out)
+{
+    using LibGcp::SceneSerialized;
+
+    return ReadChunk<SceneSerialized::PointLightSerialized>(
+        file, offset, SceneSerialized::Section::kPointLights,
+        [&](const SceneSerialized::PointLightSerialized *lights, const size_t count,
+            const std::vector<std::string> &strings) {
+            out.reserve(count);
+            for (size_t idx = 0; idx < count; ++idx) {
+                if (lights[idx].model >= strings.size()) {
+                    return false;
+                }
+
+                out.push_back({
+                    strings[lights[idx].model],
+                    lights[idx].light_info,
+                    lights[idx].point_light,
+                });
+            }
+
+            return true;
+        }
+    );
+}
+
+static LibGcp::Rc ReadSpotLightsChunk(std::ifstream &file, const size_t offset, LibGcp::spot_lights_t &out)
+{
+    using LibGcp::SceneSerialized;
+
+    return ReadChunk<SceneSerialized::SpotLightSerialized>(
+        file, offset, SceneSerialized::Section::kSpotLights,
+        [&](const SceneSerialized::SpotLightSerialized *lights, const size_t count,
+            const std::vector<std::string> &strings) {
+            out.reserve(count);
+            for (size_t idx = 0; idx < count; ++idx) {
+                if (lights[idx].model >= strings.size()) {
+                    return false;
+                }
+
+                out.push_back({
+                    strings[lights[idx].model],
+                    lights[idx].light_info,
+                    lights[idx].spot_light,
+                });
+            }
+
+            return true;
+        }
+    );
+}
+
+/* Cell of the point on the XZ plane */
+L_FAST_CALL std::pair<int32_t, int32_t> GetCellCoords(const glm::vec3 &position, const float cell_size)
+{
+    return {
+        static_cast<int32_t>(std::floor(position.x / cell_size)),
+        static_cast<int32_t>(std::floor(position.z / cell_size)),
+    };
+}
+
+/* Cells files exist since the chunked sections, older scenes are never partitioned */
+static constexpr auto kMinWorldCellsVersion = LibGcp::SceneVersion::V0_1_2;
+
+static LibGcp::Rc ReadWorldCellsHeader(std::ifstream &file, LibGcp::WorldCellsSerialized::Header &header)
+{
+    using LibGcp::Rc;
+
+    file.read(reinterpret_cast<char *>(&header), sizeof(LibGcp::WorldCellsSerialized::Header));
+
+    if (!file || header.magic != LibGcp::WorldCellsSerialized::kMagic || header.cell_size <= 0.0f) {
+        return Rc::kCorruptedFile;
+    }
+
+    if (header.scene_version < kMinWorldCellsVersion) {
+        return Rc::kOutdatedProtocol;
+    }
+
+    if (header.scene_version > LibGcp::kSceneVersion) {
+        return Rc::kTooOldSoftware;
+    }
+
+    return Rc::kSuccess;
+}
+
+/**
+ * Moves every static object to the cell containing its position. Models used by the objects together with
+ * their lights follow them, model shared by many cells is listed in each of them with all of its lights,
+ * so the lights are present whichever of the cells is loaded.
+ */
+static LibGcp::world_cells_t PartitionIntoCells(LibGcp::Scene &scene, const float cell_size)
+{
+    using LibGcp::ResourceSpec;
+    using LibGcp::ResourceType;
+
+    std::map<std::pair<int32_t, int32_t>, LibGcp::WorldCellSpec> cells{};
+    std::unordered_map<std::string, std::set<std::pair<int32_t, int32_t>>> model_cells{};
+
+    for (auto &object : scene.static_objects) {
+        const auto coords = GetCellCoords(object.position.position, cell_size);
+        auto &cell        = cells[coords];
+
+        cell.x = coords.first;
+        cell.z = coords.second;
+
+        model_cells[object.name].insert(coords);
+        cell.static_objects.push_back(std::move(object));
+    }
+    scene.static_objects.clear();
+
+    /* model specs are moved from the scene to every cell using them */
+    std::unordered_map<std::string, ResourceSpec> model_specs{};
+    std::erase_if(scene.resources, [&](ResourceSpec &spec) {
+        if (spec.type != ResourceType::kModel || !model_cells.contains(spec.paths[0])) {
+            return false;
+        }
+
+        model_specs[spec.paths[0]] = std::move(spec);
+        return true;
+    });
+
+    for (auto &[coords, cell] : cells) {
+        std::unordered_map<std::string, bool> listed{};
+
+        for (const auto &object : cell.static_objects) {
+            if (!listed.try_emplace(object.name, true).second) {
+                continue;
+            }
+
+            const auto spec_it = model_specs.find(object.name);
+            cell.resources.push_back(
+                spec_it != model_specs.end() ? spec_it->second
+                                             : ResourceSpec{
+                                                   .paths     = {object.name, ""},
+                                                   .type      = ResourceType::kModel,
+                                                   .load_type = LibGcp::LoadType::kExternal,
+                                               }
+            );
+        }
+    }
+
+    const auto move_lights = [&](auto &scene_lights, auto cell_lights) {
+        std::erase_if(scene_lights, [&](auto &light) {
+            const auto it = model_cells.find(light.model_name);
+            if (it == model_cells.end()) {
+                return false;
+            }
+
+            for (const auto &coords : it->second) {
+                (cells[coords].*cell_lights).push_back(light);
+            }
+            return true;
+        });
+    };
+    move_lights(scene.point_lights, &LibGcp::WorldCellSpec::point_lights);
+    move_lights(scene.spot_lights, &LibGcp::WorldCellSpec::spot_lights);
+
+    LibGcp::world_cells_t result{};
+    result.reserve(cells.size());
+
+    for (auto &[coords, cell] : cells) {
+        result.push_back(std::move(cell));
+    }
+
+    return result;
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::SceneSerializer::~SceneSerializer()
+{
+    StopChangeTracking();
+    WaitForCompaction();
+}
+
+LibGcp::Rc LibGcp::SceneSerializer::SerializeScene(const std::string &scene_name, const SerializationType type)
+{
+    if (const auto rc = PrepareOutputDir_(); IsFailure(rc)) {
+        return rc;
     }
     //
     // if (std::filesystem::exists(output_dir_ + "/" + scene_name)) {
@@ -47,6 +422,88 @@ LibGcp::Rc LibGcp::SceneSerializer::SerializeScene(const std::string &scene_name
     }
 }
 
+LibGcp::Rc LibGcp::SceneSerializer::SerializeSceneIncremental(const std::string &scene_name)
+{
+    if (const auto rc = PrepareOutputDir_(); IsFailure(rc)) {
+        return rc;
+    }
+
+    const std::string path = output_dir_ + "/" + scene_name;
+    if (!std::filesystem::exists(path)) {
+        return SerializeSceneShallow_(scene_name);
+    }
+
+    std::unique_lock lock(file_mutex_);
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+
+    SceneSerialized::ChunkedSceneHeader header{};
+    file.read(reinterpret_cast<char *>(&header), sizeof(SceneSerialized::ChunkedSceneHeader));
+
+    /* older formats can not be appended to */
+    if (!file || header.base_header.magic != SceneSerialized::kMagic ||
+        header.base_header.scene_version != kSceneVersion) {
+        file.close();
+        lock.unlock();
+
+        return SerializeSceneShallow_(scene_name);
+    }
+
+    /* append dirty sections at the end of the file */
+    file.seekp(0, std::ios::end);
+
+    /* writing settings updates the saved values, they are restored when the save fails */
+    const auto saved_settings = last_settings_;
+
+    size_t appended{};
+    std::array<bool, kSectionsCount> is_appended{};
+    for (size_t idx = 0; idx < kSectionsCount; ++idx) {
+        const auto section = static_cast<Section>(idx);
+
+        if (!IsSectionDirty_(section)) {
+            continue;
+        }
+
+        header.section_offsets[idx] = static_cast<size_t>(file.tellp());
+        WriteSection_(file, section);
+        is_appended[idx] = true;
+        ++appended;
+    }
+
+    if (appended == 0) {
+        TRACE("Scene " << scene_name << " has no changes to save");
+        return Rc::kSuccess;
+    }
+
+    /* header is updated last so interrupted save leaves the previous state readable */
+    header.num_chunks += appended;
+    header.base_header.payload_bytes = static_cast<size_t>(file.tellp()) - header.base_header.header_bytes;
+
+    file.seekp(0);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(SceneSerialized::ChunkedSceneHeader));
+    file.close();
+
+    /* sections stay dirty, so the next save retries them */
+    if (file.fail()) {
+        last_settings_ = saved_settings;
+        return Rc::kFailedToOpenFile;
+    }
+
+    for (size_t idx = 0; idx < kSectionsCount; ++idx) {
+        if (is_appended[idx]) {
+            dirty_[idx] = false;
+        }
+    }
+
+    TRACE("Appended " << appended << " sections to scene: " << scene_name);
+
+    lock.unlock();
+    if (header.num_chunks >= kSectionsCount + kCompactionThreshold) {
+        CompactAsync(scene_name);
+    }
+
+    return Rc::kSuccess;
+}
+
 std::tuple<LibGcp::Rc, LibGcp::Scene> LibGcp::SceneSerializer::LoadScene(
     const std::string &scene_name, const SerializationType type
 )
@@ -65,93 +522,144 @@ std::tuple<LibGcp::Rc, LibGcp::Scene> LibGcp::SceneSerializer::LoadScene(
     }
 }
 
-LibGcp::Rc LibGcp::SceneSerializer::SerializeSceneShallow_(const std::string &scene_name)
+void LibGcp::SceneSerializer::StartChangeTracking()
 {
-    SceneSerialized serial_struct{};
+    if (is_tracking_) {
+        return;
+    }
 
-    serial_struct.header.base_header.source_version  = kGlobalVersion;
-    serial_struct.header.base_header.scene_version   = kSceneVersion;
-    serial_struct.header.base_header.texture_version = kTextureVersion;
-    serial_struct.header.base_header.model_version   = kModelVersion;
-    serial_struct.header.base_header.header_bytes    = sizeof(SceneSerialized::SceneHeader);
+    const auto mark_objects = [this] {
+        MarkDirty(Section::kStaticObjects);
+    };
 
-    serial_struct.header.num_settings = static_cast<size_t>(Setting::kLast);
+    /* models carry the lights, so lights must follow the model changes */
+    const auto mark_models = [this] {
+        MarkDirty(Section::kResources);
+        MarkDirty(Section::kPointLights);
+        MarkDirty(Section::kSpotLights);
+    };
 
-    string_map_.clear();
-    string_counter_    = 1;
-    string_map_[""]    = 0;
-    size_t total_bytes = 0;
+    const auto mark_resources = [this] {
+        MarkDirty(Section::kResources);
+    };
 
-    /* gather data */
-    const auto settings               = SerializeSettings_();
-    serial_struct.header.num_settings = settings.size();
-    total_bytes += settings.size() * sizeof(SceneSerialized::SettingsSerialized);
+    object_listeners_  = AddChangeListeners(ObjectMgr::GetInstance().GetStaticObjects(), mark_objects);
+    model_listeners_   = AddChangeListeners(ResourceMgr::GetInstance().GetModels(), mark_models);
+    texture_listeners_ = AddChangeListeners(ResourceMgr::GetInstance().GetTextures(), mark_resources);
+    shader_listeners_  = AddChangeListeners(ResourceMgr::GetInstance().GetShaders(), mark_resources);
 
-    const auto resources               = SerializeResources_();
-    serial_struct.header.num_resources = resources.size();
-    total_bytes += resources.size() * sizeof(SceneSerialized::ResourceSerialized);
+    is_tracking_ = true;
+}
 
-    const auto static_objects        = SerializeStaticObjects_();
-    serial_struct.header.num_statics = static_objects.size();
-    total_bytes += static_objects.size() * sizeof(SceneSerialized::StaticObjectSerialized);
+void LibGcp::SceneSerializer::StopChangeTracking()
+{
+    if (!is_tracking_) {
+        return;
+    }
 
-    const auto lights                     = SerializeLights_();
-    serial_struct.header.num_point_lights = lights.size<SceneSerialized::PointLightSerialized>();
-    total_bytes += serial_struct.header.num_point_lights * sizeof(SceneSerialized::PointLightSerialized);
-    serial_struct.header.num_spot_lights = lights.size<SceneSerialized::SpotLightSerialized>();
-    total_bytes += serial_struct.header.num_spot_lights * sizeof(SceneSerialized::SpotLightSerialized);
+    RemoveChangeListeners(ObjectMgr::GetInstance().GetStaticObjects(), object_listeners_);
+    RemoveChangeListeners(ResourceMgr::GetInstance().GetModels(), model_listeners_);
+    RemoveChangeListeners(ResourceMgr::GetInstance().GetTextures(), texture_listeners_);
+    RemoveChangeListeners(ResourceMgr::GetInstance().GetShaders(), shader_listeners_);
 
-    serial_struct.header.num_strings = string_map_.size();
-    total_bytes += string_map_.size() * sizeof(uint64_t);
-    total_bytes += string_map_.size() * sizeof(SceneSerialized::StringSerialized);
+    is_tracking_ = false;
+}
 
-    for (const auto &string : string_map_) {
-        total_bytes += string.first.size();
+void LibGcp::SceneSerializer::MarkClean() noexcept
+{
+    for (auto &dirty : dirty_) {
+        dirty = false;
     }
 
-    /* save payload size */
-    serial_struct.header.base_header.payload_bytes = total_bytes;
+    last_settings_ = SerializeSettings_();
+}
+
+void LibGcp::SceneSerializer::CompactAsync(const std::string &scene_name)
+{
+    WaitForCompaction();
+
+    compaction_thread_ = std::thread([this, scene_name] {
+        const std::lock_guard lock(file_mutex_);
+
+        if (const auto rc = CompactUnlocked_(scene_name); IsFailure(rc)) {
+            TRACE("Failed to compact scene: " << scene_name << " caused by: " << GetRcDescription(rc));
+        }
+    });
+}
+
+void LibGcp::SceneSerializer::WaitForCompaction()
+{
+    if (compaction_thread_.joinable()) {
+        compaction_thread_.join();
+    }
+}
+
+LibGcp::Rc LibGcp::SceneSerializer::PrepareOutputDir_() const
+{
+    if (!std::filesystem::exists(output_dir_) && !std::filesystem::create_directories(output_dir_)) {
+        return Rc::kFailedToCreateDir;
+    }
+
+    if (!std::filesystem::is_directory(output_dir_)) {
+        return Rc::kNotADirectory;
+    }
+
+    if (!FileWriteable(output_dir_)) {
+        return Rc::kNoPermission;
+    }
+
+    return Rc::kSuccess;
+}
+
+LibGcp::Rc LibGcp::SceneSerializer::SerializeSceneShallow_(const std::string &scene_name)
+{
+    const std::lock_guard lock(file_mutex_);
+
+    SceneSerialized serial_struct{};
+
+    serial_struct.header.base_header.source_version  = kGlobalVersion;
+    serial_struct.header.base_header.scene_version   = kSceneVersion;
+    serial_struct.header.base_header.texture_version = kTextureVersion;
+    serial_struct.header.base_header.model_version   = kModelVersion;
+    serial_struct.header.base_header.header_bytes    = sizeof(SceneSerialized::ChunkedSceneHeader);
 
     /* write to file */
     std::ofstream file(output_dir_ + "/" + scene_name, std::ios::binary);
 
-    /* write header */
-    file.write(reinterpret_cast<const char *>(&serial_struct.header), sizeof(SceneSerialized::SceneHeader));
-
-    /* write settings */
+    /* reserve space for the header, it is filled once all offsets are known */
     file.write(
-        reinterpret_cast<const char *>(settings.data()), settings.size() * sizeof(SceneSerialized::SettingsSerialized)
+        reinterpret_cast<const char *>(&serial_struct.header), sizeof(SceneSerialized::ChunkedSceneHeader)
     );
 
-    /* write resources */
-    file.write(
-        reinterpret_cast<const char *>(resources.data()), resources.size() * sizeof(SceneSerialized::ResourceSerialized)
-    );
+    /* write all sections */
+    for (size_t idx = 0; idx < kSectionsCount; ++idx) {
+        serial_struct.header.section_offsets[idx] = static_cast<size_t>(file.tellp());
+        WriteSection_(file, static_cast<Section>(idx));
+    }
 
-    /* write static objects */
-    file.write(
-        reinterpret_cast<const char *>(static_objects.data()),
-        static_objects.size() * sizeof(SceneSerialized::StaticObjectSerialized)
-    );
+    serial_struct.header.num_chunks = kSectionsCount;
 
-    /* write point lights */
-    file.write(
-        reinterpret_cast<const char *>(lights.GetUnderlyingData<SceneSerialized::PointLightSerialized>().data()),
-        lights.size<SceneSerialized::PointLightSerialized>() * sizeof(SceneSerialized::PointLightSerialized)
-    );
+    /* save payload size */
+    serial_struct.header.base_header.payload_bytes =
+        static_cast<size_t>(file.tellp()) - serial_struct.header.base_header.header_bytes;
 
-    /* write spotlights */
+    /* write header */
+    file.seekp(0);
     file.write(
-        reinterpret_cast<const char *>(lights.GetUnderlyingData<SceneSerialized::SpotLightSerialized>().data()),
-        lights.size<SceneSerialized::SpotLightSerialized>() * sizeof(SceneSerialized::SpotLightSerialized)
+        reinterpret_cast<const char *>(&serial_struct.header), sizeof(SceneSerialized::ChunkedSceneHeader)
     );
 
-    /* write string table */
-    SaveStringTable(file);
-
     /* close file */
     file.close();
 
+    if (file.fail()) {
+        return Rc::kFailedToOpenFile;
+    }
+
+    for (auto &dirty : dirty_) {
+        dirty = false;
+    }
+
     return Rc::kSuccess;
 }
 
@@ -161,6 +669,51 @@ LibGcp::Rc LibGcp::SceneSerializer::SerializeSceneDeepPack_(UNUSED const std::st
 
 LibGcp::Rc LibGcp::SceneSerializer::SerializeSceneDeepAttach_(UNUSED const std::string &scene_name){NOT_IMPLEMENTED}
 
+void LibGcp::SceneSerializer::WriteSection_(std::ostream &file, const Section section)
+{
+    /* strings are local to each chunk, so sections may be rewritten independently */
+    ResetStringTable_();
+
+    switch (section) {
+        case Section::kSettings: {
+            const auto settings = SerializeSettings_();
+            WriteChunk_(file, section, settings);
+            last_settings_ = settings;
+        } break;
+        case Section::kResources:
+            WriteChunk_(file, section, SerializeResources_());
+            break;
+        case Section::kStaticObjects:
+            WriteChunk_(file, section, SerializeStaticObjects_());
+            break;
+        case Section::kPointLights:
+            WriteChunk_(file, section, SerializeLights_<PointLight, SceneSerialized::PointLightSerialized>());
+            break;
+        case Section::kSpotLights:
+            WriteChunk_(file, section, SerializeLights_<SpotLight, SceneSerialized::SpotLightSerialized>());
+            break;
+        default:
+            R_ASSERT(false);
+    }
+}
+
+template <class T>
+void LibGcp::SceneSerializer::WriteChunk_(std::ostream &file, const Section section, const std::vector<T> &records)
+{
+    const SceneSerialized::ChunkHeader header{
+        .section       = section,
+        .num_records   = records.size(),
+        .num_strings   = string_map_.size(),
+        .payload_bytes = records.size() * sizeof(T) + GetStringTableBytes_(),
+    };
+
+    file.write(reinterpret_cast<const char *>(&header), sizeof(SceneSerialized::ChunkHeader));
+    file.write(
+        reinterpret_cast<const char *>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(T))
+    );
+    SaveStringTable(file);
+}
+
 std::vector<LibGcp::SceneSerialized::SettingsSerialized> LibGcp::SceneSerializer::SerializeSettings_()
 {
     std::vector<SceneSerialized::SettingsSerialized> settings{};
@@ -186,6 +739,11 @@ std::vector<LibGcp::SceneSerialized::ResourceSerialized> LibGcp::SceneSerializer
     ResourceMgr::GetInstance().GetModels().Lock();
 
     for (const auto &[name, model] : ResourceMgr::GetInstance().GetModels()) {
+        if (!model->is_serializable) {
+            /* model is owned by a streamed world cell */
+            continue;
+        }
+
         const size_t id = GetStringId_(model->load_type == LoadType::kMemory ? name : ConvertFullPathToRelative(name));
 
         resources.push_back({
@@ -259,58 +817,83 @@ std::vector<LibGcp::SceneSerialized::ResourceSerialized> LibGcp::SceneSerializer
 
     ResourceMgr::GetInstance().GetShaders().Unlock();
 
+    // ------------------------------
+    // Evicted
+    // ------------------------------
+
+    /* evicted resources are reloaded on the next use, the scene must keep them */
+    for (const auto &spec : ResourceMgr::GetInstance().GetEvictedSceneResources()) {
+        const std::string &name = spec.paths[0];
+        const size_t id = GetStringId_(spec.load_type == LoadType::kMemory ? name : ConvertFullPathToRelative(name));
+
+        resources.push_back({
+            .paths        = {id, 0},
+            .type         = spec.type,
+            .load_type    = spec.load_type,
+            .flip_texture = spec.flip_texture,
+        });
+    }
+
     return resources;
 }
 
-std::vector<LibGcp::SceneSerialized::StaticObjectSerialized> LibGcp::SceneSerializer::SerializeStaticObjects_()
+std::vector<std::byte> LibGcp::SceneSerializer::SerializeStaticObjects_()
 {
-    std::vector<SceneSerialized::StaticObjectSerialized> object_serialized{};
+    std::vector<PlacementCodec::Placement> placements{};
 
-    ObjectMgr::GetInstance().GetStaticObjects().Lock();
+    /* resolve model names once instead of searching the map for every object */
+    std::unordered_map<uint64_t, size_t> model_names{};
+    ResourceMgr::GetInstance().GetModels().Lock();
 
-    for (const auto &object : ObjectMgr::GetInstance().GetStaticObjects()) {
-        const uint64_t model_id = object.GetModel()->resource_id;
+    for (const auto &[model_name, model] : ResourceMgr::GetInstance().GetModels()) {
+        model_names[model->resource_id] =
+            GetStringId_(model->load_type == LoadType::kMemory ? model_name : ConvertFullPathToRelative(model_name));
+    }
 
-        /* Find model name */
-        std::string name;
-        ResourceMgr::GetInstance().GetModels().Lock();
+    ResourceMgr::GetInstance().GetModels().Unlock();
 
-        for (const auto &[model_name, model] : ResourceMgr::GetInstance().GetModels()) {
-            if (model->resource_id == model_id) {
-                name = model->load_type == LoadType::kMemory ? model_name : ConvertFullPathToRelative(model_name);
-                break;
-            }
+    ObjectMgr::GetInstance().GetStaticObjects().Lock();
+    placements.reserve(ObjectMgr::GetInstance().GetStaticObjects().size());
+
+    for (const auto &object : ObjectMgr::GetInstance().GetStaticObjects()) {
+        if (!object.IsSerializable()) {
+            /* object is owned by a streamed world cell */
+            continue;
         }
 
-        ResourceMgr::GetInstance().GetModels().Unlock();
+        const auto name_it = model_names.find(object.GetModel()->resource_id);
 
         /* fill object */
-        object_serialized.push_back({
-            .name     = GetStringId_(name),
+        placements.push_back({
+            .name     = name_it == model_names.end() ? GetStringId_("") : name_it->second,
             .position = object.GetPosition(),
         });
     }
 
     ObjectMgr::GetInstance().GetStaticObjects().Unlock();
 
-    return object_serialized;
+    return PlacementCodec::Encode(placements);
 }
 
-CxxUtils::MultiVector<LibGcp::SceneSerialized::PointLightSerialized, LibGcp::SceneSerialized::SpotLightSerialized>
-LibGcp::SceneSerializer::SerializeLights_()
+template <class LightT, class SerializedT>
+std::vector<SerializedT> LibGcp::SceneSerializer::SerializeLights_()
 {
-    CxxUtils::MultiVector<SceneSerialized::PointLightSerialized, SceneSerialized::SpotLightSerialized> vec{};
+    std::vector<SerializedT> vec{};
 
     ResourceMgr::GetInstance().GetModels().Lock();
 
     for (const auto &[name, model] : ResourceMgr::GetInstance().GetModels()) {
+        const auto &lights = model->GetLights().template GetUnderlyingData<LightT>();
+
+        if (lights.empty() || !model->is_serializable) {
+            continue;
+        }
+
         const size_t id = GetStringId_(model->load_type == LoadType::kMemory ? name : ConvertFullPathToRelative(name));
 
-        const auto func = [&]<class T>(const T &light) {
+        for (const auto &light : lights) {
             vec.push_back(light.Serialize(id));
-        };
-
-        model->GetLights().Foreach(func);
+        }
     }
 
     ResourceMgr::GetInstance().GetModels().Unlock();
@@ -318,39 +901,442 @@ LibGcp::SceneSerializer::SerializeLights_()
     return vec;
 }
 
-void LibGcp::SceneSerializer::SaveStringTable(std::ofstream &file)
+std::vector<LibGcp::SceneSerialized::SettingsSerialized> LibGcp::SceneSerializer::SerializeSpecs_(
+    const setting_t &settings
+)
 {
-    size_t offset{};
+    std::vector<SceneSerialized::SettingsSerialized> settings_serialized{};
+    settings_serialized.reserve(settings.size());
+
+    for (const auto &[setting, value] : settings) {
+        settings_serialized.push_back({
+            .setting = setting,
+            .value   = value.GetRaw(),
+        });
+    }
 
-    /* get offsets */
-    for (uint64_t idx = 0; idx < string_counter_; ++idx) {
-        for (const auto &[string, id] : string_map_) {
-            if (id == idx) {
-                /* write and update offset */
-                file.write(reinterpret_cast<const char *>(&offset), sizeof(size_t));
+    return settings_serialized;
+}
 
-                offset += string.size() + sizeof(SceneSerialized::StringSerialized);
-                break;
-            }
+std::vector<LibGcp::SceneSerialized::ResourceSerialized> LibGcp::SceneSerializer::SerializeSpecs_(
+    const resource_t &resources
+)
+{
+    std::vector<SceneSerialized::ResourceSerialized> resources_serialized{};
+    resources_serialized.reserve(resources.size());
+
+    for (const auto &resource : resources) {
+        resources_serialized.push_back({
+            .paths        = {GetStringId_(resource.paths[0]), GetStringId_(resource.paths[1])},
+            .type         = resource.type,
+            .load_type    = resource.load_type,
+            .flip_texture = resource.flip_texture,
+        });
+    }
+
+    return resources_serialized;
+}
+
+std::vector<std::byte> LibGcp::SceneSerializer::SerializeSpecs_(const static_objects_t &objects)
+{
+    if (objects.empty()) {
+        return {};
+    }
+
+    std::vector<PlacementCodec::Placement> placements{};
+    placements.reserve(objects.size());
+
+    for (const auto &object : objects) {
+        placements.push_back({
+            .name     = GetStringId_(object.name),
+            .position = object.position,
+        });
+    }
+
+    return PlacementCodec::Encode(placements);
+}
+
+std::vector<LibGcp::SceneSerialized::PointLightSerialized> LibGcp::SceneSerializer::SerializeSpecs_(
+    const point_lights_t &lights
+)
+{
+    std::vector<SceneSerialized::PointLightSerialized> lights_serialized{};
+    lights_serialized.reserve(lights.size());
+
+    for (const auto &light : lights) {
+        lights_serialized.push_back({
+            .model       = GetStringId_(light.model_name),
+            .light_info  = light.light_info,
+            .point_light = light.point_light,
+        });
+    }
+
+    return lights_serialized;
+}
+
+std::vector<LibGcp::SceneSerialized::SpotLightSerialized> LibGcp::SceneSerializer::SerializeSpecs_(
+    const spot_lights_t &lights
+)
+{
+    std::vector<SceneSerialized::SpotLightSerialized> lights_serialized{};
+    lights_serialized.reserve(lights.size());
+
+    for (const auto &light : lights) {
+        lights_serialized.push_back({
+            .model      = GetStringId_(light.model_name),
+            .light_info = light.light_info,
+            .spot_light = light.spot_light,
+        });
+    }
+
+    return lights_serialized;
+}
+
+template <class SpecsT>
+void LibGcp::SceneSerializer::WriteSpecSection_(
+    std::ostream &file, const Section section, const SpecsT &specs, std::array<size_t, kSectionsCount> &section_offsets
+)
+{
+    ResetStringTable_();
+
+    const auto records = SerializeSpecs_(specs);
+    if (records.empty()) {
+        /* missing section reads as empty one */
+        section_offsets[static_cast<size_t>(section)] = 0;
+        return;
+    }
+
+    section_offsets[static_cast<size_t>(section)] = static_cast<size_t>(file.tellp());
+    WriteChunk_(file, section, records);
+}
+
+LibGcp::Rc LibGcp::SceneSerializer::PartitionScene(const std::string &scene_name, const float cell_size)
+{
+    if (cell_size <= 0.0f) {
+        return Rc::kInvalidArgument;
+    }
+
+    auto [rc, scene] = LoadSceneShallow_(scene_name);
+    if (IsFailure(rc)) {
+        return rc;
+    }
+
+    /* already partitioned scene is merged back first, so it can be split with a different cell size */
+    if (!scene.world_cells.empty()) {
+        if (rc = MergeWorldCells_(scene); IsFailure(rc)) {
+            return rc;
         }
     }
 
-    /* write strings */
-    for (uint64_t idx = 0; idx < string_counter_; ++idx) {
-        for (const auto &[string, id] : string_map_) {
-            if (id == idx) {
-                SceneSerialized::StringSerialized string_struct{
-                    .length = string.size(),
-                };
-
-                file.write(reinterpret_cast<const char *>(&string_struct), sizeof(SceneSerialized::StringSerialized));
-                file.write(string.c_str(), string.size());
-                break;
+    const world_cells_t cells = PartitionIntoCells(scene, cell_size);
+
+    const std::lock_guard lock(file_mutex_);
+
+    /* cells are written first, scene without the moved objects is useless without them */
+    if (rc = WriteWorldCells_(GetWorldCellsPath_(scene_name), cells, cell_size); IsFailure(rc)) {
+        return rc;
+    }
+
+    const std::string path     = output_dir_ + "/" + scene_name;
+    const std::string tmp_path = GetUniqueTempPath(path);
+
+    SceneSerialized::ChunkedSceneHeader header{};
+    header.base_header.source_version  = kGlobalVersion;
+    header.base_header.scene_version   = kSceneVersion;
+    header.base_header.texture_version = kTextureVersion;
+    header.base_header.model_version   = kModelVersion;
+    header.base_header.header_bytes    = sizeof(SceneSerialized::ChunkedSceneHeader);
+
+    std::ofstream file(tmp_path, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(SceneSerialized::ChunkedSceneHeader));
+
+    /* header is packed, offsets are gathered aside */
+    std::array<size_t, kSectionsCount> section_offsets{};
+    WriteSpecSection_(file, Section::kSettings, scene.settings, section_offsets);
+    WriteSpecSection_(file, Section::kResources, scene.resources, section_offsets);
+    WriteSpecSection_(file, Section::kStaticObjects, scene.static_objects, section_offsets);
+    WriteSpecSection_(file, Section::kPointLights, scene.point_lights, section_offsets);
+    WriteSpecSection_(file, Section::kSpotLights, scene.spot_lights, section_offsets);
+
+    std::memcpy(header.section_offsets, section_offsets.data(), sizeof(section_offsets));
+    header.num_chunks = static_cast<size_t>(std::ranges::count_if(section_offsets, [](const size_t offset) {
+        return offset != 0;
+    }));
+    header.base_header.payload_bytes = static_cast<size_t>(file.tellp()) - header.base_header.header_bytes;
+
+    file.seekp(0);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(SceneSerialized::ChunkedSceneHeader));
+    file.close();
+
+    std::error_code ec;
+    if (file.fail() || (std::filesystem::rename(tmp_path, path, ec), ec)) {
+        std::filesystem::remove(tmp_path, ec);
+        return Rc::kFailedToOpenFile;
+    }
+
+    /* whole file was rewritten */
+    for (auto &dirty : dirty_) {
+        dirty = false;
+    }
+
+    TRACE("Partitioned scene " << scene_name << " into " << cells.size() << " cells");
+    return Rc::kSuccess;
+}
+
+std::tuple<LibGcp::Rc, LibGcp::SceneSerializer::WorldCellsIndex> LibGcp::SceneSerializer::LoadWorldCellsIndex(
+    const std::string &path
+)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    WorldCellsSerialized::Header header{};
+    if (const Rc rc = ReadWorldCellsHeader(file, header); IsFailure(rc)) {
+        return {rc, {}};
+    }
+
+    /* count comes from the file, so it is bounded by its size before allocating the table */
+    std::error_code ec;
+    const auto file_size = std::filesystem::file_size(path, ec);
+    if (ec || header.num_cells > (file_size - sizeof(WorldCellsSerialized::Header)) /
+                                     sizeof(WorldCellsSerialized::CellEntry)) {
+        return {Rc::kCorruptedFile, {}};
+    }
+
+    WorldCellsIndex index{
+        .cell_size = header.cell_size,
+        .cells     = std::vector<WorldCellsSerialized::CellEntry>(header.num_cells),
+    };
+
+    file.read(
+        reinterpret_cast<char *>(index.cells.data()),
+        static_cast<std::streamsize>(header.num_cells * sizeof(WorldCellsSerialized::CellEntry))
+    );
+
+    if (!file) {
+        return {Rc::kCorruptedFile, {}};
+    }
+
+    return {Rc::kSuccess, std::move(index)};
+}
+
+std::tuple<LibGcp::Rc, LibGcp::WorldCellSpec> LibGcp::SceneSerializer::LoadWorldCell(
+    const std::string &path, const WorldCellsSerialized::CellEntry &entry
+)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open()) {
+        return {Rc::kFailedToOpenFile, {}};
+    }
+
+    /* layout of the static objects depends on the version the cells were written with */
+    WorldCellsSerialized::Header header{};
+    if (const Rc rc = ReadWorldCellsHeader(file, header); IsFailure(rc)) {
+        return {rc, {}};
+    }
+
+    WorldCellSpec cell{
+        .x = entry.x,
+        .z = entry.z,
+    };
+
+    const auto offset = [&entry](const Section section) -> size_t {
+        return entry.section_offsets[static_cast<size_t>(section)];
+    };
+
+    Rc rc = ReadResourcesChunk(file, offset(Section::kResources), cell.resources);
+
+    if (IsSuccess(rc)) {
+        rc = ReadStaticObjectsChunk(file, offset(Section::kStaticObjects), header.scene_version, cell.static_objects);
+    }
+
+    if (IsSuccess(rc)) {
+        rc = ReadPointLightsChunk(file, offset(Section::kPointLights), cell.point_lights);
+    }
+
+    if (IsSuccess(rc)) {
+        rc = ReadSpotLightsChunk(file, offset(Section::kSpotLights), cell.spot_lights);
+    }
+
+    if (IsFailure(rc)) {
+        return {rc, {}};
+    }
+
+    return {Rc::kSuccess, std::move(cell)};
+}
+
+std::string LibGcp::SceneSerializer::GetWorldCellsPath_(const std::string &scene_name) const
+{
+    return output_dir_ + "/" + scene_name + kWorldCellsExtension;
+}
+
+LibGcp::Rc LibGcp::SceneSerializer::MergeWorldCells_(Scene &scene)
+{
+    const auto [rc, index] = LoadWorldCellsIndex(scene.world_cells);
+    if (IsFailure(rc)) {
+        return rc;
+    }
+
+    std::unordered_set<std::string> listed_models{};
+    for (const auto &resource : scene.resources) {
+        if (resource.type == ResourceType::kModel) {
+            listed_models.insert(resource.paths[0]);
+        }
+    }
+
+    /* lights of a model shared by many cells are repeated in each of them */
+    std::unordered_set<std::string> lit_models{};
+    const auto merge_lights = [&lit_models](auto &cell_lights, auto &scene_lights) {
+        for (auto &light : cell_lights) {
+            if (!lit_models.contains(light.model_name)) {
+                scene_lights.push_back(std::move(light));
+            }
+        }
+    };
+
+    for (const auto &entry : index.cells) {
+        auto [cell_rc, cell] = LoadWorldCell(scene.world_cells, entry);
+        if (IsFailure(cell_rc)) {
+            return cell_rc;
+        }
+
+        std::unordered_set<std::string> cell_lit_models{};
+        for (const auto &light : cell.point_lights) {
+            cell_lit_models.insert(light.model_name);
+        }
+        for (const auto &light : cell.spot_lights) {
+            cell_lit_models.insert(light.model_name);
+        }
+
+        /* model specs are repeated in every cell using them */
+        for (auto &resource : cell.resources) {
+            if (resource.type != ResourceType::kModel || listed_models.insert(resource.paths[0]).second) {
+                scene.resources.push_back(std::move(resource));
             }
         }
+
+        std::ranges::move(cell.static_objects, std::back_inserter(scene.static_objects));
+        merge_lights(cell.point_lights, scene.point_lights);
+        merge_lights(cell.spot_lights, scene.spot_lights);
+        lit_models.merge(cell_lit_models);
+    }
+
+    scene.world_cells.clear();
+    return Rc::kSuccess;
+}
+
+LibGcp::Rc LibGcp::SceneSerializer::WriteWorldCells_(
+    const std::string &path, const world_cells_t &cells, const float cell_size
+)
+{
+    /* scenes partitioned concurrently write their own temporary files, the rename publishes the whole file */
+    const std::string tmp_path = GetUniqueTempPath(path);
+    std::ofstream file(tmp_path, std::ios::binary);
+
+    const WorldCellsSerialized::Header header{
+        .scene_version = kSceneVersion,
+        .cell_size     = cell_size,
+        .num_cells     = cells.size(),
+    };
+
+    /* cell table is rewritten once offsets of all chunks are known */
+    std::vector<WorldCellsSerialized::CellEntry> entries(cells.size());
+    const auto write_table = [&] {
+        file.write(reinterpret_cast<const char *>(&header), sizeof(WorldCellsSerialized::Header));
+        file.write(
+            reinterpret_cast<const char *>(entries.data()),
+            static_cast<std::streamsize>(entries.size() * sizeof(WorldCellsSerialized::CellEntry))
+        );
+    };
+    write_table();
+
+    for (size_t idx = 0; idx < cells.size(); ++idx) {
+        const auto &cell = cells[idx];
+        auto &entry      = entries[idx];
+
+        std::array<size_t, kSectionsCount> section_offsets{};
+        WriteSpecSection_(file, Section::kResources, cell.resources, section_offsets);
+        WriteSpecSection_(file, Section::kStaticObjects, cell.static_objects, section_offsets);
+        WriteSpecSection_(file, Section::kPointLights, cell.point_lights, section_offsets);
+        WriteSpecSection_(file, Section::kSpotLights, cell.spot_lights, section_offsets);
+
+        entry.x = cell.x;
+        entry.z = cell.z;
+        std::memcpy(entry.section_offsets, section_offsets.data(), sizeof(section_offsets));
+    }
+
+    file.seekp(0);
+    write_table();
+    file.close();
+
+    std::error_code ec;
+    if (file.fail() || (std::filesystem::rename(tmp_path, path, ec), ec)) {
+        std::filesystem::remove(tmp_path, ec);
+        return Rc::kFailedToOpenFile;
+    }
+
+    return Rc::kSuccess;
+}
+
+bool LibGcp::SceneSerializer::IsSectionDirty_(const Section section)
+{
+    if (section != Section::kSettings) {
+        return dirty_[static_cast<size_t>(section)];
+    }
+
+    /* settings do not emit container events, compare with the last saved values instead */
+    const auto settings = SerializeSettings_();
+    return dirty_[static_cast<size_t>(section)] || settings.size() != last_settings_.size() ||
+           std::memcmp(
+               settings.data(), last_settings_.data(), settings.size() * sizeof(SceneSerialized::SettingsSerialized)
+           ) != 0;
+}
+
+size_t LibGcp::SceneSerializer::GetStringTableBytes_() const
+{
+    size_t total_bytes =
+        string_map_.size() * (sizeof(SceneSerialized::StringTable) + sizeof(SceneSerialized::StringSerialized));
+
+    for (const auto &string : string_map_) {
+        total_bytes += string.first.size();
+    }
+
+    return total_bytes;
+}
+
+void LibGcp::SceneSerializer::SaveStringTable(std::ostream &file)
+{
+    /* order strings by their ids */
+    std::vector<const std::string *> strings(string_counter_);
+    for (const auto &[string, id] : string_map_) {
+        strings[id] = &string;
+    }
+
+    /* write offsets */
+    size_t offset{};
+    for (const auto *string : strings) {
+        file.write(reinterpret_cast<const char *>(&offset), sizeof(size_t));
+        offset += string->size() + sizeof(SceneSerialized::StringSerialized);
+    }
+
+    /* write strings */
+    for (const auto *string : strings) {
+        const SceneSerialized::StringSerialized string_struct{
+            .length = string->size(),
+        };
+
+        file.write(reinterpret_cast<const char *>(&string_struct), sizeof(SceneSerialized::StringSerialized));
+        file.write(string->c_str(), static_cast<std::streamsize>(string->size()));
     }
 }
 
+void LibGcp::SceneSerializer::ResetStringTable_()
+{
+    string_map_.clear();
+    string_counter_ = 1;
+    string_map_[""] = 0;
+}
+
 size_t LibGcp::SceneSerializer::GetStringId_(const std::string &name)
 {
     size_t id;
@@ -371,21 +1357,45 @@ std::tuple<LibGcp::Rc, LibGcp::Scene> LibGcp::SceneSerializer::LoadSceneShallow_
         return {rc, {}};
     }
 
-    /* open file as binary and read header */
+    /* open file as binary and read base header, shared by all versions */
     std::ifstream file(output_dir_ + "/" + scene_name, std::ios::binary);
-    SceneSerialized::SceneHeader header{};
-    file.read(reinterpret_cast<char *>(&header), sizeof(SceneSerialized::SceneHeader));
+    SceneSerialized::BaseHeader header{};
+    file.read(reinterpret_cast<char *>(&header), sizeof(SceneSerialized::BaseHeader));
 
     /* check magic */
-    if (header.base_header.magic != SceneSerialized::kMagic) {
+    if (header.magic != SceneSerialized::kMagic) {
         return {Rc::kCorruptedFile, kEmptyScene};
     }
 
     /* check version */
-    if (header.base_header.scene_version < kMinSceneVersion) {
+    if (header.scene_version < kMinSceneVersion) {
         return {Rc::kOutdatedProtocol, kEmptyScene};
     }
 
+    if (header.scene_version > kSceneVersion) {
+        return {Rc::kTooOldSoftware, kEmptyScene};
+    }
+
+    file.seekg(0);
+    if (header.scene_version == SceneVersion::V0_1_1) {
+        return LoadSceneLegacy_(file);
+    }
+
+    auto [rc, scene] = LoadSceneChunked_(file);
+
+    /* partitioned scenes keep their cells in the file next to the scene */
+    if (IsSuccess(rc) && std::filesystem::exists(GetWorldCellsPath_(scene_name))) {
+        scene.world_cells = GetWorldCellsPath_(scene_name);
+    }
+
+    return {rc, std::move(scene)};
+}
+
+std::tuple<LibGcp::Rc, LibGcp::Scene> LibGcp::SceneSerializer::LoadSceneLegacy_(std::ifstream &file) const
+{
+    SceneSerialized::SceneHeader header{};
+    file.read(reinterpret_cast<char *>(&header), sizeof(SceneSerialized::SceneHeader));
+
     Scene scene{};
 
     /* read whole scene -> we assume scene file are not that big */
@@ -476,6 +1486,58 @@ std::tuple<LibGcp::Rc, LibGcp::Scene> LibGcp::SceneSerializer::LoadSceneShallow_
     return {Rc::kSuccess, scene};
 }
 
+std::tuple<LibGcp::Rc, LibGcp::Scene> LibGcp::SceneSerializer::LoadSceneChunked_(std::ifstream &file) const
+{
+    SceneSerialized::ChunkedSceneHeader header{};
+    file.read(reinterpret_cast<char *>(&header), sizeof(SceneSerialized::ChunkedSceneHeader));
+
+    if (!file) {
+        return {Rc::kCorruptedFile, kEmptyScene};
+    }
+
+    Scene scene{};
+    const auto offset = [&](const Section section) {
+        return header.section_offsets[static_cast<size_t>(section)];
+    };
+
+    /* load settings */
+    Rc rc = ReadChunk<SceneSerialized::SettingsSerialized>(
+        file, offset(Section::kSettings), Section::kSettings,
+        [&](const SceneSerialized::SettingsSerialized *settings, const size_t count, const std::vector<std::string> &) {
+            scene.settings.reserve(count);
+            for (size_t idx = 0; idx < count; ++idx) {
+                scene.settings.emplace_back(settings[idx].setting, settings[idx].value);
+            }
+
+            return true;
+        }
+    );
+
+    if (IsSuccess(rc)) {
+        rc = ReadResourcesChunk(file, offset(Section::kResources), scene.resources);
+    }
+
+    if (IsSuccess(rc)) {
+        rc = ReadStaticObjectsChunk(
+            file, offset(Section::kStaticObjects), header.base_header.scene_version, scene.static_objects
+        );
+    }
+
+    if (IsSuccess(rc)) {
+        rc = ReadPointLightsChunk(file, offset(Section::kPointLights), scene.point_lights);
+    }
+
+    if (IsSuccess(rc)) {
+        rc = ReadSpotLightsChunk(file, offset(Section::kSpotLights), scene.spot_lights);
+    }
+
+    if (IsFailure(rc)) {
+        return {rc, kEmptyScene};
+    }
+
+    return {Rc::kSuccess, scene};
+}
+
 std::tuple<LibGcp::Rc, LibGcp::Scene> LibGcp::SceneSerializer::LoadSceneDeep_(UNUSED const std::string &scene_name
 ){NOT_IMPLEMENTED}
 
@@ -510,3 +1572,82 @@ LibGcp::Rc LibGcp::SceneSerializer::VerifyFile_(const std::string &file_name) co
 
     return Rc::kSuccess;
 }
+
+LibGcp::Rc LibGcp::SceneSerializer::CompactUnlocked_(const std::string &scene_name) const
+{
+    const std::string path     = output_dir_ + "/" + scene_name;
+    const std::string tmp_path = GetUniqueTempPath(path);
+
+    std::ifstream in(path, std::ios::binary);
+    SceneSerialized::ChunkedSceneHeader header{};
+    in.read(reinterpret_cast<char *>(&header), sizeof(SceneSerialized::ChunkedSceneHeader));
+
+    if (!in || header.base_header.magic != SceneSerialized::kMagic ||
+        header.base_header.scene_version != kSceneVersion) {
+        return Rc::kCorruptedFile;
+    }
+
+    std::error_code ec;
+    const size_t file_size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return Rc::kFailedToOpenFile;
+    }
+
+    std::ofstream out(tmp_path, std::ios::binary);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(SceneSerialized::ChunkedSceneHeader));
+
+    /* copy only the latest chunk of each section */
+    std::vector<char> buffer{};
+    header.num_chunks = 0;
+    for (size_t idx = 0; idx < kSectionsCount; ++idx) {
+        const size_t offset = header.section_offsets[idx];
+        if (offset == 0) {
+            continue;
+        }
+
+        SceneSerialized::ChunkHeader chunk{};
+        in.seekg(static_cast<std::streamoff>(offset));
+        in.read(reinterpret_cast<char *>(&chunk), sizeof(SceneSerialized::ChunkHeader));
+
+        /* the old file is the only copy, so anything not read in full keeps it in place */
+        const bool is_chunk_valid = in && chunk.magic == SceneSerialized::kChunkMagic &&
+                                    chunk.payload_bytes <= file_size - offset - sizeof(SceneSerialized::ChunkHeader);
+        if (is_chunk_valid) {
+            buffer.resize(chunk.payload_bytes);
+            in.read(buffer.data(), static_cast<std::streamsize>(chunk.payload_bytes));
+        }
+
+        if (!is_chunk_valid || !in) {
+            out.close();
+            std::filesystem::remove(tmp_path, ec);
+            return Rc::kCorruptedFile;
+        }
+
+        header.section_offsets[idx] = static_cast<size_t>(out.tellp());
+        out.write(reinterpret_cast<const char *>(&chunk), sizeof(SceneSerialized::ChunkHeader));
+        out.write(buffer.data(), static_cast<std::streamsize>(chunk.payload_bytes));
+        ++header.num_chunks;
+    }
+
+    header.base_header.payload_bytes = static_cast<size_t>(out.tellp()) - header.base_header.header_bytes;
+    out.seekp(0);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(SceneSerialized::ChunkedSceneHeader));
+    out.close();
+    in.close();
+
+    if (out.fail()) {
+        std::filesystem::remove(tmp_path);
+        return Rc::kFailedToOpenFile;
+    }
+
+    /* atomic swap with the old file */
+    std::filesystem::rename(tmp_path, path, ec);
+
+    if (ec) {
+        std::filesystem::remove(tmp_path);
+        return Rc::kNoPermission;
+    }
+
+    TRACE("Compacted scene: " << scene_name);
+    return Rc::kSuccess;
+}
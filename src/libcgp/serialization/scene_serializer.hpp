@@ -5,9 +5,15 @@
 #include <libcgp/intf.hpp>
 #include <libcgp/rc.hpp>
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 LIBGCP_DECL_START_
 class SceneSerializer
@@ -17,11 +23,38 @@ class SceneSerializer
     // Inner types
     // ------------------------------
 
+    using Section = SceneSerialized::Section;
+
+    static constexpr size_t kSectionsCount = SceneSerialized::kSectionsCount;
+
+    /* Number of superseded chunks after which the file is compacted in the background */
+    static constexpr size_t kCompactionThreshold = 4 * kSectionsCount;
+
+    /* Appended to the scene file name */
+    static constexpr const char *kWorldCellsExtension = ".cells";
+
+    struct WorldCellsIndex {
+        float cell_size;
+        std::vector<WorldCellsSerialized::CellEntry> cells;
+    };
+
     // ------------------------------
     // Object creation
     // ------------------------------
 
-    explicit SceneSerializer(const std::string &output_dir) : output_dir_(output_dir) {}
+    explicit SceneSerializer(const std::string &output_dir) : output_dir_(output_dir)
+    {
+        /* nothing is known to be saved yet */
+        for (auto &dirty : dirty_) {
+            dirty = true;
+        }
+    }
+
+    ~SceneSerializer();
+
+    SceneSerializer(const SceneSerializer &) = delete;
+
+    SceneSerializer &operator=(const SceneSerializer &) = delete;
 
     // ------------------------------
     // Class interaction
@@ -30,13 +63,46 @@ class SceneSerializer
     /* Without file format */
     Rc SerializeScene(const std::string &scene_name, SerializationType type);
 
+    /* Appends only the sections changed since the last save, falls back to full save when needed */
+    Rc SerializeSceneIncremental(const std::string &scene_name);
+
     std::tuple<Rc, Scene> LoadScene(const std::string &scene_name, SerializationType type);
 
+    /* Connects to ObjectMgr and ResourceMgr container events to track dirty sections */
+    void StartChangeTracking();
+
+    void StopChangeTracking();
+
+    FAST_CALL void MarkDirty(const Section section) noexcept { dirty_[static_cast<size_t>(section)] = true; }
+
+    void MarkClean() noexcept;
+
+    /* Rewrites the file leaving only the latest chunk of each section, runs on a separate thread */
+    void CompactAsync(const std::string &scene_name);
+
+    void WaitForCompaction();
+
+    /**
+     * Moves static objects of the saved scene, together with their models and lights, into square cells
+     * of given size stored in the cells file next to the scene. Scene has to be loaded again afterwards.
+     */
+    Rc PartitionScene(const std::string &scene_name, float cell_size);
+
+    /* Reads only the table of cells, content of each cell is loaded with LoadWorldCell */
+    NDSCRD static std::tuple<Rc, WorldCellsIndex> LoadWorldCellsIndex(const std::string &path);
+
+    /* Thread safe, does not touch any manager */
+    NDSCRD static std::tuple<Rc, WorldCellSpec> LoadWorldCell(
+        const std::string &path, const WorldCellsSerialized::CellEntry &entry
+    );
+
     // ------------------------------
     // Implementation methods
     // ------------------------------
 
     protected:
+    Rc PrepareOutputDir_() const;
+
     Rc SerializeSceneShallow_(const std::string &scene_name);
 
     Rc SerializeSceneDeep_(const std::string &scene_name);
@@ -45,21 +111,59 @@ class SceneSerializer
 
     Rc SerializeSceneDeepAttach_(const std::string &scene_name);
 
+    void WriteSection_(std::ostream &file, Section section);
+
+    template <class T>
+    void WriteChunk_(std::ostream &file, Section section, const std::vector<T> &records);
+
     std::vector<SceneSerialized::SettingsSerialized> SerializeSettings_();
 
     std::vector<SceneSerialized::ResourceSerialized> SerializeResources_();
 
-    std::vector<SceneSerialized::StaticObjectSerialized> SerializeStaticObjects_();
+    std::vector<std::byte> SerializeStaticObjects_();
+
+    template <class LightT, class SerializedT>
+    std::vector<SerializedT> SerializeLights_();
+
+    std::vector<SceneSerialized::SettingsSerialized> SerializeSpecs_(const setting_t &settings);
 
-    CxxUtils::MultiVector<SceneSerialized::PointLightSerialized, SceneSerialized::SpotLightSerialized> SerializeLights_(
+    std::vector<SceneSerialized::ResourceSerialized> SerializeSpecs_(const resource_t &resources);
+
+    std::vector<std::byte> SerializeSpecs_(const static_objects_t &objects);
+
+    std::vector<SceneSerialized::PointLightSerialized> SerializeSpecs_(const point_lights_t &lights);
+
+    std::vector<SceneSerialized::SpotLightSerialized> SerializeSpecs_(const spot_lights_t &lights);
+
+    /* Writes section built from the specs and stores its offset, empty sections are skipped */
+    template <class SpecsT>
+    void WriteSpecSection_(
+        std::ostream &file, Section section, const SpecsT &specs, std::array<size_t, kSectionsCount> &section_offsets
     );
 
-    void SaveStringTable(std::ofstream &file);
+    NDSCRD std::string GetWorldCellsPath_(const std::string &scene_name) const;
+
+    Rc WriteWorldCells_(const std::string &path, const world_cells_t &cells, float cell_size);
+
+    /* Moves content of all cells back to the scene */
+    NDSCRD static Rc MergeWorldCells_(Scene &scene);
+
+    NDSCRD bool IsSectionDirty_(Section section);
+
+    NDSCRD size_t GetStringTableBytes_() const;
+
+    void SaveStringTable(std::ostream &file);
+
+    void ResetStringTable_();
 
     size_t GetStringId_(const std::string &name);
 
     std::tuple<Rc, Scene> LoadSceneShallow_(const std::string &scene_name) const;
 
+    std::tuple<Rc, Scene> LoadSceneLegacy_(std::ifstream &file) const;
+
+    std::tuple<Rc, Scene> LoadSceneChunked_(std::ifstream &file) const;
+
     std::tuple<Rc, Scene> LoadSceneDeep_(const std::string &scene_name);
 
     std::tuple<Rc, Scene> LoadSceneDeepPack_(const std::string &scene_name);
@@ -68,6 +172,8 @@ class SceneSerializer
 
     Rc VerifyFile_(const std::string &file_name) const;
 
+    Rc CompactUnlocked_(const std::string &scene_name) const;
+
     // ------------------------------
     // Class fields
     // ------------------------------
@@ -76,6 +182,19 @@ class SceneSerializer
     std::unordered_map<std::string, size_t> string_map_;
 
     std::string output_dir_;
+
+    /* change tracking */
+    bool is_tracking_{};
+    std::array<std::atomic<bool>, kSectionsCount> dirty_{};
+    std::vector<SceneSerialized::SettingsSerialized> last_settings_{};
+    std::array<int, 3> object_listeners_{};
+    std::array<int, 3> model_listeners_{};
+    std::array<int, 3> texture_listeners_{};
+    std::array<int, 3> shader_listeners_{};
+
+    /* guards the file against concurrent append and compaction */
+    std::mutex file_mutex_{};
+    std::thread compaction_thread_{};
 };
 
 LIBGCP_DECL_END_
@@ -12,12 +12,32 @@
 static constexpr size_t kLogBufferSize = 512;
 
 void CheckShaderErrorsOpenGl(const GLuint shader_id, const char *file, const int line)
+{
+    if (IsShaderCompiledOpenGl(shader_id, file, line)) {
+        return;
+    }
+
+    glfwTerminate();
+    std::abort();
+}
+
+void CheckProgramErrorsOpenGl(const GLuint program_id, const char *file, const int line)
+{
+    if (IsProgramLinkedOpenGl(program_id, file, line)) {
+        return;
+    }
+
+    glfwTerminate();
+    std::abort();
+}
+
+bool IsShaderCompiledOpenGl(const GLuint shader_id, const char *file, const int line)
 {
     int success{};
 
     glGetShaderiv(shader_id, GL_COMPILE_STATUS, &success);
     if (success != 0) {
-        return;
+        return true;
     }
 
     std::array<char, kLogBufferSize> info_log{};
@@ -25,23 +45,21 @@ void CheckShaderErrorsOpenGl(const GLuint shader_id, const char *file, const int
     glGetShaderInfoLog(shader_id, kLogBufferSize, nullptr, info_log.data());
 
     std::cerr << "[ERROR] " << file << ' ' << line << ' ' << info_log.data() << '\n';
-    glfwTerminate();
-    std::abort();
+    return false;
 }
 
-void CheckProgramErrorsOpenGl(const GLuint program_id, const char *file, const int line)
+bool IsProgramLinkedOpenGl(const GLuint program_id, const char *file, const int line)
 {
     int success{};
 
     glGetProgramiv(program_id, GL_LINK_STATUS, &success);
     if (success != 0) {
-        return;
+        return true;
     }
 
     std::array<char, kLogBufferSize> info_log{};
 
     glGetProgramInfoLog(program_id, kLogBufferSize, nullptr, info_log.data());
     std::cerr << "[ERROR] " << file << ' ' << line << ' ' << info_log.data() << '\n';
-    glfwTerminate();
-    std::abort();
+    return false;
 }
@@ -6,4 +6,8 @@
 void CheckShaderErrorsOpenGl(GLuint shader_id, const char *file, int line);
 void CheckProgramErrorsOpenGl(GLuint program_id, const char *file, int line);
 
+/* Non-aborting variants, print the info log and report the status */
+bool IsShaderCompiledOpenGl(GLuint shader_id, const char *file, int line);
+bool IsProgramLinkedOpenGl(GLuint program_id, const char *file, int line);
+
 #endif  // UTILS_CHECKS_HPP_
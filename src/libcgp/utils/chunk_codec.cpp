@@ -0,0 +1,289 @@
+#include <libcgp/utils/chunk_codec.hpp>
+#include <libcgp/utils/profiler.hpp>
+
+#include <lz4.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static std::atomic<size_t> g_decoded_chunks{};
+static std::atomic<size_t> g_raw_bytes{};
+static std::atomic<size_t> g_stored_bytes{};
+static std::atomic<uint64_t> g_decode_ns{};
+
+/* Decoded block, blocks are placed one after another in the output */
+struct BlockView {
+    const std::byte *stored;
+    size_t stored_size;
+    std::byte *out;
+    size_t raw_size;
+};
+
+static void Shuffle(const std::byte *in, std::byte *out, const size_t size, const size_t stride) noexcept
+{
+    const size_t count = size / stride;
+
+    for (size_t byte = 0; byte < stride; ++byte) {
+        for (size_t idx = 0; idx < count; ++idx) {
+            out[byte * count + idx] = in[idx * stride + byte];
+        }
+    }
+
+    /* bytes of the incomplete element stay in place */
+    std::memcpy(out + count * stride, in + count * stride, size - count * stride);
+}
+
+static void UnShuffle(const std::byte *in, std::byte *out, const size_t size, const size_t stride) noexcept
+{
+    const size_t count = size / stride;
+
+    for (size_t byte = 0; byte < stride; ++byte) {
+        for (size_t idx = 0; idx < count; ++idx) {
+            out[idx * stride + byte] = in[byte * count + idx];
+        }
+    }
+
+    std::memcpy(out + count * stride, in + count * stride, size - count * stride);
+}
+
+static void Delta(const std::byte *in, std::byte *out, const size_t size, const size_t stride) noexcept
+{
+    const size_t head = std::min(size, stride);
+    std::memcpy(out, in, head);
+
+    for (size_t idx = head; idx < size; ++idx) {
+        out[idx] = static_cast<std::byte>(static_cast<uint8_t>(in[idx]) - static_cast<uint8_t>(in[idx - stride]));
+    }
+}
+
+static void UnDelta(std::byte *data, const size_t size, const size_t stride) noexcept
+{
+    for (size_t idx = stride; idx < size; ++idx) {
+        data[idx] = static_cast<std::byte>(static_cast<uint8_t>(data[idx]) + static_cast<uint8_t>(data[idx - stride]));
+    }
+}
+
+static bool DecodeBlock(
+    const BlockView &block, const LibGcp::ChunkCodec::Filter filter, const size_t stride,
+    std::vector<std::byte> &scratch
+)
+{
+    using Filter = LibGcp::ChunkCodec::Filter;
+
+    /* shuffled block cannot be restored in place */
+    std::byte *destination = block.out;
+    if (filter == Filter::kShuffle) {
+        scratch.resize(block.raw_size);
+        destination = scratch.data();
+    }
+
+    if (block.stored_size == block.raw_size) {
+        std::memcpy(destination, block.stored, block.raw_size);
+    } else {
+        const int decoded = LZ4_decompress_safe(
+            reinterpret_cast<const char *>(block.stored), reinterpret_cast<char *>(destination),
+            static_cast<int>(block.stored_size), static_cast<int>(block.raw_size)
+        );
+
+        if (decoded < 0 || static_cast<size_t>(decoded) != block.raw_size) {
+            return false;
+        }
+    }
+
+    switch (filter) {
+        case Filter::kShuffle:
+            UnShuffle(destination, block.out, block.raw_size, stride);
+            break;
+        case Filter::kDelta:
+            UnDelta(block.out, block.raw_size, stride);
+            break;
+        case Filter::kNone:
+            break;
+    }
+
+    return true;
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+std::vector<std::byte> LibGcp::ChunkCodec::Encode(
+    const std::span<const std::byte> raw, const Filter filter, const uint32_t stride
+)
+{
+    const size_t element    = std::max<uint32_t>(stride, 1);
+    const size_t block_size = std::max(element, kBlockSize / element * element);
+    const size_t num_blocks = (raw.size() + block_size - 1) / block_size;
+
+    const ChunkHeader header{
+        .magic       = kMagic,
+        .filter      = filter,
+        .stride      = static_cast<uint32_t>(element),
+        .block_size  = static_cast<uint32_t>(block_size),
+        .block_count = static_cast<uint32_t>(num_blocks),
+        .raw_size    = raw.size(),
+    };
+
+    std::vector<std::byte> chunk(sizeof(ChunkHeader) + num_blocks * sizeof(uint32_t));
+    std::memcpy(chunk.data(), &header, sizeof(ChunkHeader));
+
+    std::vector<std::byte> filtered(filter == Filter::kNone ? 0 : block_size);
+    std::vector<std::byte> compressed(LZ4_compressBound(static_cast<int>(block_size)));
+
+    for (size_t idx = 0; idx < num_blocks; ++idx) {
+        const size_t offset     = idx * block_size;
+        const size_t size       = std::min(block_size, raw.size() - offset);
+        const std::byte *source = raw.data() + offset;
+
+        switch (filter) {
+            case Filter::kShuffle:
+                Shuffle(source, filtered.data(), size, element);
+                source = filtered.data();
+                break;
+            case Filter::kDelta:
+                Delta(source, filtered.data(), size, element);
+                source = filtered.data();
+                break;
+            case Filter::kNone:
+                break;
+        }
+
+        int compressed_size = 0;
+        if constexpr (kUseCompression) {
+            compressed_size = LZ4_compress_default(
+                reinterpret_cast<const char *>(source), reinterpret_cast<char *>(compressed.data()),
+                static_cast<int>(size), static_cast<int>(compressed.size())
+            );
+        }
+
+        /* incompressible block is kept filtered, so decoding does not need to tell it apart */
+        const bool is_stored    = compressed_size <= 0 || static_cast<size_t>(compressed_size) >= size;
+        const std::byte *block  = is_stored ? source : compressed.data();
+        const auto stored_size  = static_cast<uint32_t>(is_stored ? size : compressed_size);
+        const size_t size_entry = sizeof(ChunkHeader) + idx * sizeof(uint32_t);
+
+        std::memcpy(chunk.data() + size_entry, &stored_size, sizeof(uint32_t));
+        chunk.insert(chunk.end(), block, block + stored_size);
+    }
+
+    return chunk;
+}
+
+size_t LibGcp::ChunkCodec::GetDecodedSize(const std::span<const std::byte> chunk) noexcept
+{
+    ChunkHeader header{};
+    if (chunk.size() < sizeof(ChunkHeader)) {
+        return 0;
+    }
+    std::memcpy(&header, chunk.data(), sizeof(ChunkHeader));
+
+    const bool is_valid = header.magic == kMagic && header.stride != 0 && header.block_size != 0 &&
+                          header.block_size % header.stride == 0 &&
+                          header.block_count == (header.raw_size + header.block_size - 1) / header.block_size &&
+                          header.filter <= Filter::kDelta;
+
+    return is_valid ? header.raw_size : 0;
+}
+
+bool LibGcp::ChunkCodec::Decode(const std::span<const std::byte> chunk, const std::span<std::byte> out)
+{
+    PROFILE_SCOPE("ChunkCodec::Decode");
+    const auto start = std::chrono::steady_clock::now();
+
+    if (GetDecodedSize(chunk) != out.size() || out.empty()) {
+        return false;
+    }
+
+    ChunkHeader header{};
+    std::memcpy(&header, chunk.data(), sizeof(ChunkHeader));
+
+    const size_t table_end = sizeof(ChunkHeader) + header.block_count * sizeof(uint32_t);
+    if (chunk.size() < table_end) {
+        return false;
+    }
+
+    /* resolve all blocks up front, so they can be decoded in any order */
+    std::vector<BlockView> blocks(header.block_count);
+    size_t offset = table_end;
+
+    for (size_t idx = 0; idx < blocks.size(); ++idx) {
+        uint32_t stored_size;
+        std::memcpy(&stored_size, chunk.data() + sizeof(ChunkHeader) + idx * sizeof(uint32_t), sizeof(uint32_t));
+
+        const size_t raw_offset = idx * header.block_size;
+        const size_t raw_size   = std::min<size_t>(header.block_size, out.size() - raw_offset);
+
+        if (chunk.size() - offset < stored_size || stored_size > raw_size) {
+            return false;
+        }
+
+        blocks[idx] = {
+            .stored      = chunk.data() + offset,
+            .stored_size = stored_size,
+            .out         = out.data() + raw_offset,
+            .raw_size    = raw_size,
+        };
+        offset += stored_size;
+    }
+
+    std::atomic<size_t> next_block{};
+    std::atomic<bool> is_valid{true};
+
+    const auto decode_blocks = [&] {
+        std::vector<std::byte> scratch{};
+
+        for (size_t idx = next_block++; idx < blocks.size() && is_valid; idx = next_block++) {
+            if (!DecodeBlock(blocks[idx], header.filter, header.stride, scratch)) {
+                is_valid = false;
+            }
+        }
+    };
+
+    /* starting a thread costs more than decoding a few blocks, so workers are only used for large chunks */
+    const size_t num_workers = std::clamp<size_t>(
+        out.size() / kMinBytesPerWorker, 1,
+        std::max<size_t>(1, std::min({kMaxDecodingWorkers, blocks.size(), size_t{std::thread::hardware_concurrency()}}))
+    );
+
+    /* calling thread decodes too */
+    std::vector<std::thread> workers{};
+    for (size_t idx = 1; idx < num_workers; ++idx) {
+        workers.emplace_back(decode_blocks);
+    }
+
+    decode_blocks();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    if (!is_valid) {
+        return false;
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    g_decode_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    g_raw_bytes += out.size();
+    g_stored_bytes += chunk.size();
+    ++g_decoded_chunks;
+
+    return true;
+}
+
+LibGcp::ChunkCodec::Stats LibGcp::ChunkCodec::GetStats() noexcept
+{
+    return {
+        .decoded_chunks = g_decoded_chunks,
+        .raw_bytes      = g_raw_bytes,
+        .stored_bytes   = g_stored_bytes,
+        .decode_ns      = g_decode_ns,
+    };
+}
@@ -0,0 +1,91 @@
+#ifndef UTILS_CHUNK_CODEC_HPP_
+#define UTILS_CHUNK_CODEC_HPP_
+
+#include <libcgp/defines.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+LIBGCP_DECL_START_
+/**
+ * LZ4 compression of large binary payloads written to disk.
+ * Payload is split into independent blocks, so large chunks are decoded by several worker threads at once,
+ * every worker gets at least kMinBytesPerWorker of output, so usual chunks are decoded on the calling thread only.
+ * Before compression each block may be filtered with the element stride of the payload:
+ *  - shuffle groups n-th bytes of all elements together, which suits vertices and other float arrays,
+ *  - delta replaces every byte with its difference from the same byte of the previous element, which suits pixels.
+ * Block that does not shrink is stored as is.
+ *
+ * Chunk layout:
+ *  ChunkHeader, uint32_t stored_size[block_count], blocks
+ */
+class ChunkCodec
+{
+    static constexpr uint32_t kMagic            = 0x4B484347;
+    static constexpr size_t kBlockSize          = 256 * 1024;
+    static constexpr size_t kMinBytesPerWorker  = 2 * 1024 * 1024;
+    static constexpr size_t kMaxDecodingWorkers = 8;
+
+#ifdef USE_CHUNK_COMPRESSION_
+    static constexpr bool kUseCompression = true;
+#else
+    static constexpr bool kUseCompression = false;
+#endif
+
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    enum class Filter : uint32_t {
+        kNone,
+        kShuffle,
+        kDelta,
+    };
+
+    struct PACK ChunkHeader {
+        uint32_t magic;
+        Filter filter;
+        uint32_t stride;
+        uint32_t block_size;
+        uint32_t block_count;
+        uint64_t raw_size;
+    };
+
+    /* Accumulated over the whole process, allows to compare load time against the size read from disk */
+    struct Stats {
+        size_t decoded_chunks;
+        size_t raw_bytes;
+        size_t stored_bytes;
+        uint64_t decode_ns;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    ChunkCodec() = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    /* Blocks are only stored when compression is disabled in the build, the layout stays the same */
+    NDSCRD static std::vector<std::byte> Encode(
+        std::span<const std::byte> raw, Filter filter = Filter::kNone, uint32_t stride = 1
+    );
+
+    /* Returns 0 for the malformed chunk */
+    NDSCRD static size_t GetDecodedSize(std::span<const std::byte> chunk) noexcept;
+
+    /* Output must be exactly of the decoded size, fails on malformed chunk */
+    NDSCRD static bool Decode(std::span<const std::byte> chunk, std::span<std::byte> out);
+
+    NDSCRD static Stats GetStats() noexcept;
+};
+
+LIBGCP_DECL_END_
+
+#endif  // UTILS_CHUNK_CODEC_HPP_
@@ -0,0 +1,160 @@
+#include <libcgp/utils/file_watcher.hpp>
+
+#include <array>
+#include <cassert>
+#include <filesystem>
+#include <string>
+#include <utility>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif  // __linux__
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+#ifdef __linux__
+static constexpr size_t kEventBufferSize = 16 * 1024;
+static constexpr uint32_t kWatchMask     = IN_CLOSE_WRITE | IN_MOVED_TO;
+#endif  // __linux__
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::FileWatcher::FileWatcher(callback_t callback) : callback_(std::move(callback))
+{
+#ifdef __linux__
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (inotify_fd_ < 0) {
+        TRACE("Failed to initialize inotify, hot reload disabled");
+    }
+#else
+    TRACE("File watching is not supported on this platform");
+#endif  // __linux__
+}
+
+LibGcp::FileWatcher::~FileWatcher()
+{
+    Stop();
+
+#ifdef __linux__
+    if (inotify_fd_ >= 0) {
+        close(inotify_fd_);
+        inotify_fd_ = -1;
+    }
+#endif  // __linux__
+}
+
+void LibGcp::FileWatcher::Start()
+{
+    if (is_running_ || inotify_fd_ < 0) {
+        return;
+    }
+
+    is_running_ = true;
+    thread_     = std::thread([this] {
+        Run_();
+    });
+}
+
+void LibGcp::FileWatcher::Stop()
+{
+    is_running_ = false;
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void LibGcp::FileWatcher::Watch(const std::string &path)
+{
+    if (inotify_fd_ < 0) {
+        return;
+    }
+
+    const std::string file = NormalizePath(path);
+    const std::string dir  = std::filesystem::path(file).parent_path().string();
+
+    const std::lock_guard lock(mutex_);
+    if (!watched_files_.insert(file).second) {
+        return;
+    }
+
+#ifdef __linux__
+    /* same directory returns the same descriptor */
+    const int wd = inotify_add_watch(inotify_fd_, dir.c_str(), kWatchMask);
+
+    if (wd < 0) {
+        TRACE("Failed to watch directory: " << dir);
+        return;
+    }
+
+    watched_dirs_[wd] = dir;
+    TRACE("Watching file: " << file);
+#endif  // __linux__
+}
+
+std::string LibGcp::FileWatcher::NormalizePath(const std::string &path)
+{
+    std::error_code ec;
+    const auto normalized = std::filesystem::weakly_canonical(path, ec);
+
+    return ec ? path : normalized.string();
+}
+
+void LibGcp::FileWatcher::Run_()
+{
+#ifdef __linux__
+    alignas(inotify_event) std::array<char, kEventBufferSize> buffer{};
+
+    while (is_running_) {
+        pollfd fd{
+            .fd      = inotify_fd_,
+            .events  = POLLIN,
+            .revents = 0,
+        };
+
+        /* timeout allows to notice stop requests */
+        if (poll(&fd, 1, kPollTimeoutMs) <= 0 || (fd.revents & POLLIN) == 0) {
+            continue;
+        }
+
+        const ssize_t bytes = read(inotify_fd_, buffer.data(), buffer.size());
+        if (bytes <= 0) {
+            continue;
+        }
+
+        for (ssize_t offset = 0; offset < bytes;) {
+            const auto event = reinterpret_cast<const inotify_event *>(buffer.data() + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            if (event->len == 0) {
+                continue;
+            }
+
+            std::string file{};
+            {
+                const std::lock_guard lock(mutex_);
+
+                const auto dir_it = watched_dirs_.find(event->wd);
+                if (dir_it == watched_dirs_.end()) {
+                    continue;
+                }
+
+                file = dir_it->second + "/" + event->name;
+                if (!watched_files_.contains(file)) {
+                    continue;
+                }
+            }
+
+            TRACE("Detected change of file: " << file);
+            callback_(file);
+        }
+    }
+#endif  // __linux__
+}
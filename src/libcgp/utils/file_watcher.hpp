@@ -0,0 +1,82 @@
+#ifndef UTILS_FILE_WATCHER_HPP_
+#define UTILS_FILE_WATCHER_HPP_
+
+#include <libcgp/defines.hpp>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+LIBGCP_DECL_START_
+/**
+ * Watches files for modifications using inotify, callback is invoked on the watcher thread.
+ * Parent directories are watched instead of the files, so editors replacing files on save are handled too.
+ * On platforms without inotify the watcher does nothing.
+ */
+class FileWatcher
+{
+    static constexpr int kPollTimeoutMs = 100;
+
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    using callback_t = std::function<void(const std::string &path)>;
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    explicit FileWatcher(callback_t callback);
+
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher &) = delete;
+
+    FileWatcher &operator=(const FileWatcher &) = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    void Start();
+
+    void Stop();
+
+    /* Thread safe, path is canonicalized before registering */
+    void Watch(const std::string &path);
+
+    NDSCRD FAST_CALL bool IsRunning() const noexcept { return is_running_; }
+
+    NDSCRD static std::string NormalizePath(const std::string &path);
+
+    // ------------------------------
+    // Class implementation methods
+    // ------------------------------
+
+    protected:
+    void Run_();
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    callback_t callback_;
+
+    int inotify_fd_{-1};
+    std::atomic<bool> is_running_{};
+    std::thread thread_{};
+
+    std::mutex mutex_{};
+    std::unordered_map<int, std::string> watched_dirs_{};
+    std::unordered_set<std::string> watched_files_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // UTILS_FILE_WATCHER_HPP_
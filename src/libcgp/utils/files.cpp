@@ -1,8 +1,52 @@
 #include <libcgp/utils/files.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
 #include <string>
 
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+#ifndef CACHE_DIR_
+#define CACHE_DIR_ "cache"
+#endif  // CACHE_DIR_
+
+/* Falls back to the cwd where the executable path is not known */
+static std::filesystem::path GetExecutableDir()
+{
+    std::error_code ec;
+
+#ifdef __linux__
+    const auto executable = std::filesystem::read_symlink("/proc/self/exe", ec);
+    if (!ec) {
+        return executable.parent_path();
+    }
+#endif  // __linux__
+
+    return std::filesystem::current_path(ec);
+}
+
+static int GetProcessId()
+{
+#ifdef _WIN32
+    return _getpid();
+#else
+    return static_cast<int>(getpid());
+#endif
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
 bool LibGcp::FileWriteable(const std::string &path) noexcept
 {
     std::error_code ec;
@@ -54,3 +98,20 @@ std::string LibGcp::ConvertFullPathToRelative(const std::string &path) noexcept
 
     return relativePath.string();
 }
+
+std::string LibGcp::GetUniqueTempPath(const std::string &path)
+{
+    static std::atomic<uint64_t> counter{};
+
+    return path + "." + std::to_string(GetProcessId()) + "." + std::to_string(counter.fetch_add(1)) + ".tmp";
+}
+
+std::string LibGcp::GetCachePath(const std::string &name)
+{
+    static const std::filesystem::path cache_dir = [] {
+        const std::filesystem::path dir(CACHE_DIR_);
+        return dir.is_absolute() ? dir : GetExecutableDir() / dir;
+    }();
+
+    return (cache_dir / name).string();
+}
@@ -30,6 +30,12 @@ NDSCRD std::string GetFileFormat(const std::string& path) noexcept;
 
 NDSCRD std::string ConvertFullPathToRelative(const std::string& path) noexcept;
 
+/* Temporary file next to the path, unique across threads and processes, renamed over the path once written */
+NDSCRD std::string GetUniqueTempPath(const std::string& path);
+
+/* Path inside the cache directory given by CACHE_DIR, relative directory is anchored at the executable, not the cwd */
+NDSCRD std::string GetCachePath(const std::string& name);
+
 LIBGCP_DECL_END_
 
 #endif  // UTILS_FILES_HPP_
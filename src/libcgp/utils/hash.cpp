@@ -0,0 +1,145 @@
+#include <libcgp/utils/hash.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+static constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+static constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+static constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+static constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+L_FAST_CALL uint64_t ReadWord(const unsigned char *data) noexcept
+{
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(uint64_t));
+    return word;
+}
+
+L_FAST_CALL uint64_t Round(const uint64_t acc, const uint64_t input) noexcept
+{
+    return std::rotl(acc + input * kPrime2, 31) * kPrime1;
+}
+
+L_FAST_CALL uint64_t Avalanche(uint64_t value) noexcept
+{
+    value ^= value >> 33;
+    value *= kPrime2;
+    value ^= value >> 29;
+    value *= kPrime3;
+    value ^= value >> 32;
+    return value;
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::ContentHasher::ContentHasher(const uint64_t seed) noexcept : acc_{seed + kPrime1 + kPrime2, seed - kPrime1} {}
+
+void LibGcp::ContentHasher::Update(const void *data, size_t size) noexcept
+{
+    auto bytes = static_cast<const unsigned char *>(data);
+    total_bytes_ += size;
+
+    /* fill up previously started stripe */
+    if (buffered_ != 0) {
+        const size_t to_copy = std::min(size, kStripeBytes - buffered_);
+        std::memcpy(buffer_.data() + buffered_, bytes, to_copy);
+
+        buffered_ += to_copy;
+        bytes += to_copy;
+        size -= to_copy;
+
+        if (buffered_ < kStripeBytes) {
+            return;
+        }
+
+        ConsumeStripe_(buffer_.data());
+        buffered_ = 0;
+    }
+
+    /* process full stripes directly from the input */
+    while (size >= kStripeBytes) {
+        ConsumeStripe_(bytes);
+        bytes += kStripeBytes;
+        size -= kStripeBytes;
+    }
+
+    std::memcpy(buffer_.data(), bytes, size);
+    buffered_ = size;
+}
+
+LibGcp::Hash128 LibGcp::ContentHasher::Finalize() const noexcept
+{
+    uint64_t low  = acc_[0] ^ (total_bytes_ * kPrime5);
+    uint64_t high = acc_[1] ^ std::rotl(total_bytes_ * kPrime4, 17);
+
+    /* mix remaining tail */
+    for (size_t idx = 0; idx < buffered_; ++idx) {
+        low  = std::rotl(low ^ (buffer_[idx] * kPrime5), 11) * kPrime1;
+        high = std::rotl(high ^ (buffer_[idx] * kPrime1), 13) * kPrime4;
+    }
+
+    low += high;
+    high += low;
+
+    return {
+        .low  = Avalanche(low),
+        .high = Avalanche(high),
+    };
+}
+
+void LibGcp::ContentHasher::ConsumeStripe_(const unsigned char *stripe) noexcept
+{
+    acc_[0] = Round(acc_[0], ReadWord(stripe));
+    acc_[1] = Round(acc_[1], ReadWord(stripe + sizeof(uint64_t)));
+}
+
+LibGcp::Hash128 LibGcp::HashBytes(const void *data, const size_t size, const uint64_t seed) noexcept
+{
+    ContentHasher hasher(seed);
+    hasher.Update(data, size);
+    return hasher.Finalize();
+}
+
+std::optional<LibGcp::Hash128> LibGcp::HashFileIdentity(const std::string &path, const uint64_t seed) noexcept
+{
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+
+    const auto write_time = std::filesystem::last_write_time(path, ec).time_since_epoch().count();
+    if (ec) {
+        return std::nullopt;
+    }
+
+    ContentHasher hasher(seed);
+    hasher.Update(path.size());
+    hasher.Update(path.data(), path.size());
+    hasher.Update(size);
+    hasher.Update(write_time);
+
+    return hasher.Finalize();
+}
+
+std::string LibGcp::ToHexString(const Hash128 &hash)
+{
+    char str[2 * sizeof(Hash128) + 1];
+    std::snprintf(
+        str, sizeof(str), "%016llx%016llx", static_cast<unsigned long long>(hash.high),
+        static_cast<unsigned long long>(hash.low)
+    );
+
+    return str;
+}
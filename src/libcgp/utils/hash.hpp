@@ -0,0 +1,90 @@
+#ifndef UTILS_HASH_HPP_
+#define UTILS_HASH_HPP_
+
+#include <libcgp/defines.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+LIBGCP_DECL_START_
+// ------------------------------
+// Hash types
+// ------------------------------
+
+struct Hash128 {
+    uint64_t low;
+    uint64_t high;
+
+    bool operator==(const Hash128 &) const = default;
+};
+
+struct Hash128Hasher {
+    NDSCRD FAST_CALL size_t operator()(const Hash128 &hash) const noexcept
+    {
+        return static_cast<size_t>(hash.low ^ (hash.high >> 1));
+    }
+};
+
+// ------------------------------
+// Content hasher
+// ------------------------------
+
+/* Streaming, non-cryptographic 128-bit hash used to identify resource payloads */
+class ContentHasher
+{
+    static constexpr size_t kStripeBytes = 16;
+
+    public:
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    explicit ContentHasher(uint64_t seed = 0) noexcept;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    void Update(const void *data, size_t size) noexcept;
+
+    template <class T>
+        requires std::is_trivially_copyable_v<T>
+    FAST_CALL void Update(const T &value) noexcept
+    {
+        Update(&value, sizeof(T));
+    }
+
+    NDSCRD Hash128 Finalize() const noexcept;
+
+    // ------------------------------
+    // Class implementation methods
+    // ------------------------------
+
+    protected:
+    void ConsumeStripe_(const unsigned char *stripe) noexcept;
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    std::array<uint64_t, 2> acc_{};
+    std::array<unsigned char, kStripeBytes> buffer_{};
+    size_t buffered_{};
+    uint64_t total_bytes_{};
+};
+
+NDSCRD Hash128 HashBytes(const void *data, size_t size, uint64_t seed = 0) noexcept;
+
+/* Identifies the file by its path, size and modification time, fails when the file does not exist */
+NDSCRD std::optional<Hash128> HashFileIdentity(const std::string &path, uint64_t seed = 0) noexcept;
+
+/* 32 lowercase hex digits, usable as a file name */
+NDSCRD std::string ToHexString(const Hash128 &hash);
+
+LIBGCP_DECL_END_
+
+#endif  // UTILS_HASH_HPP_
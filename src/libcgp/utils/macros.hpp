@@ -26,6 +26,8 @@
 
 #define ENSURE_SUCCESS_SHADER_OPENGL(shader_id)   CheckShaderErrorsOpenGl(shader_id, __FILE__, __LINE__)
 #define ENSURE_SUCCESS_PROGRAM_OPENGL(program_id) CheckProgramErrorsOpenGl(program_id, __FILE__, __LINE__)
+#define IS_SUCCESS_SHADER_OPENGL(shader_id)       IsShaderCompiledOpenGl(shader_id, __FILE__, __LINE__)
+#define IS_SUCCESS_PROGRAM_OPENGL(program_id)     IsProgramLinkedOpenGl(program_id, __FILE__, __LINE__)
 #define NOT_IMPLEMENTED                                                  \
     {                                                                    \
         std::cerr << "Function: " << __func__ << " is not implemented!"; \
@@ -0,0 +1,218 @@
+#include <libcgp/utils/memory_tracker.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <utility>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static constexpr std::array kCategoryNames{
+    "textures", "mesh_buffers", "mesh_copies", "render_targets", "shaders", "streaming",
+};
+
+static constexpr std::array kCategoryPools{
+    LibGcp::MemoryTracker::Pool::kVram, LibGcp::MemoryTracker::Pool::kVram,
+    LibGcp::MemoryTracker::Pool::kRam, LibGcp::MemoryTracker::Pool::kVram,
+    LibGcp::MemoryTracker::Pool::kEstimatedVram, LibGcp::MemoryTracker::Pool::kRam,
+};
+
+static constexpr std::array kPoolNames{
+    "vram", "ram", "vram_estimated",
+};
+
+static_assert(kCategoryNames.size() == LibGcp::MemoryTracker::kCategoryCount);
+static_assert(kCategoryPools.size() == LibGcp::MemoryTracker::kCategoryCount);
+static_assert(kPoolNames.size() == static_cast<size_t>(LibGcp::MemoryTracker::Pool::kLast));
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::MemoryTracker::Allocation::Allocation(const Category category, const size_t bytes)
+    : Allocation(category, bytes, current_owner_ != nullptr ? *current_owner_ : std::string(kUnknownOwner))
+{
+}
+
+LibGcp::MemoryTracker::Allocation::Allocation(const Category category, const size_t bytes, std::string owner)
+    : id_(Register_(category, bytes, std::move(owner))), category_(category), bytes_(bytes)
+{
+}
+
+LibGcp::MemoryTracker::Allocation::Allocation(Allocation &&other) noexcept
+    : id_(std::exchange(other.id_, 0)), category_(other.category_), bytes_(std::exchange(other.bytes_, 0))
+{
+}
+
+LibGcp::MemoryTracker::Allocation &LibGcp::MemoryTracker::Allocation::operator=(Allocation &&other) noexcept
+{
+    if (this != &other) {
+        Release();
+
+        id_       = std::exchange(other.id_, 0);
+        category_ = other.category_;
+        bytes_    = std::exchange(other.bytes_, 0);
+    }
+
+    return *this;
+}
+
+void LibGcp::MemoryTracker::Allocation::Resize(const size_t bytes) noexcept
+{
+    if (id_ == 0 || bytes == bytes_) {
+        return;
+    }
+
+    Resize_(id_, category_, bytes_, bytes);
+    bytes_ = bytes;
+}
+
+void LibGcp::MemoryTracker::Allocation::Release() noexcept
+{
+    if (id_ == 0) {
+        return;
+    }
+
+    Unregister_(id_, category_, bytes_);
+    id_    = 0;
+    bytes_ = 0;
+}
+
+LibGcp::MemoryTracker::CategoryStats LibGcp::MemoryTracker::GetCategoryStats(const Category category) noexcept
+{
+    const auto &totals = totals_[static_cast<size_t>(category)];
+
+    return {
+        .bytes       = totals.bytes.load(std::memory_order_relaxed),
+        .allocations = totals.allocations.load(std::memory_order_relaxed),
+    };
+}
+
+size_t LibGcp::MemoryTracker::GetPoolBytes(const Pool pool) noexcept
+{
+    size_t bytes = 0;
+    for (size_t idx = 0; idx < kCategoryCount; ++idx) {
+        if (kCategoryPools[idx] == pool) {
+            bytes += totals_[idx].bytes.load(std::memory_order_relaxed);
+        }
+    }
+
+    return bytes;
+}
+
+std::vector<LibGcp::MemoryTracker::OwnerStats> LibGcp::MemoryTracker::GetOwnerBreakdown()
+{
+    std::map<std::pair<std::string, Category>, OwnerStats> grouped{};
+    {
+        auto &registry = GetRegistry_();
+        const std::lock_guard lock(registry.mutex);
+
+        for (const auto &[id, entry] : registry.entries) {
+            auto [it, is_new] = grouped.try_emplace({entry.owner, entry.category});
+            if (is_new) {
+                it->second.owner    = entry.owner;
+                it->second.category = entry.category;
+            }
+
+            it->second.bytes += entry.bytes;
+            ++it->second.allocations;
+        }
+    }
+
+    std::vector<OwnerStats> breakdown{};
+    breakdown.reserve(grouped.size());
+    for (auto &[key, stats] : grouped) {
+        breakdown.push_back(std::move(stats));
+    }
+
+    std::ranges::stable_sort(breakdown, std::greater{}, &OwnerStats::bytes);
+    return breakdown;
+}
+
+LibGcp::Rc LibGcp::MemoryTracker::DumpCsv(const std::string &path)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        return Rc::kFailedToOpenFile;
+    }
+
+    file << "owner,category,pool,bytes,allocations\n";
+    for (const auto &stats : GetOwnerBreakdown()) {
+        /* owners are file paths, quoted as they may contain commas */
+        file << '"' << stats.owner << "\"," << GetCategoryName(stats.category) << ','
+             << GetPoolName(GetCategoryPool(stats.category)) << ',' << stats.bytes << ',' << stats.allocations << '\n';
+    }
+
+    for (size_t idx = 0; idx < kCategoryCount; ++idx) {
+        const auto category = static_cast<Category>(idx);
+        const auto stats    = GetCategoryStats(category);
+
+        file << "\"total\"," << GetCategoryName(category) << ',' << GetPoolName(GetCategoryPool(category)) << ','
+             << stats.bytes << ',' << stats.allocations << '\n';
+    }
+
+    return file.good() ? Rc::kSuccess : Rc::kUnknownFailure;
+}
+
+const char *LibGcp::MemoryTracker::GetCategoryName(const Category category) noexcept
+{
+    return kCategoryNames[static_cast<size_t>(category)];
+}
+
+LibGcp::MemoryTracker::Pool LibGcp::MemoryTracker::GetCategoryPool(const Category category) noexcept
+{
+    return kCategoryPools[static_cast<size_t>(category)];
+}
+
+const char *LibGcp::MemoryTracker::GetPoolName(const Pool pool) noexcept
+{
+    return kPoolNames[static_cast<size_t>(pool)];
+}
+
+uint64_t LibGcp::MemoryTracker::Register_(const Category category, const size_t bytes, std::string owner)
+{
+    auto &totals = totals_[static_cast<size_t>(category)];
+    totals.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    totals.allocations.fetch_add(1, std::memory_order_relaxed);
+
+    auto &registry = GetRegistry_();
+    const std::lock_guard lock(registry.mutex);
+
+    const uint64_t id = registry.next_id++;
+    registry.entries.emplace(id, Entry{.owner = std::move(owner), .category = category, .bytes = bytes});
+
+    return id;
+}
+
+void LibGcp::MemoryTracker::Resize_(
+    const uint64_t id, const Category category, const size_t old_bytes, const size_t new_bytes
+) noexcept
+{
+    auto &totals = totals_[static_cast<size_t>(category)];
+    totals.bytes.fetch_add(new_bytes, std::memory_order_relaxed);
+    totals.bytes.fetch_sub(old_bytes, std::memory_order_relaxed);
+
+    auto &registry = GetRegistry_();
+    const std::lock_guard lock(registry.mutex);
+    registry.entries.at(id).bytes = new_bytes;
+}
+
+void LibGcp::MemoryTracker::Unregister_(const uint64_t id, const Category category, const size_t bytes) noexcept
+{
+    auto &totals = totals_[static_cast<size_t>(category)];
+    totals.bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    totals.allocations.fetch_sub(1, std::memory_order_relaxed);
+
+    auto &registry = GetRegistry_();
+    const std::lock_guard lock(registry.mutex);
+    registry.entries.erase(id);
+}
+
+LibGcp::MemoryTracker::Registry &LibGcp::MemoryTracker::GetRegistry_() noexcept
+{
+    static auto *registry = new Registry();
+    return *registry;
+}
@@ -0,0 +1,190 @@
+#ifndef UTILS_MEMORY_TRACKER_HPP_
+#define UTILS_MEMORY_TRACKER_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/rc.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+LIBGCP_DECL_START_
+/**
+ * Registry of GPU allocations and large CPU buffers. Every allocation is held by a RAII Allocation object living
+ * next to the memory it describes, it carries the size, the category and the owner, i.e. the resource which caused
+ * the allocation. Owners are taken from the innermost OwnerScope of the allocating thread unless given explicitly,
+ * so the loaders only need to open a scope named after the loaded file.
+ *
+ * Totals per category are kept in atomics and may be read from any thread without locking, the per owner breakdown
+ * walks all allocations under the lock and is meant for the overlay and dumps only.
+ */
+class MemoryTracker
+{
+    // ------------------------------
+    // Class internals
+    // ------------------------------
+
+    public:
+    static constexpr const char *kUnknownOwner = "unknown";
+
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    enum class Pool : uint8_t {
+        kVram,
+        kRam,
+
+        /* sizes known only by a proxy, e.g. the program binary length, not counted into the VRAM */
+        kEstimatedVram,
+        kLast,
+    };
+
+    enum class Category : uint8_t {
+        kTextures,
+        kMeshBuffers,
+        kMeshCopies,
+        kRenderTargets,
+        kShaders,
+        kStreaming,
+        kLast,
+    };
+
+    static constexpr size_t kCategoryCount = static_cast<size_t>(Category::kLast);
+
+    struct CategoryStats {
+        size_t bytes;
+        size_t allocations;
+    };
+
+    struct OwnerStats {
+        std::string owner;
+        Category category;
+        size_t bytes;
+        size_t allocations;
+    };
+
+    /* Registered allocation, moves along with the memory it describes */
+    class Allocation
+    {
+        public:
+        Allocation() noexcept = default;
+
+        /* Owner is taken from the innermost OwnerScope of the calling thread */
+        Allocation(Category category, size_t bytes);
+
+        Allocation(Category category, size_t bytes, std::string owner);
+
+        ~Allocation() { Release(); }
+
+        Allocation(const Allocation &)            = delete;
+        Allocation &operator=(const Allocation &) = delete;
+
+        Allocation(Allocation &&other) noexcept;
+
+        Allocation &operator=(Allocation &&other) noexcept;
+
+        /* Allocation of zero bytes stays registered, e.g. render targets of the minimized window */
+        void Resize(size_t bytes) noexcept;
+
+        void Release() noexcept;
+
+        NDSCRD FAST_CALL size_t GetBytes() const noexcept { return bytes_; }
+
+        NDSCRD FAST_CALL bool IsRegistered() const noexcept { return id_ != 0; }
+
+        private:
+        uint64_t id_{};
+        Category category_{};
+        size_t bytes_{};
+    };
+
+    /* Names the owner of allocations made by the calling thread while the scope lives, scopes nest */
+    class OwnerScope
+    {
+        public:
+        explicit OwnerScope(const std::string &owner) noexcept : previous_(current_owner_) { current_owner_ = &owner; }
+
+        ~OwnerScope() { current_owner_ = previous_; }
+
+        OwnerScope(const OwnerScope &)            = delete;
+        OwnerScope &operator=(const OwnerScope &) = delete;
+
+        private:
+        const std::string *previous_;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    MemoryTracker() = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    NDSCRD static CategoryStats GetCategoryStats(Category category) noexcept;
+
+    NDSCRD static size_t GetPoolBytes(Pool pool) noexcept;
+
+    /* Allocations summed per owner and category, largest first */
+    NDSCRD static std::vector<OwnerStats> GetOwnerBreakdown();
+
+    /* Writes the per owner breakdown followed by the category totals */
+    NDSCRD static Rc DumpCsv(const std::string &path);
+
+    NDSCRD static const char *GetCategoryName(Category category) noexcept;
+
+    NDSCRD static Pool GetCategoryPool(Category category) noexcept;
+
+    NDSCRD static const char *GetPoolName(Pool pool) noexcept;
+
+    // ---------------------------------
+    // Class implementation methods
+    // ---------------------------------
+
+    protected:
+    struct Entry {
+        std::string owner;
+        Category category;
+        size_t bytes;
+    };
+
+    struct Registry {
+        std::mutex mutex;
+        std::unordered_map<uint64_t, Entry> entries;
+        uint64_t next_id{1};
+    };
+
+    struct Totals {
+        std::atomic<size_t> bytes;
+        std::atomic<size_t> allocations;
+    };
+
+    NDSCRD static uint64_t Register_(Category category, size_t bytes, std::string owner);
+
+    static void Resize_(uint64_t id, Category category, size_t old_bytes, size_t new_bytes) noexcept;
+
+    static void Unregister_(uint64_t id, Category category, size_t bytes) noexcept;
+
+    /* Never destroyed, allocations held by other statics may be released after the static destructors ran */
+    NDSCRD static Registry &GetRegistry_() noexcept;
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    static inline std::array<Totals, kCategoryCount> totals_{};
+
+    static thread_local inline const std::string *current_owner_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // UTILS_MEMORY_TRACKER_HPP_
@@ -0,0 +1,184 @@
+#include <libcgp/utils/chunk_codec.hpp>
+#include <libcgp/utils/files.hpp>
+#include <libcgp/utils/mip_file.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static bool ReadHeader(std::ifstream &file, LibGcp::MipFileHeader &header)
+{
+    if (!file.read(reinterpret_cast<char *>(&header), sizeof(LibGcp::MipFileHeader))) {
+        return false;
+    }
+
+    return header.magic == LibGcp::kMipFileMagic && header.version == LibGcp::kMipFileVersion &&
+           header.mip_count == LibGcp::GetMipCount(header.width, header.height);
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::mip_chain_t LibGcp::GenerateMipChain(
+    const unsigned char *data, const int width, const int height, const int channels
+)
+{
+    const int mip_count = GetMipCount(width, height);
+
+    mip_chain_t chain(mip_count);
+    chain[0].assign(data, data + GetMipSizeBytes(width, height, channels, 0));
+
+    for (int level = 1; level < mip_count; ++level) {
+        const auto &src      = chain[level - 1];
+        const int src_width  = GetMipDimension(width, level - 1);
+        const int src_height = GetMipDimension(height, level - 1);
+        const int dst_width  = GetMipDimension(width, level);
+        const int dst_height = GetMipDimension(height, level);
+
+        auto &dst = chain[level];
+        dst.resize(GetMipSizeBytes(width, height, channels, level));
+
+        for (int y = 0; y < dst_height; ++y) {
+            /* odd sizes clamp the second sample to the edge */
+            const int y0 = std::min(2 * y, src_height - 1);
+            const int y1 = std::min(2 * y + 1, src_height - 1);
+
+            for (int x = 0; x < dst_width; ++x) {
+                const int x0 = std::min(2 * x, src_width - 1);
+                const int x1 = std::min(2 * x + 1, src_width - 1);
+
+                for (int c = 0; c < channels; ++c) {
+                    const unsigned sum = src[(y0 * src_width + x0) * channels + c] +
+                                         src[(y0 * src_width + x1) * channels + c] +
+                                         src[(y1 * src_width + x0) * channels + c] +
+                                         src[(y1 * src_width + x1) * channels + c];
+
+                    dst[(y * dst_width + x) * channels + c] = static_cast<unsigned char>((sum + 2) / 4);
+                }
+            }
+        }
+    }
+
+    return chain;
+}
+
+bool LibGcp::HasValidMipFile(const std::string &path, const int width, const int height, const int channels)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    MipFileHeader header{};
+    return file.is_open() && ReadHeader(file, header) && header.width == width && header.height == height &&
+           header.channels == channels;
+}
+
+bool LibGcp::WriteMipFile(
+    const std::string &path, const int width, const int height, const int channels, const mip_chain_t &chain
+)
+{
+    /* another instance may have written the file in the meantime */
+    if (HasValidMipFile(path, width, height, channels)) {
+        return true;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+
+    const std::string tmp_path = GetUniqueTempPath(path);
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open()) {
+            return false;
+        }
+
+        const MipFileHeader header{
+            .magic     = kMipFileMagic,
+            .version   = kMipFileVersion,
+            .width     = width,
+            .height    = height,
+            .channels  = channels,
+            .mip_count = static_cast<int32_t>(chain.size()),
+        };
+
+        std::vector<std::vector<std::byte>> chunks{};
+        std::vector<MipLevelEntry> entries{};
+        size_t offset = sizeof(MipFileHeader) + chain.size() * sizeof(MipLevelEntry);
+
+        for (const auto &level : chain) {
+            chunks.push_back(ChunkCodec::Encode(
+                std::as_bytes(std::span(level)), ChunkCodec::Filter::kDelta, static_cast<uint32_t>(channels)
+            ));
+            entries.push_back({.offset = offset, .size = chunks.back().size()});
+            offset += chunks.back().size();
+        }
+
+        file.write(reinterpret_cast<const char *>(&header), sizeof(MipFileHeader));
+        file.write(
+            reinterpret_cast<const char *>(entries.data()),
+            static_cast<std::streamsize>(entries.size() * sizeof(MipLevelEntry))
+        );
+        for (const auto &chunk : chunks) {
+            file.write(reinterpret_cast<const char *>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+        }
+
+        if (!file.good()) {
+            file.close();
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tmp_path, path, ec);
+
+    if (ec) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool LibGcp::ReadMipLevel(const std::string &path, const int level, std::vector<unsigned char> &out)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    MipFileHeader header{};
+    if (!file.is_open() || !ReadHeader(file, header) || level < 0 || level >= header.mip_count) {
+        return false;
+    }
+
+    MipLevelEntry entry{};
+    file.seekg(static_cast<std::streamoff>(sizeof(MipFileHeader) + level * sizeof(MipLevelEntry)));
+    if (!file.read(reinterpret_cast<char *>(&entry), sizeof(MipLevelEntry))) {
+        return false;
+    }
+
+    std::error_code ec;
+    const auto file_size = std::filesystem::file_size(path, ec);
+    if (ec || entry.offset > file_size || entry.size > file_size - entry.offset) {
+        return false;
+    }
+
+    std::vector<std::byte> chunk(entry.size);
+    file.seekg(static_cast<std::streamoff>(entry.offset));
+    if (!file.read(reinterpret_cast<char *>(chunk.data()), static_cast<std::streamsize>(chunk.size()))) {
+        return false;
+    }
+
+    const size_t level_size = GetMipSizeBytes(header.width, header.height, header.channels, level);
+    if (ChunkCodec::GetDecodedSize(chunk) != level_size) {
+        return false;
+    }
+
+    out.resize(level_size);
+    return ChunkCodec::Decode(chunk, std::as_writable_bytes(std::span(out)));
+}
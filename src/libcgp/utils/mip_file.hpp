@@ -0,0 +1,72 @@
+#ifndef UTILS_MIP_FILE_HPP_
+#define UTILS_MIP_FILE_HPP_
+
+#include <libcgp/defines.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+LIBGCP_DECL_START_
+// ------------------------------
+// Mip chain helpers
+// ------------------------------
+
+using mip_chain_t = std::vector<std::vector<unsigned char>>;
+
+NDSCRD FAST_CALL int GetMipDimension(const int size, const int level) noexcept { return std::max(1, size >> level); }
+
+NDSCRD FAST_CALL int GetMipCount(const int width, const int height) noexcept
+{
+    return std::bit_width(static_cast<unsigned>(std::max(width, height)));
+}
+
+NDSCRD FAST_CALL size_t GetMipSizeBytes(const int width, const int height, const int channels, const int level) noexcept
+{
+    return static_cast<size_t>(GetMipDimension(width, level)) * static_cast<size_t>(GetMipDimension(height, level)) *
+           static_cast<size_t>(channels);
+}
+
+/* Builds the whole chain with a 2x2 box filter, level 0 is a copy of the input */
+NDSCRD mip_chain_t GenerateMipChain(const unsigned char *data, int width, int height, int channels);
+
+// ------------------------------
+// Mip files
+// ------------------------------
+
+/**
+ * Mip file stores every level of the chain one after another, starting from the most detailed one,
+ * so any level can be read without touching the others. Header is followed by the table of levels,
+ * each level is a chunk compressed with ChunkCodec using the delta filter over pixels.
+ */
+struct PACK MipFileHeader {
+    uint64_t magic;
+    uint32_t version;
+    int32_t width;
+    int32_t height;
+    int32_t channels;
+    int32_t mip_count;
+};
+
+struct PACK MipLevelEntry {
+    uint64_t offset;
+    uint64_t size;
+};
+
+static constexpr uint64_t kMipFileMagic   = 0x3150494D50434C47ULL;
+static constexpr uint32_t kMipFileVersion = 2;
+
+/* Content addressed files never change, so a matching header means the file can be reused */
+NDSCRD bool HasValidMipFile(const std::string &path, int width, int height, int channels);
+
+/* Written through a temporary file, existing valid file is left untouched */
+bool WriteMipFile(const std::string &path, int width, int height, int channels, const mip_chain_t &chain);
+
+bool ReadMipLevel(const std::string &path, int level, std::vector<unsigned char> &out);
+
+LIBGCP_DECL_END_
+
+#endif  // UTILS_MIP_FILE_HPP_
@@ -0,0 +1,90 @@
+#include <libcgp/utils/model_bounds_cache.hpp>
+#include <libcgp/utils/files.hpp>
+#include <libcgp/utils/macros.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+
+LibGcp::ModelBoundsCache::ModelBoundsCache(std::string directory) : directory_(std::move(directory))
+{
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+
+    if (ec) {
+        TRACE("Failed to create model bounds cache directory: " << directory_);
+        return;
+    }
+
+    is_enabled_ = true;
+}
+
+std::optional<LibGcp::BoundingBox> LibGcp::ModelBoundsCache::Load(const std::string &model_path) const noexcept
+{
+    const auto key = ComputeKey_(model_path);
+    if (!is_enabled_ || !key) {
+        return std::nullopt;
+    }
+
+    std::ifstream file(GetEntryPath_(*key), std::ios::binary);
+
+    Entry entry{};
+    if (!file.is_open() || !file.read(reinterpret_cast<char *>(&entry), sizeof(Entry))) {
+        return std::nullopt;
+    }
+
+    const Hash128 stored_key = entry.key;
+    if (entry.magic != kMagic || entry.version != kVersion || stored_key != *key) {
+        return std::nullopt;
+    }
+
+    return entry.bounds;
+}
+
+void LibGcp::ModelBoundsCache::Store(const std::string &model_path, const BoundingBox &bounds) const noexcept
+{
+    const auto key = ComputeKey_(model_path);
+    if (!is_enabled_ || !key) {
+        return;
+    }
+
+    const Entry entry{
+        .magic   = kMagic,
+        .version = kVersion,
+        .key     = *key,
+        .bounds  = bounds,
+    };
+
+    const std::string path     = GetEntryPath_(*key);
+    const std::string tmp_path = GetUniqueTempPath(path);
+
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(&entry), sizeof(Entry));
+
+        if (!file.good()) {
+            file.close();
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, path, ec);
+
+    if (ec) {
+        std::remove(tmp_path.c_str());
+    }
+}
+
+std::optional<LibGcp::Hash128> LibGcp::ModelBoundsCache::ComputeKey_(const std::string &model_path) noexcept
+{
+    return HashFileIdentity(model_path, kHashSeed);
+}
+
+std::string LibGcp::ModelBoundsCache::GetEntryPath_(const Hash128 &key) const
+{
+    return directory_ + "/" + ToHexString(key) + ".bin";
+}
@@ -0,0 +1,75 @@
+#ifndef UTILS_MODEL_BOUNDS_CACHE_HPP_
+#define UTILS_MODEL_BOUNDS_CACHE_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/intf.hpp>
+#include <libcgp/utils/hash.hpp>
+
+#include <optional>
+#include <string>
+
+LIBGCP_DECL_START_
+/**
+ * On-disk cache of model bounds, lets placeholders of lazily loaded models take part in culling
+ * before the model file is parsed. Entries are keyed by the model path, size and modification time,
+ * so any change of the file invalidates its entry.
+ */
+class ModelBoundsCache
+{
+    static constexpr uint64_t kMagic    = 0x4D424F554E445331ULL;
+    static constexpr uint32_t kVersion  = 1;
+    static constexpr uint64_t kHashSeed = 0xB0B5;
+
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    struct PACK Entry {
+        uint64_t magic;
+        uint32_t version;
+        Hash128 key;
+        BoundingBox bounds;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    explicit ModelBoundsCache(std::string directory);
+
+    ~ModelBoundsCache() = default;
+
+    ModelBoundsCache(const ModelBoundsCache &) = delete;
+
+    ModelBoundsCache &operator=(const ModelBoundsCache &) = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    NDSCRD std::optional<BoundingBox> Load(const std::string &model_path) const noexcept;
+
+    void Store(const std::string &model_path, const BoundingBox &bounds) const noexcept;
+
+    // ------------------------------
+    // Class implementation methods
+    // ------------------------------
+
+    protected:
+    /* Fails when the model file does not exist */
+    NDSCRD static std::optional<Hash128> ComputeKey_(const std::string &model_path) noexcept;
+
+    NDSCRD std::string GetEntryPath_(const Hash128 &key) const;
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    std::string directory_;
+    bool is_enabled_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // UTILS_MODEL_BOUNDS_CACHE_HPP_
@@ -0,0 +1,108 @@
+#include <libcgp/primitives/model.hpp>
+#include <libcgp/utils/macros.hpp>
+#include <libcgp/utils/model_importer.hpp>
+#include <libcgp/utils/profiler.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <assimp/Importer.hpp>
+
+LibGcp::ModelImporter::ModelImporter() = default;
+
+LibGcp::ModelImporter::~ModelImporter() { Stop(); }
+
+void LibGcp::ModelImporter::Start()
+{
+    if (is_running_) {
+        return;
+    }
+
+    is_running_ = true;
+    thread_     = std::thread([this] {
+        Run_();
+    });
+}
+
+void LibGcp::ModelImporter::Stop()
+{
+    {
+        const std::lock_guard lock(mutex_);
+        is_running_ = false;
+    }
+    cv_.notify_all();
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void LibGcp::ModelImporter::Request(const std::string &path)
+{
+    ++pending_count_;
+    {
+        const std::lock_guard lock(mutex_);
+        requests_.push_back(path);
+    }
+    cv_.notify_one();
+}
+
+std::vector<LibGcp::ModelImporter::Imported> LibGcp::ModelImporter::TakeImported(const size_t max_count)
+{
+    std::vector<Imported> result{};
+
+    const std::lock_guard lock(mutex_);
+    const size_t count = std::min(max_count, imported_.size());
+
+    result.reserve(count);
+    for (size_t idx = 0; idx < count; ++idx) {
+        result.push_back(std::move(imported_.front()));
+        imported_.pop_front();
+    }
+
+    pending_count_ -= count;
+    return result;
+}
+
+void LibGcp::ModelImporter::Run_()
+{
+    Profiler::SetThreadName("Model importer");
+
+    while (true) {
+        std::string path{};
+        {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [this] {
+                return !is_running_ || !requests_.empty();
+            });
+
+            if (!is_running_) {
+                return;
+            }
+
+            path = std::move(requests_.front());
+            requests_.pop_front();
+        }
+
+        PROFILE_SCOPE("ModelImporter::Import");
+
+        /* another process might have imported the model already */
+        const auto blob = ModelSerializer::FindSharedBlob(path);
+
+        std::unique_ptr<Assimp::Importer> importer{};
+        if (blob.empty()) {
+            importer = ModelSerializer::ImportExternalFormat(path);
+        }
+
+        if (!importer && blob.empty()) {
+            TRACE("Failed to import model in the background: " << path);
+        }
+
+        const std::lock_guard lock(mutex_);
+        imported_.push_back({
+            .path     = std::move(path),
+            .importer = std::move(importer),
+            .blob     = blob,
+        });
+    }
+}
@@ -0,0 +1,95 @@
+#ifndef UTILS_MODEL_IMPORTER_HPP_
+#define UTILS_MODEL_IMPORTER_HPP_
+
+#include <libcgp/defines.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Forward declarations */
+namespace Assimp
+{
+class Importer;
+}  // namespace Assimp
+
+LIBGCP_DECL_START_
+/**
+ * Parses model files with assimp on the worker thread, so only the GPU upload is left for the render thread.
+ * Models already stored in the shared asset cache are not parsed, their blob is returned instead.
+ * Imports are returned in the order of requests, failed import is reported with empty importer and blob.
+ */
+class ModelImporter
+{
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    struct Imported {
+        std::string path;
+        std::unique_ptr<Assimp::Importer> importer;
+        std::span<const std::byte> blob;
+
+        NDSCRD FAST_CALL bool IsValid() const noexcept { return importer != nullptr || !blob.empty(); }
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    ModelImporter();
+
+    ~ModelImporter();
+
+    ModelImporter(const ModelImporter &) = delete;
+
+    ModelImporter &operator=(const ModelImporter &) = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    void Start();
+
+    void Stop();
+
+    void Request(const std::string &path);
+
+    /* Returns at most max_count finished imports */
+    NDSCRD std::vector<Imported> TakeImported(size_t max_count);
+
+    /* Requests not yet taken back with TakeImported */
+    NDSCRD FAST_CALL size_t GetPendingCount() const noexcept { return pending_count_; }
+
+    // ------------------------------
+    // Class implementation methods
+    // ------------------------------
+
+    protected:
+    void Run_();
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    std::mutex mutex_{};
+    std::condition_variable cv_{};
+    std::deque<std::string> requests_{};
+    std::deque<Imported> imported_{};
+    std::atomic<size_t> pending_count_{};
+
+    std::atomic<bool> is_running_{};
+    std::thread thread_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // UTILS_MODEL_IMPORTER_HPP_
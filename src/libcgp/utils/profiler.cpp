@@ -0,0 +1,331 @@
+#include <libcgp/utils/profiler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string_view>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static constexpr uint64_t kWritingSequence = ~static_cast<uint64_t>(0);
+
+/* Slot is a small seqlock, reader drops the event when the sequence changed while it was copied */
+struct StoredEvent {
+    std::atomic<uint64_t> sequence;
+    std::atomic<const char *> name;
+    std::atomic<uint64_t> start_ns;
+    std::atomic<uint64_t> end_ns;
+    std::atomic<uint32_t> depth;
+};
+
+struct ThreadBuffer {
+    explicit ThreadBuffer(const uint32_t thread_id) : tid(thread_id), events(LibGcp::Profiler::kEventsPerThread) {}
+
+    const uint32_t tid;
+    std::atomic<uint64_t> head{};
+    std::vector<StoredEvent> events;
+
+    /* guarded by the registry mutex */
+    std::string name{};
+    bool is_retired{};
+};
+
+struct BufferRegistry {
+    std::mutex mutex{};
+    std::vector<std::shared_ptr<ThreadBuffer> > buffers{};
+};
+
+struct BufferSnapshot {
+    uint32_t tid;
+    std::string name;
+    std::vector<LibGcp::Profiler::Event> events;
+};
+
+struct FlameNode {
+    const char *name;
+    size_t calls;
+    uint64_t total_ns;
+    uint64_t children_ns;
+    std::vector<size_t> children;
+};
+
+static const auto g_epoch = std::chrono::steady_clock::now();
+
+static BufferRegistry &GetRegistry()
+{
+    static BufferRegistry registry{};
+    return registry;
+}
+
+/* Buffer owned by the thread, it is handed over to the next thread once this one finishes */
+class ThreadHandle
+{
+    public:
+    ThreadHandle()
+    {
+        auto &registry = GetRegistry();
+        const std::lock_guard lock(registry.mutex);
+
+        const auto retired = std::ranges::find_if(registry.buffers, [](const auto &buffer) {
+            return buffer->is_retired;
+        });
+
+        if (retired != registry.buffers.end()) {
+            /* events of the finished thread must not be reported under the new one, writer is gone already */
+            buffer_ = *retired;
+            buffer_->head.store(0, std::memory_order_release);
+        } else {
+            buffer_ = std::make_shared<ThreadBuffer>(static_cast<uint32_t>(registry.buffers.size() + 1));
+            registry.buffers.push_back(buffer_);
+        }
+
+        buffer_->is_retired = false;
+        buffer_->name       = "Thread " + std::to_string(buffer_->tid);
+    }
+
+    ~ThreadHandle()
+    {
+        const std::lock_guard lock(GetRegistry().mutex);
+        buffer_->is_retired = true;
+    }
+
+    ThreadHandle(const ThreadHandle &)            = delete;
+    ThreadHandle &operator=(const ThreadHandle &) = delete;
+
+    NDSCRD FAST_CALL ThreadBuffer &GetBuffer() noexcept { return *buffer_; }
+
+    uint32_t depth{};
+
+    private:
+    std::shared_ptr<ThreadBuffer> buffer_{};
+};
+
+static thread_local ThreadHandle g_thread{};
+
+static std::vector<BufferSnapshot> TakeSnapshots(const uint64_t since_ns)
+{
+    std::vector<std::pair<std::shared_ptr<ThreadBuffer>, std::string> > buffers{};
+    {
+        auto &registry = GetRegistry();
+        const std::lock_guard lock(registry.mutex);
+
+        for (const auto &buffer : registry.buffers) {
+            buffers.emplace_back(buffer, buffer->name);
+        }
+    }
+
+    std::vector<BufferSnapshot> snapshots{};
+    for (const auto &[buffer, name] : buffers) {
+        BufferSnapshot snapshot{.tid = buffer->tid, .name = name, .events = {}};
+
+        const uint64_t head  = buffer->head.load(std::memory_order_acquire);
+        const uint64_t first = head > buffer->events.size() ? head - buffer->events.size() : 0;
+
+        for (uint64_t idx = first; idx < head; ++idx) {
+            const auto &slot = buffer->events[idx % buffer->events.size()];
+
+            if (slot.sequence.load(std::memory_order_acquire) != idx + 1) {
+                continue;
+            }
+
+            const LibGcp::Profiler::Event event{
+                .name     = slot.name.load(std::memory_order_relaxed),
+                .start_ns = slot.start_ns.load(std::memory_order_relaxed),
+                .end_ns   = slot.end_ns.load(std::memory_order_relaxed),
+                .depth    = slot.depth.load(std::memory_order_relaxed),
+            };
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != idx + 1 || event.end_ns < since_ns) {
+                continue;
+            }
+
+            snapshot.events.push_back(event);
+        }
+
+        if (!snapshot.events.empty()) {
+            snapshots.push_back(std::move(snapshot));
+        }
+    }
+
+    return snapshots;
+}
+
+/* Chrome trace expects microseconds */
+static void WriteMicroseconds(std::ofstream &file, const uint64_t time_ns)
+{
+    const uint64_t fraction = time_ns % 1000;
+    file << time_ns / 1000 << '.' << fraction / 100 << fraction / 10 % 10 << fraction % 10;
+}
+
+static size_t GetFlameChild(std::vector<FlameNode> &nodes, const size_t parent, const char *name)
+{
+    for (const size_t child : nodes[parent].children) {
+        if (std::string_view(nodes[child].name) == name) {
+            return child;
+        }
+    }
+
+    const size_t child = nodes.size();
+    nodes.push_back({.name = name, .calls = 0, .total_ns = 0, .children_ns = 0, .children = {}});
+    nodes[parent].children.push_back(child);
+
+    return child;
+}
+
+static void FlattenFlameNodes(
+    const std::vector<FlameNode> &nodes, const size_t node, const uint32_t depth,
+    std::vector<LibGcp::Profiler::SummaryNode> &out
+)
+{
+    auto children = nodes[node].children;
+    std::ranges::sort(children, [&](const size_t lhs, const size_t rhs) {
+        return nodes[lhs].total_ns > nodes[rhs].total_ns;
+    });
+
+    for (const size_t child : children) {
+        const auto &flame = nodes[child];
+        out.push_back({
+            .name     = flame.name,
+            .depth    = depth,
+            .calls    = flame.calls,
+            .total_ns = flame.total_ns,
+            .self_ns  = flame.total_ns - std::min(flame.total_ns, flame.children_ns),
+        });
+
+        FlattenFlameNodes(nodes, child, depth + 1, out);
+    }
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+void LibGcp::Profiler::SetThreadName(const std::string &name)
+{
+    /* ring of the thread is allocated on the first use, which never happens without zones */
+    if constexpr (!kUseProfiler) {
+        return;
+    }
+
+    auto &buffer = g_thread.GetBuffer();
+
+    const std::lock_guard lock(GetRegistry().mutex);
+    buffer.name = name;
+}
+
+uint64_t LibGcp::Profiler::GetTimestampNs() noexcept
+{
+    const auto elapsed = std::chrono::steady_clock::now() - g_epoch;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+LibGcp::Rc LibGcp::Profiler::ExportChromeTrace(const std::string &path)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        return Rc::kFailedToOpenFile;
+    }
+
+    file << R"({"displayTimeUnit":"ns","traceEvents":[)";
+
+    bool is_first = true;
+    for (const auto &snapshot : TakeSnapshots(0)) {
+        file << (is_first ? "" : ",") << "\n" << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << snapshot.tid
+             << R"(,"args":{"name":)";
+        WriteJsonString(file, snapshot.name);
+        file << "}}";
+        is_first = false;
+
+        for (const auto &event : snapshot.events) {
+            file << ",\n" << R"({"name":)";
+            WriteJsonString(file, event.name);
+            file << R"(,"cat":"cpu","ph":"X","pid":1,"tid":)" << snapshot.tid << R"(,"ts":)";
+            WriteMicroseconds(file, event.start_ns);
+            file << R"(,"dur":)";
+            WriteMicroseconds(file, event.end_ns - event.start_ns);
+            file << "}";
+        }
+    }
+
+    file << "\n]}\n";
+    return file.good() ? Rc::kSuccess : Rc::kUnknownFailure;
+}
+
+std::vector<LibGcp::Profiler::ThreadSummary> LibGcp::Profiler::GetFlameSummary(const uint64_t window_ns)
+{
+    const uint64_t now_ns = GetTimestampNs();
+    auto snapshots        = TakeSnapshots(now_ns > window_ns ? now_ns - window_ns : 0);
+
+    std::vector<ThreadSummary> summaries{};
+    for (auto &snapshot : snapshots) {
+        /* parents start no later than their children, depth decides the ties */
+        std::ranges::sort(snapshot.events, [](const Event &lhs, const Event &rhs) {
+            return lhs.start_ns != rhs.start_ns ? lhs.start_ns < rhs.start_ns : lhs.depth < rhs.depth;
+        });
+
+        /* zones of the open parents are not recorded yet, such children are attached to the root */
+        std::vector<FlameNode> nodes(1);
+        std::vector<size_t> path{0};
+
+        for (const auto &event : snapshot.events) {
+            path.resize(std::min<size_t>(event.depth, path.size() - 1) + 1);
+
+            const size_t parent   = path.back();
+            const size_t node     = GetFlameChild(nodes, parent, event.name);
+            const uint64_t length = event.end_ns - event.start_ns;
+
+            ++nodes[node].calls;
+            nodes[node].total_ns += length;
+            nodes[parent].children_ns += length;
+            path.push_back(node);
+        }
+
+        ThreadSummary summary{.thread_name = std::move(snapshot.name), .nodes = {}};
+        FlattenFlameNodes(nodes, 0, 0, summary.nodes);
+        summaries.push_back(std::move(summary));
+    }
+
+    return summaries;
+}
+
+uint32_t LibGcp::Profiler::EnterZone_() noexcept { return g_thread.depth++; }
+
+void LibGcp::Profiler::WriteJsonString(std::ostream &out, const std::string_view str)
+{
+    out << '"';
+    for (const char symbol : str) {
+        if (symbol == '"' || symbol == '\\') {
+            out << '\\' << symbol;
+        } else if (static_cast<unsigned char>(symbol) >= 0x20) {
+            out << symbol;
+        }
+    }
+    out << '"';
+}
+
+void LibGcp::Profiler::LeaveZone_(const char *name, const uint32_t depth, const uint64_t start_ns) noexcept
+{
+    const uint64_t end_ns = GetTimestampNs();
+    g_thread.depth        = depth;
+
+    auto &buffer       = g_thread.GetBuffer();
+    const uint64_t idx = buffer.head.load(std::memory_order_relaxed);
+    auto &slot         = buffer.events[idx % buffer.events.size()];
+
+    slot.sequence.store(kWritingSequence, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.start_ns.store(start_ns, std::memory_order_relaxed);
+    slot.end_ns.store(end_ns, std::memory_order_relaxed);
+    slot.depth.store(depth, std::memory_order_relaxed);
+
+    slot.sequence.store(idx + 1, std::memory_order_release);
+    buffer.head.store(idx + 1, std::memory_order_release);
+}
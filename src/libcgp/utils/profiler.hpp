@@ -0,0 +1,128 @@
+#ifndef UTILS_PROFILER_HPP_
+#define UTILS_PROFILER_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/rc.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+LIBGCP_DECL_START_
+/**
+ * Hierarchical CPU profiler built from RAII zones, see PROFILE_SCOPE.
+ * Every thread records finished zones with nanosecond timestamps into its own ring buffer, which is published
+ * with a single atomic store, so recording never takes a lock. Buffers of finished threads are reused by the new
+ * ones, memory stays bounded by the number of threads running at once.
+ *
+ * Recorded zones may be exported to the Chrome trace JSON format, readable by chrome://tracing and Perfetto,
+ * or aggregated into the flame summary of the last second.
+ *
+ * Zones are compiled out unless USE_TIMERS is enabled.
+ */
+class Profiler
+{
+    // ------------------------------
+    // Class internals
+    // ------------------------------
+
+    public:
+#ifdef USE_TIMERS_
+    static constexpr bool kUseProfiler = true;
+#else
+    static constexpr bool kUseProfiler = false;
+#endif
+
+    static constexpr size_t kEventsPerThread   = 16 * 1024;
+    static constexpr uint64_t kSummaryWindowNs = 1'000'000'000;
+
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    /* Zone names must outlive the profiler, string literals are expected */
+    struct Event {
+        const char *name;
+        uint64_t start_ns;
+        uint64_t end_ns;
+        uint32_t depth;
+    };
+
+    /* Zones aggregated by their call path, nodes are listed depth first */
+    struct SummaryNode {
+        const char *name;
+        uint32_t depth;
+        size_t calls;
+        uint64_t total_ns;
+        uint64_t self_ns;
+    };
+
+    struct ThreadSummary {
+        std::string thread_name;
+        std::vector<SummaryNode> nodes;
+    };
+
+    class Zone
+    {
+        public:
+        explicit Zone(const char *name) noexcept : name_(name), depth_(EnterZone_()), start_ns_(GetTimestampNs()) {}
+
+        ~Zone() { LeaveZone_(name_, depth_, start_ns_); }
+
+        Zone(const Zone &)            = delete;
+        Zone &operator=(const Zone &) = delete;
+
+        private:
+        const char *name_;
+        uint32_t depth_;
+        uint64_t start_ns_;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    Profiler() = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    /* Name shown for the calling thread, threads are numbered otherwise */
+    static void SetThreadName(const std::string &name);
+
+    /* Nanoseconds since the first use of the profiler */
+    NDSCRD static uint64_t GetTimestampNs() noexcept;
+
+    NDSCRD static Rc ExportChromeTrace(const std::string &path);
+
+    NDSCRD static std::vector<ThreadSummary> GetFlameSummary(uint64_t window_ns = kSummaryWindowNs);
+
+    /* Quoted JSON string, quotes and backslashes are escaped and control characters dropped */
+    static void WriteJsonString(std::ostream &out, std::string_view str);
+
+    // ---------------------------------
+    // Class implementation methods
+    // ---------------------------------
+
+    protected:
+    NDSCRD static uint32_t EnterZone_() noexcept;
+
+    static void LeaveZone_(const char *name, uint32_t depth, uint64_t start_ns) noexcept;
+};
+
+LIBGCP_DECL_END_
+
+#define PROFILE_CONCAT_INNER_(lhs, rhs) lhs##rhs
+#define PROFILE_CONCAT_(lhs, rhs)       PROFILE_CONCAT_INNER_(lhs, rhs)
+
+#ifdef USE_TIMERS_
+#define PROFILE_SCOPE(name) const LibGcp::Profiler::Zone PROFILE_CONCAT_(profile_zone_, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name)
+#endif  // USE_TIMERS_
+
+#endif  // UTILS_PROFILER_HPP_
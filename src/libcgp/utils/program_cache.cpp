@@ -0,0 +1,201 @@
+#include <libcgp/utils/files.hpp>
+#include <libcgp/utils/program_cache.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+static std::string GetGlString(const GLenum name)
+{
+    const auto str = reinterpret_cast<const char *>(glGetString(name));
+    return str == nullptr ? std::string{} : std::string{str};
+}
+
+L_FAST_CALL void HashString(LibGcp::ContentHasher &hasher, const std::string_view str) noexcept
+{
+    /* length prefix keeps "ab" + "c" and "a" + "bc" apart */
+    hasher.Update(str.size());
+    hasher.Update(str.data(), str.size());
+}
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::ProgramCache::ProgramCache(std::string directory) : directory_(std::move(directory))
+{
+    GLint formats_count{};
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats_count);
+
+    if (formats_count <= 0) {
+        TRACE("Driver does not support program binaries, shader cache disabled");
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+
+    if (ec) {
+        TRACE("Failed to create shader cache directory: " << directory_);
+        return;
+    }
+
+    driver_id_  = GetGlString(GL_VENDOR) + "|" + GetGlString(GL_RENDERER) + "|" + GetGlString(GL_VERSION);
+    is_enabled_ = true;
+
+    TRACE("Shader cache enabled for driver: " << driver_id_);
+}
+
+LibGcp::Hash128 LibGcp::ProgramCache::ComputeKey(
+    const char *vertex_shader_code, const char *fragment_shader_code, const std::string_view defines
+) const noexcept
+{
+    ContentHasher hasher(kHashSeed);
+
+    HashString(hasher, vertex_shader_code);
+    HashString(hasher, fragment_shader_code);
+    HashString(hasher, defines);
+    HashString(hasher, driver_id_);
+
+    return hasher.Finalize();
+}
+
+GLuint LibGcp::ProgramCache::LoadProgram(const Hash128 &key) noexcept
+{
+    if (!is_enabled_) {
+        return 0;
+    }
+
+    const std::string path = GetEntryPath_(key);
+    std::ifstream file(path, std::ios::binary);
+
+    EntryHeader header{};
+    if (!file.is_open() || !file.read(reinterpret_cast<char *>(&header), sizeof(EntryHeader))) {
+        ++misses_;
+        return 0;
+    }
+
+    /* header check guards against stale formats and truncated names */
+    const Hash128 stored_key = header.key;
+    if (header.magic != kMagic || header.version != kVersion || stored_key != key || header.binary_size == 0) {
+        ++misses_;
+        return 0;
+    }
+
+    /* size comes from the disk, so it must match the entry before anything is allocated, GL takes it as GLsizei */
+    std::error_code ec;
+    const auto file_size = std::filesystem::file_size(path, ec);
+    if (ec || header.binary_size != file_size - sizeof(EntryHeader) ||
+        header.binary_size > static_cast<uint64_t>(std::numeric_limits<GLsizei>::max())) {
+        TRACE("Shader cache entry with invalid size: " << path);
+        ++misses_;
+        return 0;
+    }
+
+    std::vector<char> binary(header.binary_size);
+    if (!file.read(binary.data(), static_cast<std::streamsize>(binary.size()))) {
+        ++misses_;
+        return 0;
+    }
+
+    const GLuint program = glCreateProgram();
+    glProgramBinary(program, header.binary_format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+    /* driver may reject binaries silently e.g. after an update not reflected in the version string */
+    GLint link_status{};
+    glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+
+    if (link_status != GL_TRUE) {
+        glDeleteProgram(program);
+        ++misses_;
+        return 0;
+    }
+
+    ++hits_;
+    return program;
+}
+
+void LibGcp::ProgramCache::StoreProgram(const Hash128 &key, const GLuint program) noexcept
+{
+    if (!is_enabled_) {
+        return;
+    }
+
+    GLint binary_size{};
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binary_size);
+
+    if (binary_size <= 0) {
+        return;
+    }
+
+    std::vector<char> binary(static_cast<size_t>(binary_size));
+    GLenum binary_format{};
+    GLsizei written{};
+    glGetProgramBinary(program, binary_size, &written, &binary_format, binary.data());
+
+    if (written <= 0) {
+        return;
+    }
+
+    const EntryHeader header{
+        .magic         = kMagic,
+        .version       = kVersion,
+        .binary_format = binary_format,
+        .binary_size   = static_cast<uint64_t>(written),
+        .key           = key,
+    };
+
+    /* every writer has its own temporary file, the rename publishes the whole entry at once */
+    const std::string path     = GetEntryPath_(key);
+    const std::string tmp_path = GetUniqueTempPath(path);
+
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open()) {
+            return;
+        }
+
+        file.write(reinterpret_cast<const char *>(&header), sizeof(EntryHeader));
+        file.write(binary.data(), written);
+
+        if (!file.good()) {
+            file.close();
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, path, ec);
+
+    if (ec) {
+        std::remove(tmp_path.c_str());
+        return;
+    }
+
+    ++stored_;
+}
+
+LibGcp::ProgramCache::Stats LibGcp::ProgramCache::GetStats() const noexcept
+{
+    return {
+        .hits   = hits_,
+        .misses = misses_,
+        .stored = stored_,
+    };
+}
+
+std::string LibGcp::ProgramCache::GetEntryPath_(const Hash128 &key) const
+{
+    return directory_ + "/" + ToHexString(key) + ".bin";
+}
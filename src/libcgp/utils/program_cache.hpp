@@ -0,0 +1,97 @@
+#ifndef UTILS_PROGRAM_CACHE_HPP_
+#define UTILS_PROGRAM_CACHE_HPP_
+
+#include <glad/gl.h>
+
+#include <libcgp/defines.hpp>
+#include <libcgp/utils/hash.hpp>
+
+#include <atomic>
+#include <string>
+#include <string_view>
+
+LIBGCP_DECL_START_
+/**
+ * On-disk cache of linked shader programs stored with glGetProgramBinary.
+ * Entries are keyed by the shader sources, defines and the driver identification strings,
+ * so any driver update invalidates the cache. Every failure falls back to the compilation from sources.
+ * Must be created and used on the thread owning the GL context.
+ */
+class ProgramCache
+{
+    static constexpr uint64_t kMagic    = 0x4750524F47424E31ULL;
+    static constexpr uint32_t kVersion  = 1;
+    static constexpr uint64_t kHashSeed = 0x5AD3;
+
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    struct Stats {
+        size_t hits;
+        size_t misses;
+        size_t stored;
+    };
+
+    struct PACK EntryHeader {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t binary_format;
+        uint64_t binary_size;
+        Hash128 key;
+    };
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    explicit ProgramCache(std::string directory);
+
+    ~ProgramCache() = default;
+
+    ProgramCache(const ProgramCache &) = delete;
+
+    ProgramCache &operator=(const ProgramCache &) = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    NDSCRD Hash128 ComputeKey(
+        const char *vertex_shader_code, const char *fragment_shader_code, std::string_view defines
+    ) const noexcept;
+
+    /* Returns linked program or 0 when there is no matching entry */
+    NDSCRD GLuint LoadProgram(const Hash128 &key) noexcept;
+
+    /* Program must be linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set */
+    void StoreProgram(const Hash128 &key, GLuint program) noexcept;
+
+    NDSCRD FAST_CALL bool IsEnabled() const noexcept { return is_enabled_; }
+
+    NDSCRD Stats GetStats() const noexcept;
+
+    // ------------------------------
+    // Class implementation methods
+    // ------------------------------
+
+    protected:
+    NDSCRD std::string GetEntryPath_(const Hash128 &key) const;
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    std::string directory_;
+    std::string driver_id_{};
+    bool is_enabled_{};
+
+    std::atomic<size_t> hits_{};
+    std::atomic<size_t> misses_{};
+    std::atomic<size_t> stored_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // UTILS_PROGRAM_CACHE_HPP_
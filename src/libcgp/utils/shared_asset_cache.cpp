@@ -0,0 +1,285 @@
+#include <libcgp/utils/macros.hpp>
+#include <libcgp/utils/shared_asset_cache.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <utility>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif  // __linux__
+
+// ------------------------------
+// Static helpers
+// ------------------------------
+
+L_FAST_CALL size_t AlignUp(const size_t value, const size_t alignment) noexcept
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+#ifdef __linux__
+/* Excludes other processes for the lifetime of the object */
+class FileLock
+{
+    public:
+    explicit FileLock(const int fd) : fd_(fd) { is_locked_ = flock(fd_, LOCK_EX) == 0; }
+
+    ~FileLock()
+    {
+        if (is_locked_) {
+            flock(fd_, LOCK_UN);
+        }
+    }
+
+    FileLock(const FileLock &) = delete;
+
+    FileLock &operator=(const FileLock &) = delete;
+
+    NDSCRD bool IsLocked() const noexcept { return is_locked_; }
+
+    private:
+    int fd_;
+    bool is_locked_{};
+};
+#endif  // __linux__
+
+// ------------------------------
+// Implementations
+// ------------------------------
+
+LibGcp::SharedAssetCache::SharedAssetCache(std::string path, const size_t capacity) : path_(std::move(path))
+{
+    static_assert(sizeof(Header) % alignof(Slot) == 0);
+
+    if (!OpenMapping_(capacity)) {
+        TRACE("Shared asset cache disabled: " << path_);
+        CloseMapping_();
+        return;
+    }
+
+    TRACE("Mapped shared asset cache: " << path_ << " with " << GetHeader_().entries << " entries");
+}
+
+LibGcp::SharedAssetCache::~SharedAssetCache() { CloseMapping_(); }
+
+LibGcp::SharedAssetCache::payload_t LibGcp::SharedAssetCache::Find(const Hash128 &key) noexcept
+{
+    if (!IsEnabled()) {
+        return {};
+    }
+
+    Slot *slot = ProbeSlot_(key);
+    if (slot == nullptr || std::atomic_ref(slot->state).load(std::memory_order_acquire) != kSlotReady) {
+        ++misses_;
+        return {};
+    }
+
+    /* file is writable by any process, so a broken slot must not point outside of the mapping */
+    if (!IsSlotInArena_(*slot)) {
+        TRACE("Shared asset cache slot points outside of the arena");
+        ++misses_;
+        return {};
+    }
+
+    ++hits_;
+    return {mapping_ + GetArenaOffset_() + slot->offset, slot->size};
+}
+
+LibGcp::SharedAssetCache::payload_t LibGcp::SharedAssetCache::Store(
+    UNUSED const Hash128 &key, UNUSED const std::initializer_list<payload_t> parts
+) noexcept
+{
+#ifdef __linux__
+    if (!IsEnabled()) {
+        return {};
+    }
+
+    size_t size = 0;
+    for (const auto &part : parts) {
+        size += part.size();
+    }
+
+    const std::lock_guard guard(store_mutex_);
+    const FileLock lock(fd_);
+    if (!lock.IsLocked()) {
+        return {};
+    }
+
+    Header &header = GetHeader_();
+    Slot *slot     = ProbeSlot_(key);
+
+    if (slot == nullptr) {
+        TRACE("Shared asset cache has no free slot left");
+        return {};
+    }
+
+    /* other process might have stored the same asset in the meantime */
+    if (std::atomic_ref(slot->state).load(std::memory_order_acquire) == kSlotReady) {
+        if (!IsSlotInArena_(*slot)) {
+            return {};
+        }
+        return {mapping_ + GetArenaOffset_() + slot->offset, slot->size};
+    }
+
+    std::atomic_ref used(header.used);
+    const size_t offset = used.load(std::memory_order_relaxed);
+    if (size > mapping_size_ - GetArenaOffset_() || offset > mapping_size_ - GetArenaOffset_() - size) {
+        TRACE("Shared asset cache is full, entry of " << size << " bytes skipped");
+        return {};
+    }
+
+    std::byte *destination = mapping_ + GetArenaOffset_() + offset;
+    for (const auto &part : parts) {
+        std::memcpy(destination, part.data(), part.size());
+        destination += part.size();
+    }
+
+    slot->key    = key;
+    slot->offset = offset;
+    slot->size   = size;
+
+    /* arena is advanced before the payload is published to the lock-free readers of every process */
+    used.store(AlignUp(offset + size, kEntryAlignment), std::memory_order_relaxed);
+    std::atomic_ref(slot->state).store(kSlotReady, std::memory_order_release);
+    std::atomic_ref(header.entries).fetch_add(1, std::memory_order_relaxed);
+    ++stored_;
+
+    return {mapping_ + GetArenaOffset_() + offset, size};
+#else
+    return {};
+#endif  // __linux__
+}
+
+LibGcp::SharedAssetCache::Stats LibGcp::SharedAssetCache::GetStats() const noexcept
+{
+    Stats stats{
+        .hits           = hits_,
+        .misses         = misses_,
+        .stored         = stored_,
+        .entries        = 0,
+        .used_bytes     = 0,
+        .capacity_bytes = 0,
+    };
+
+    if (IsEnabled()) {
+        Header &header       = GetHeader_();
+        stats.entries        = std::atomic_ref(header.entries).load(std::memory_order_relaxed);
+        stats.used_bytes     = std::atomic_ref(header.used).load(std::memory_order_relaxed);
+        stats.capacity_bytes = header.capacity;
+    }
+
+    return stats;
+}
+
+size_t LibGcp::SharedAssetCache::GetArenaOffset_() noexcept
+{
+    return AlignUp(sizeof(Header) + kSlotCount * sizeof(Slot), kEntryAlignment);
+}
+
+bool LibGcp::SharedAssetCache::OpenMapping_(UNUSED const size_t capacity)
+{
+#ifdef __linux__
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(path_).parent_path(), ec);
+
+    fd_ = open(path_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        return false;
+    }
+
+    const size_t file_size = GetArenaOffset_() + capacity;
+
+    /* the first process creates the layout, the others wait for it on the lock */
+    const FileLock lock(fd_);
+    if (!lock.IsLocked()) {
+        return false;
+    }
+
+    struct stat file_stat {};
+    if (fstat(fd_, &file_stat) != 0) {
+        return false;
+    }
+
+    /* file is sparse, pages are allocated only once written */
+    const bool is_new = file_stat.st_size == 0;
+    if (is_new && ftruncate(fd_, static_cast<off_t>(file_size)) != 0) {
+        return false;
+    }
+
+    if (!is_new && static_cast<size_t>(file_stat.st_size) != file_size) {
+        TRACE("Shared asset cache was created with different capacity");
+        return false;
+    }
+
+    void *mapping = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    mapping_      = static_cast<std::byte *>(mapping);
+    mapping_size_ = file_size;
+
+    Header &header = GetHeader_();
+    if (is_new) {
+        header = {
+            .magic      = kMagic,
+            .version    = kVersion,
+            .slot_count = kSlotCount,
+            .capacity   = capacity,
+            .used       = 0,
+            .entries    = 0,
+        };
+
+        return true;
+    }
+
+    return header.magic == kMagic && header.version == kVersion && header.slot_count == kSlotCount &&
+           header.capacity == capacity;
+#else
+    TRACE("Shared asset cache is not supported on this platform");
+    return false;
+#endif  // __linux__
+}
+
+void LibGcp::SharedAssetCache::CloseMapping_() noexcept
+{
+#ifdef __linux__
+    if (mapping_ != nullptr) {
+        munmap(mapping_, mapping_size_);
+        mapping_      = nullptr;
+        mapping_size_ = 0;
+    }
+
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+#endif  // __linux__
+}
+
+LibGcp::SharedAssetCache::Slot *LibGcp::SharedAssetCache::ProbeSlot_(const Hash128 &key) const noexcept
+{
+    const size_t start = key.low % kSlotCount;
+
+    for (size_t probe = 0; probe < kMaxProbes; ++probe) {
+        Slot &slot = GetSlot_((start + probe) % kSlotCount);
+
+        /* key of the slot is valid only once the state is ready */
+        if (std::atomic_ref(slot.state).load(std::memory_order_acquire) != kSlotReady) {
+            return &slot;
+        }
+
+        if (slot.key == key) {
+            return &slot;
+        }
+    }
+
+    return nullptr;
+}
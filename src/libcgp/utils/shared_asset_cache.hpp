@@ -0,0 +1,142 @@
+#ifndef UTILS_SHARED_ASSET_CACHE_HPP_
+#define UTILS_SHARED_ASSET_CACHE_HPP_
+
+#include <libcgp/defines.hpp>
+#include <libcgp/utils/hash.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <span>
+#include <string>
+
+LIBGCP_DECL_START_
+/**
+ * Cache of imported assets shared by all engine processes on the machine through one memory mapped file.
+ * The first process importing an asset stores its payload, the others read it straight from the shared pages,
+ * so neither the import work nor the memory holding the payload is repeated.
+ * Entries are content addressed, immutable and never evicted, storing stops once the file is full.
+ * Stores are serialized between processes with flock, lookups take no lock. Supported only on linux.
+ */
+class SharedAssetCache
+{
+    static constexpr uint64_t kMagic        = 0x4753484153534554ULL;
+    static constexpr uint32_t kVersion      = 1;
+    static constexpr uint32_t kSlotCount    = 1 << 16;
+    static constexpr size_t kMaxProbes      = 256;
+    static constexpr size_t kEntryAlignment = 64;
+    static constexpr uint32_t kSlotEmpty    = 0;
+    static constexpr uint32_t kSlotReady    = 1;
+
+    public:
+    // ------------------------------
+    // Inner types
+    // ------------------------------
+
+    struct Stats {
+        size_t hits;
+        size_t misses;
+        size_t stored;
+        size_t entries;
+        size_t used_bytes;
+        size_t capacity_bytes;
+    };
+
+    /* Fields modified after creation are accessed only through std::atomic_ref */
+    struct Header {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t slot_count;
+        uint64_t capacity;
+        uint64_t used;
+        uint64_t entries;
+    };
+
+    /* Slot becomes ready only after its payload is written */
+    struct Slot {
+        Hash128 key;
+        uint64_t offset;
+        uint64_t size;
+        uint32_t state;
+        uint32_t reserved;
+    };
+
+    using payload_t = std::span<const std::byte>;
+
+    // ------------------------------
+    // Object creation
+    // ------------------------------
+
+    /* Creates the file when missing, capacity covers only the payloads */
+    SharedAssetCache(std::string path, size_t capacity);
+
+    ~SharedAssetCache();
+
+    SharedAssetCache(const SharedAssetCache &) = delete;
+
+    SharedAssetCache &operator=(const SharedAssetCache &) = delete;
+
+    // ------------------------------
+    // Class interaction
+    // ------------------------------
+
+    /* Returns view of the shared pages valid for the whole life of the cache, empty when there is no entry */
+    NDSCRD payload_t Find(const Hash128 &key) noexcept;
+
+    /* Concatenates the parts into one entry, returns the stored view or empty one when the cache is full */
+    payload_t Store(const Hash128 &key, std::initializer_list<payload_t> parts) noexcept;
+
+    NDSCRD FAST_CALL bool IsEnabled() const noexcept { return mapping_ != nullptr; }
+
+    NDSCRD Stats GetStats() const noexcept;
+
+    // ------------------------------
+    // Class implementation methods
+    // ------------------------------
+
+    protected:
+    NDSCRD static size_t GetArenaOffset_() noexcept;
+
+    NDSCRD bool OpenMapping_(size_t capacity);
+
+    void CloseMapping_() noexcept;
+
+    NDSCRD FAST_CALL Header &GetHeader_() const noexcept { return *reinterpret_cast<Header *>(mapping_); }
+
+    NDSCRD FAST_CALL Slot &GetSlot_(const size_t idx) const noexcept
+    {
+        return reinterpret_cast<Slot *>(mapping_ + sizeof(Header))[idx];
+    }
+
+    /* Capacity is taken from the mapping, as the header may be overwritten by other processes */
+    NDSCRD FAST_CALL bool IsSlotInArena_(const Slot &slot) const noexcept
+    {
+        const size_t capacity = mapping_size_ - GetArenaOffset_();
+        return slot.size <= capacity && slot.offset <= capacity - slot.size;
+    }
+
+    /* Returns the slot holding the key or the first empty one on its probe sequence */
+    NDSCRD Slot *ProbeSlot_(const Hash128 &key) const noexcept;
+
+    // ------------------------------
+    // Class fields
+    // ------------------------------
+
+    std::string path_;
+    int fd_{-1};
+    std::byte *mapping_{};
+    size_t mapping_size_{};
+
+    /* flock does not exclude threads sharing the descriptor */
+    std::mutex store_mutex_{};
+
+    std::atomic<size_t> hits_{};
+    std::atomic<size_t> misses_{};
+    std::atomic<size_t> stored_{};
+};
+
+LIBGCP_DECL_END_
+
+#endif  // UTILS_SHARED_ASSET_CACHE_HPP_
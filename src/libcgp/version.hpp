@@ -14,6 +14,8 @@ enum class Version : std::uint16_t {
 enum class SceneVersion : std::uint16_t {
     V0_1_0,
     V0_1_1,  // Added support for lights
+    V0_1_2,  // Chunked sections with append-only saves
+    V0_1_3,  // Static objects stored as prefabs with quantized placements
     kLast,
 };
 
@@ -31,7 +33,7 @@ static constexpr auto kGlobalVersion     = Version::V0_1_0;
 static constexpr auto kMinSceneVersion   = SceneVersion::V0_1_1;
 static constexpr auto kMinTextureVersion = TextureVersion::V0_1_0;
 static constexpr auto kMinModelVersion   = ModelVersion::V0_1_0;
-static constexpr auto kSceneVersion      = SceneVersion::V0_1_1;
+static constexpr auto kSceneVersion      = SceneVersion::V0_1_3;
 static constexpr auto kTextureVersion    = TextureVersion::V0_1_0;
 static constexpr auto kModelVersion      = ModelVersion::V0_1_0;
 
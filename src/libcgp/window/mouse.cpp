@@ -5,15 +5,13 @@
 
 void LibGcp::Mouse::Move(const double x_pos, const double y_pos) noexcept
 {
-    const double sensitivity = SettingsMgr::GetInstance().GetSetting<Setting::kMouseSensitivity, double>();
-
     if (!is_enabled_) {
         return;
     }
 
     /* calculate offset */
-    const double x_offset = (x_pos - last_x_) * sensitivity;
-    const double y_offset = (last_y_ - y_pos) * sensitivity;
+    const double x_offset = x_pos - last_x_;
+    const double y_offset = last_y_ - y_pos;
 
     /* save last position */
     last_x_ = x_pos;
@@ -23,9 +21,24 @@ void LibGcp::Mouse::Move(const double x_pos, const double y_pos) noexcept
         return;
     }
 
+    if (recorder_ != nullptr) {
+        recorder_->RecordMouseTurn(x_offset, y_offset);
+    }
+
+    Turn(x_offset, y_offset);
+}
+
+void LibGcp::Mouse::Turn(const double x_offset, const double y_offset) noexcept
+{
+    const double sensitivity = SettingsMgr::GetInstance().GetSetting<Setting::kMouseSensitivity, double>();
+
+    if (camera_info_ == nullptr) {
+        return;
+    }
+
     /* update yaw and pith */
-    camera_info_->yaw += x_offset;
-    camera_info_->pitch += y_offset;
+    camera_info_->yaw += x_offset * sensitivity;
+    camera_info_->pitch += y_offset * sensitivity;
 
     /* clamp pitch */
     camera_info_->pitch = std::clamp(camera_info_->pitch, -89.0, 89.0);
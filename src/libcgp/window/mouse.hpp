@@ -2,6 +2,7 @@
 #define WINDOW_MOUSE_HPP_
 
 #include <libcgp/defines.hpp>
+#include <libcgp/engine/input_capture.hpp>
 #include <libcgp/engine/view.hpp>
 
 #include <glm/glm.hpp>
@@ -32,6 +33,9 @@ class Mouse
 
     void Move(double x_pos, double y_pos) noexcept;
 
+    /* Turns the bound camera by offsets of the cursor, used directly by the input replay */
+    void Turn(double x_offset, double y_offset) noexcept;
+
     FAST_CALL void Reset(const double x_pos, const double y_pos) noexcept
     {
         last_x_ = x_pos;
@@ -40,6 +44,8 @@ class Mouse
 
     FAST_CALL void BindCamera(CameraInfo* camera_info) noexcept { camera_info_ = camera_info; }
 
+    FAST_CALL void BindRecorder(InputRecorder* recorder) noexcept { recorder_ = recorder; }
+
     // ---------------------------------
     // Class implementation methods
     // ---------------------------------
@@ -55,6 +61,7 @@ class Mouse
     double last_y_{};
 
     CameraInfo* camera_info_{};
+    InputRecorder* recorder_{};
 };
 
 LIBGCP_DECL_END_
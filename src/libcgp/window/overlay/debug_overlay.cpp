@@ -1,4 +1,5 @@
 #include <libcgp/engine/engine.hpp>
+#include <libcgp/engine/render_stats.hpp>
 #include <libcgp/engine/word_time.hpp>
 #include <libcgp/intf.hpp>
 #include <libcgp/mgr/object_mgr.hpp>
@@ -6,6 +7,9 @@
 #include <libcgp/mgr/settings_mgr.hpp>
 #include <libcgp/rc.hpp>
 #include <libcgp/serialization/scene_serializer.hpp>
+#include <libcgp/utils/chunk_codec.hpp>
+#include <libcgp/utils/memory_tracker.hpp>
+#include <libcgp/utils/profiler.hpp>
 #include <libcgp/window/overlay/debug_overlay.hpp>
 
 #include <CxxUtils/type_list.hpp>
@@ -21,6 +25,7 @@
 #include <imgui_impl_opengl3.h>
 
 #include <cassert>
+#include <filesystem>
 #include <libcgp/utils/files.hpp>
 #include <type_traits>
 
@@ -81,6 +86,9 @@ void LibGcp::DebugOverlay::Init(GLFWwindow *window)
 
 void LibGcp::DebugOverlay::Destroy()
 {
+    /* serializer listens to the managers, so it must be released before them */
+    scene_serializer_.reset();
+
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
@@ -170,6 +178,9 @@ void LibGcp::DebugOverlay::EnableOverlay(GLFWwindow *window)
 
 void LibGcp::DebugOverlay::Draw()
 {
+    PROFILE_SCOPE("DebugOverlay::Draw");
+    const GpuProfiler::ScopedPass overlay_pass(Engine::GetInstance().GetGpuProfiler(), GpuProfiler::Pass::kOverlay);
+
     HighlightedSelectedMesh_();
     DrawSelectedObjects_();
     DrawLightHighlights_();
@@ -188,6 +199,8 @@ void LibGcp::DebugOverlay::Draw()
     DrawSceneWindow_();
     DrawFailure_();
     DrawInfoWindow_();
+    DrawProfilerWindow_();
+    DrawRenderStatsWindow_();
     DrawGlobalLightEditorWindow_();
 
     ImGui::Render();
@@ -232,6 +245,17 @@ void LibGcp::DebugOverlay::DrawSpawnModelsWindow_()
         });
     });
 
+    DisplayFileDialog_(
+        "InternalModelFileDlg", "Choose internal model", ModelSerializer::kInternalExtension,
+        [&](const std::string &filePath) {
+            ResourceMgr::GetInstance().GetModel({
+                .paths     = {filePath},
+                .type      = ResourceType::kModel,
+                .load_type = LoadType::kInternal,
+            });
+        }
+    );
+
     if (ImGui::BeginListBox("Available models:")) {
         for (int i = 0; i < static_cast<int>(model_names_.size()); i++) {
             const bool is_selected = (selected_model_idx_ == i);
@@ -255,8 +279,15 @@ void LibGcp::DebugOverlay::DrawSceneWindow_()
     ImGui::Begin("Scene editor: ");
 
     DisplayFileDialog_("SaveSceneDlg", "Save Scene", ".libgcp_scene", [&](const std::string &filePath) {
-        SceneSerializer serializer(GetDirFromFile(filePath));
-        const auto rc = serializer.SerializeScene(GetFileName(filePath), SerializationType::kShallow);
+        Rc rc;
+
+        if (scene_serializer_ && scene_path_ == filePath) {
+            /* same file as the last save or load, write only changed sections */
+            rc = scene_serializer_->SerializeSceneIncremental(GetFileName(filePath));
+        } else {
+            BindSceneSerializer_(filePath);
+            rc = scene_serializer_->SerializeScene(GetFileName(filePath), SerializationType::kShallow);
+        }
 
         if (IsFailure(rc)) {
             TRACE("Failed to save scene: " << GetRcDescription(rc));
@@ -267,18 +298,30 @@ void LibGcp::DebugOverlay::DrawSceneWindow_()
     });
 
     DisplayFileDialog_("LoadSceneDlg", "Load scene", ".libgcp_scene", [&](const std::string &filePath) {
-        SceneSerializer serializer(GetDirFromFile(filePath));
-        const auto [rc, scene] = serializer.LoadScene(GetFileName(filePath), SerializationType::kShallow);
+        /* current scene keeps rendering until the new one is ready */
+        Engine::GetInstance().GetScenePreloader().Preload(
+            GetDirFromFile(filePath), GetFileName(filePath),
+            [this, filePath](const Rc rc) {
+                if (IsFailure(rc)) {
+                    TRACE("Failed to load scene: " << GetRcDescription(rc));
+                    TriggerFailure_(GetRcDescription(rc));
+                    return;
+                }
 
-        if (IsFailure(rc)) {
-            TRACE("Failed to load scene: " << GetRcDescription(rc));
-            TriggerFailure_(GetRcDescription(rc));
-        } else {
-            TRACE("Scene loaded successfully");
-            Engine::GetInstance().ReloadScene(scene);
-        }
+                TRACE("Scene loaded successfully");
+                BindSceneSerializer_(filePath);
+
+                /* freshly loaded scene matches the file */
+                scene_serializer_->MarkClean();
+            }
+        );
     });
 
+    if (Engine::GetInstance().GetScenePreloader().IsLoading()) {
+        const auto &preload_stats = Engine::GetInstance().GetScenePreloader().GetStats();
+        ImGui::Text("Loading scene: %zu / %zu models", preload_stats.staged_models, preload_stats.total_models);
+    }
+
     if (ImGui::Button("Clear all objects")) {
         ObjectMgr::GetInstance().GetStaticObjects().Clear();
     }
@@ -287,6 +330,36 @@ void LibGcp::DebugOverlay::DrawSceneWindow_()
         Engine::GetInstance().ReloadScene(kEmptyScene);
     }
 
+    ImGui::Separator();
+    ImGui::DragFloat("Cell size", &partition_cell_size_, 1.0f, 1.0f, 4096.0f);
+
+    /* partitioning works on the saved file, the scene must be saved or loaded first */
+    if (!scene_serializer_) {
+        ImGui::Text("Save or load the scene to partition it");
+    } else if (ImGui::Button("Partition scene into cells")) {
+        const std::string scene_name = GetFileName(scene_path_);
+        Rc rc                        = scene_serializer_->SerializeSceneIncremental(scene_name);
+
+        if (IsSuccess(rc)) {
+            rc = scene_serializer_->PartitionScene(scene_name, partition_cell_size_);
+        }
+
+        if (IsSuccess(rc)) {
+            auto [load_rc, scene] = scene_serializer_->LoadScene(scene_name, SerializationType::kShallow);
+            rc                    = load_rc;
+
+            if (IsSuccess(rc)) {
+                Engine::GetInstance().ReloadScene(scene);
+                scene_serializer_->MarkClean();
+            }
+        }
+
+        if (IsFailure(rc)) {
+            TRACE("Failed to partition scene: " << GetRcDescription(rc));
+            TriggerFailure_(GetRcDescription(rc));
+        }
+    }
+
     ImGui::End();
 }
 
@@ -309,6 +382,218 @@ void LibGcp::DebugOverlay::DrawInfoWindow_()
         SettingsMgr::GetInstance().SetSetting<Setting::kCurrentWordTime>(curr_time - WordTime::kSecondsInHour);
     }
 
+    const auto dedup_stats = ResourceMgr::GetInstance().GetDedupStats();
+    ImGui::Separator();
+    ImGui::Text(
+        "Shared textures: %zu, shared meshes: %zu", dedup_stats.shared_textures, dedup_stats.shared_meshes
+    );
+    ImGui::Text("Deduplicated bytes: %.2f MiB", static_cast<double>(dedup_stats.bytes_saved) / (1024.0 * 1024.0));
+
+    const auto memory_stats = ResourceMgr::GetInstance().GetMemoryStats();
+    ImGui::Text(
+        "VRAM: %.2f / %.2f MiB, RAM: %.2f MiB", static_cast<double>(memory_stats.vram_bytes) / (1024.0 * 1024.0),
+        static_cast<double>(memory_stats.budget_bytes) / (1024.0 * 1024.0),
+        static_cast<double>(memory_stats.ram_bytes) / (1024.0 * 1024.0)
+    );
+    ImGui::Text("Evicted resources: %zu", memory_stats.evicted_resources);
+
+    for (size_t idx = 0; idx < MemoryTracker::kCategoryCount; ++idx) {
+        const auto category       = static_cast<MemoryTracker::Category>(idx);
+        const auto category_stats = MemoryTracker::GetCategoryStats(category);
+
+        ImGui::Text(
+            "  %s (%s): %.2f MiB in %zu allocations", MemoryTracker::GetCategoryName(category),
+            MemoryTracker::GetPoolName(MemoryTracker::GetCategoryPool(category)),
+            static_cast<double>(category_stats.bytes) / (1024.0 * 1024.0), category_stats.allocations
+        );
+    }
+
+    if (ImGui::Button("Dump memory breakdown")) {
+        UNUSED const Rc rc = MemoryTracker::DumpCsv(kMemoryBreakdownPath);
+        TRACE("Dumping memory breakdown to " << kMemoryBreakdownPath << ": " << GetRcDescription(rc));
+    }
+
+    const auto lazy_stats = ResourceMgr::GetInstance().GetLazyModelStats();
+    ImGui::Text(
+        "Placeholder models: %zu, pending imports: %zu, lazily loaded: %zu, failed: %zu", lazy_stats.placeholders,
+        lazy_stats.pending_imports, lazy_stats.resolved_models, lazy_stats.failed_models
+    );
+
+    if (const auto *shared_cache = ResourceMgr::GetInstance().GetSharedAssetCache()) {
+        const auto shared_stats = shared_cache->GetStats();
+        ImGui::Text(
+            "Shared assets: %zu, hits: %zu, misses: %zu, used: %.2f / %.2f MiB", shared_stats.entries,
+            shared_stats.hits, shared_stats.misses, static_cast<double>(shared_stats.used_bytes) / (1024.0 * 1024.0),
+            static_cast<double>(shared_stats.capacity_bytes) / (1024.0 * 1024.0)
+        );
+    }
+
+    const auto &streamer_stats = Engine::GetInstance().GetTextureStreamer().GetStats();
+    ImGui::Text(
+        "Streamed textures: %zu, resident: %.2f / %.2f MiB", streamer_stats.streamed_textures,
+        static_cast<double>(streamer_stats.resident_bytes) / (1024.0 * 1024.0),
+        static_cast<double>(streamer_stats.full_bytes) / (1024.0 * 1024.0)
+    );
+    ImGui::Text(
+        "Pending mip levels: %zu, uploaded: %.2f MiB", streamer_stats.pending_levels,
+        static_cast<double>(streamer_stats.uploaded_bytes) / (1024.0 * 1024.0)
+    );
+
+    const auto codec_stats = ChunkCodec::GetStats();
+    ImGui::Text(
+        "Compressed chunks: %zu, read: %.2f MiB for %.2f MiB, decoding: %.2f ms", codec_stats.decoded_chunks,
+        static_cast<double>(codec_stats.stored_bytes) / (1024.0 * 1024.0),
+        static_cast<double>(codec_stats.raw_bytes) / (1024.0 * 1024.0),
+        static_cast<double>(codec_stats.decode_ns) / 1e6
+    );
+
+    const auto &preload_stats = Engine::GetInstance().GetScenePreloader().GetStats();
+    ImGui::Text(
+        "Last scene preload peak VRAM: %.2f MiB, RAM: %.2f MiB",
+        static_cast<double>(preload_stats.peak_vram_bytes) / (1024.0 * 1024.0),
+        static_cast<double>(preload_stats.peak_ram_bytes) / (1024.0 * 1024.0)
+    );
+
+    const auto &world_stats = Engine::GetInstance().GetWorldStreamer().GetStats();
+    ImGui::Text(
+        "World cells: %zu / %zu, pending: %zu, streamed objects: %zu", world_stats.loaded_cells,
+        world_stats.total_cells, world_stats.pending_cells, world_stats.streamed_objects
+    );
+
+    const auto &gpu_profiler = Engine::GetInstance().GetGpuProfiler();
+    ImGui::Separator();
+    ImGui::Text(
+        "GPU frame: %.3f ms, dropped samples: %zu", gpu_profiler.GetAverageFrameMs(),
+        gpu_profiler.GetDroppedSamples()
+    );
+    for (size_t idx = 0; idx < GpuProfiler::kPassCount; ++idx) {
+        const auto pass  = static_cast<GpuProfiler::Pass>(idx);
+        const auto stats = gpu_profiler.GetStats(pass);
+        ImGui::Text(
+            "%s: avg %.3f ms, p50 %.3f, p95 %.3f, p99 %.3f, max %.3f", GpuProfiler::GetPassName(pass),
+            stats.average_ms, stats.p50_ms, stats.p95_ms, stats.p99_ms, stats.max_ms
+        );
+    }
+
+    auto &telemetry = Engine::GetInstance().GetFrameTelemetry();
+    ImGui::Separator();
+    ImGui::Text(
+        "Telemetry frames: %zu, stream dropped: %zu", static_cast<size_t>(telemetry.GetPushedRecords()),
+        telemetry.GetStreamDroppedRecords()
+    );
+
+    if (ImGui::Button("Dump telemetry CSV")) {
+        UNUSED const Rc rc = telemetry.DumpCsv(kTelemetryCsvPath);
+        TRACE("Dumping frame telemetry to " << kTelemetryCsvPath << ": " << GetRcDescription(rc));
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Dump telemetry JSON")) {
+        UNUSED const Rc rc = telemetry.DumpJson(kTelemetryJsonPath);
+        TRACE("Dumping frame telemetry to " << kTelemetryJsonPath << ": " << GetRcDescription(rc));
+    }
+
+    bool is_streaming = telemetry.IsStreaming();
+    if (ImGui::Checkbox("Stream telemetry", &is_streaming)) {
+        if (is_streaming) {
+            UNUSED const Rc rc = telemetry.StartStreaming(kTelemetryStreamPath);
+            TRACE("Streaming frame telemetry to " << kTelemetryStreamPath << ": " << GetRcDescription(rc));
+        } else {
+            telemetry.StopStreaming();
+        }
+    }
+
+    /* capture is stored next to the scene, so the replay can be run against the same file */
+    std::string capture_path = InputCapture::kDefaultCapturePath;
+    if (!scene_path_.empty()) {
+        capture_path = std::filesystem::path(scene_path_).replace_extension(InputCapture::kFileExtension).string();
+    }
+
+    const auto &recorder    = Engine::GetInstance().GetInputRecorder();
+    const bool is_recording = recorder.IsRecording();
+
+    ImGui::Separator();
+    if (!is_recording && ImGui::Button("Record input")) {
+        Engine::GetInstance().StartInputRecording();
+    } else if (is_recording && ImGui::Button("Stop recording input")) {
+        UNUSED const Rc rc = Engine::GetInstance().StopInputRecording(capture_path);
+        TRACE("Saving input capture to " << capture_path << ": " << GetRcDescription(rc));
+    }
+
+    if (is_recording) {
+        ImGui::SameLine();
+        ImGui::Text(
+            "Recorded frames: %zu, events: %zu", recorder.GetCapture().GetFrames().size(),
+            recorder.GetCapture().GetEvents().size()
+        );
+    }
+
+    ImGui::End();
+}
+
+void LibGcp::DebugOverlay::DrawProfilerWindow_()
+{
+    if constexpr (!Profiler::kUseProfiler) {
+        return;
+    }
+
+    ImGui::Begin("CPU profiler:");
+
+    if (ImGui::Button("Export Chrome trace")) {
+        UNUSED const Rc rc = Profiler::ExportChromeTrace(kTraceExportPath);
+        TRACE("Exporting profiler trace to " << kTraceExportPath << ": " << GetRcDescription(rc));
+    }
+
+    /* zones of the last second, time spent in children is excluded from self time */
+    for (const auto &thread : Profiler::GetFlameSummary()) {
+        if (!ImGui::TreeNode(thread.thread_name.c_str())) {
+            continue;
+        }
+
+        for (const auto &node : thread.nodes) {
+            ImGui::Text(
+                "%*s%s: %.3f ms, self: %.3f ms, calls: %zu", static_cast<int>(node.depth * 2), "", node.name,
+                static_cast<double>(node.total_ns) / 1e6, static_cast<double>(node.self_ns) / 1e6, node.calls
+            );
+        }
+
+        ImGui::TreePop();
+    }
+
+    ImGui::End();
+}
+
+void LibGcp::DebugOverlay::DrawRenderStatsWindow_()
+{
+    if constexpr (!RenderStats::kUseRenderStats) {
+        return;
+    }
+
+    ImGui::Begin("Render stats:");
+
+    const auto &frame = RenderStats::GetLastFrame();
+    ImGui::Text("Visible objects: %zu, culled: %zu", frame.visible_objects, frame.culled_objects);
+
+    const auto draw_counters = [](const char *name, const RenderStats::Counters &counters) {
+        ImGui::Separator();
+        ImGui::Text(
+            "%s: draws: %zu, triangles: %zu, vertices: %zu", name, counters.draw_calls, counters.triangles,
+            counters.vertices
+        );
+        ImGui::Text(
+            "  programs: %zu, VAOs: %zu, textures: %zu, framebuffers: %zu", counters.program_binds,
+            counters.vao_binds, counters.texture_binds, counters.framebuffer_binds
+        );
+        ImGui::Text(
+            "  uniforms: %zu, uploaded: %.2f KiB", counters.uniform_uploads,
+            static_cast<double>(counters.uploaded_bytes) / 1024.0
+        );
+    };
+
+    draw_counters("Frame", frame.GetTotal());
+    for (size_t slot = 0; slot < RenderStats::kSlotCount; ++slot) {
+        draw_counters(RenderStats::GetSlotName(slot), frame.slots[slot]);
+    }
+
     ImGui::End();
 }
 
@@ -457,20 +742,26 @@ void LibGcp::DebugOverlay::DrawEditPointLight_()
             selected_model_->GetLights().GetUnderlyingData<PointLight>().begin() + selected_point_light_idx_
         );
         selected_model_point_lights_.pop_back();
+        MarkSceneDirty_(SceneSerialized::Section::kPointLights);
 
         selected_point_light_idx_ = -1;
         selected_point_light_     = nullptr;
         return;
     }
 
-    ImGui::DragFloat3("Light position", &selected_point_light_->light_info.position.x, 0.01f);
-    ImGui::DragFloat3("Ambient", &selected_point_light_->light_info.ambient.x, 0.01f);
-    ImGui::DragFloat3("Diffuse", &selected_point_light_->light_info.diffuse.x, 0.01f);
-    ImGui::DragFloat3("Specular", &selected_point_light_->light_info.specular.x, 0.01f);
-    ImGui::DragFloat("Intensity", &selected_point_light_->light_info.intensity, 0.01f);
-    ImGui::DragFloat("Constant", &selected_point_light_->point_light.constant, 0.01f);
-    ImGui::DragFloat("Linear", &selected_point_light_->point_light.linear, 0.01f);
-    ImGui::DragFloat("Quadratic", &selected_point_light_->point_light.quadratic, 0.01f);
+    bool edited{};
+    edited |= ImGui::DragFloat3("Light position", &selected_point_light_->light_info.position.x, 0.01f);
+    edited |= ImGui::DragFloat3("Ambient", &selected_point_light_->light_info.ambient.x, 0.01f);
+    edited |= ImGui::DragFloat3("Diffuse", &selected_point_light_->light_info.diffuse.x, 0.01f);
+    edited |= ImGui::DragFloat3("Specular", &selected_point_light_->light_info.specular.x, 0.01f);
+    edited |= ImGui::DragFloat("Intensity", &selected_point_light_->light_info.intensity, 0.01f);
+    edited |= ImGui::DragFloat("Constant", &selected_point_light_->point_light.constant, 0.01f);
+    edited |= ImGui::DragFloat("Linear", &selected_point_light_->point_light.linear, 0.01f);
+    edited |= ImGui::DragFloat("Quadratic", &selected_point_light_->point_light.quadratic, 0.01f);
+
+    if (edited) {
+        MarkSceneDirty_(SceneSerialized::Section::kPointLights);
+    }
 }
 
 void LibGcp::DebugOverlay::DrawEditSpotlight_()
@@ -484,23 +775,29 @@ void LibGcp::DebugOverlay::DrawEditSpotlight_()
             selected_model_->GetLights().GetUnderlyingData<SpotLight>().begin() + selected_spotlight_idx_
         );
         selected_model_spotlights_.pop_back();
+        MarkSceneDirty_(SceneSerialized::Section::kSpotLights);
 
         selected_spotlight_idx_ = -1;
         selected_spotlight_     = nullptr;
         return;
     }
 
-    ImGui::DragFloat3("light position", &selected_spotlight_->light_info.position.x, 0.01f);
-    ImGui::DragFloat3("ambient", &selected_spotlight_->light_info.ambient.x, 0.01f);
-    ImGui::DragFloat3("diffuse", &selected_spotlight_->light_info.diffuse.x, 0.01f);
-    ImGui::DragFloat3("specular", &selected_spotlight_->light_info.specular.x, 0.01f);
-    ImGui::DragFloat("intensity", &selected_spotlight_->light_info.intensity, 0.01f);
-    ImGui::DragFloat3("Direction", &selected_spotlight_->spot_light.direction.x, 0.01f);
-    ImGui::DragFloat("constant", &selected_spotlight_->spot_light.constant, 0.01f);
-    ImGui::DragFloat("linear", &selected_spotlight_->spot_light.linear, 0.01f);
-    ImGui::DragFloat("quadratic", &selected_spotlight_->spot_light.quadratic, 0.01f);
-    ImGui::DragFloat("Cut off", &selected_spotlight_->spot_light.cut_off, 0.01f);
-    ImGui::DragFloat("Outer cut off", &selected_spotlight_->spot_light.outer_cut_off, 0.01f);
+    bool edited{};
+    edited |= ImGui::DragFloat3("light position", &selected_spotlight_->light_info.position.x, 0.01f);
+    edited |= ImGui::DragFloat3("ambient", &selected_spotlight_->light_info.ambient.x, 0.01f);
+    edited |= ImGui::DragFloat3("diffuse", &selected_spotlight_->light_info.diffuse.x, 0.01f);
+    edited |= ImGui::DragFloat3("specular", &selected_spotlight_->light_info.specular.x, 0.01f);
+    edited |= ImGui::DragFloat("intensity", &selected_spotlight_->light_info.intensity, 0.01f);
+    edited |= ImGui::DragFloat3("Direction", &selected_spotlight_->spot_light.direction.x, 0.01f);
+    edited |= ImGui::DragFloat("constant", &selected_spotlight_->spot_light.constant, 0.01f);
+    edited |= ImGui::DragFloat("linear", &selected_spotlight_->spot_light.linear, 0.01f);
+    edited |= ImGui::DragFloat("quadratic", &selected_spotlight_->spot_light.quadratic, 0.01f);
+    edited |= ImGui::DragFloat("Cut off", &selected_spotlight_->spot_light.cut_off, 0.01f);
+    edited |= ImGui::DragFloat("Outer cut off", &selected_spotlight_->spot_light.outer_cut_off, 0.01f);
+
+    if (edited) {
+        MarkSceneDirty_(SceneSerialized::Section::kSpotLights);
+    }
 }
 
 void LibGcp::DebugOverlay::SetSelectedModel_(const int idx)
@@ -691,9 +988,14 @@ void LibGcp::DebugOverlay::DrawSelectedObjectPositionEditor_()
 
     ImGui::Text("Selected object data:");
 
-    ImGui::DragFloat3("Position", &static_object_->GetPosition().position.x, 0.01f);
-    ImGui::DragFloat3("Rotation", &static_object_->GetPosition().rotation.x, 0.01f);
-    ImGui::DragFloat3("Scale", &static_object_->GetPosition().scale.x, 0.01f);
+    bool edited{};
+    edited |= ImGui::DragFloat3("Position", &static_object_->GetPosition().position.x, 0.01f);
+    edited |= ImGui::DragFloat3("Rotation", &static_object_->GetPosition().rotation.x, 0.01f);
+    edited |= ImGui::DragFloat3("Scale", &static_object_->GetPosition().scale.x, 0.01f);
+
+    if (edited) {
+        MarkSceneDirty_(SceneSerialized::Section::kStaticObjects);
+    }
 
     if (ImGui::IsItemHovered()) {
         ImGui::SetTooltip("Drag to adjust or double-click to type value. Hold Shift for faster changes.");
@@ -725,6 +1027,21 @@ void LibGcp::DebugOverlay::DrawSelectedModelSpawnSection_()
         });
     }
 
+    /* exported file is loaded back without assimp, see "Choose internal model" */
+    DisplayFileDialog_(
+        "ExportModelDlg", "Export to internal format", ModelSerializer::kInternalExtension,
+        [&](const std::string &filePath) {
+            ModelSerializer serializer{};
+
+            if (const Rc rc = serializer.DumpModelToInternalFormat(*selected_model_, filePath); IsFailure(rc)) {
+                TRACE("Failed to export model: " << GetRcDescription(rc));
+                TriggerFailure_(GetRcDescription(rc));
+            } else {
+                TRACE("Model exported to: " << filePath);
+            }
+        }
+    );
+
     ImGui::RadioButton("Point light", &selected_light_type_, kPointLightRadioIdx);
     ImGui::RadioButton("Spotlight", &selected_light_type_, kSpotLightRadioIdx);
 
@@ -734,9 +1051,11 @@ void LibGcp::DebugOverlay::DrawSelectedModelSpawnSection_()
             selected_model_point_lights_.push_back(
                 "Point light " + std::to_string(selected_model_point_lights_.size())
             );
+            MarkSceneDirty_(SceneSerialized::Section::kPointLights);
         } else {
             Engine::GetInstance().GetLightMgr().AddLight(*selected_model_, kDefaultSpotLight);
             selected_model_spotlights_.push_back("Spotlight " + std::to_string(selected_model_spotlights_.size()));
+            MarkSceneDirty_(SceneSerialized::Section::kSpotLights);
         }
     }
 
@@ -800,3 +1119,17 @@ void LibGcp::DebugOverlay::SetSelectedMesh_(const int idx)
     selected_mesh_idx_  = idx;
     static_object_mesh_ = static_object_model_->GetMesh(idx);
 }
+
+void LibGcp::DebugOverlay::BindSceneSerializer_(const std::string &file_path)
+{
+    scene_serializer_ = std::make_unique<SceneSerializer>(GetDirFromFile(file_path));
+    scene_serializer_->StartChangeTracking();
+    scene_path_ = file_path;
+}
+
+void LibGcp::DebugOverlay::MarkSceneDirty_(const SceneSerialized::Section section)
+{
+    if (scene_serializer_) {
+        scene_serializer_->MarkDirty(section);
+    }
+}
@@ -2,6 +2,8 @@
 #define WINDOW_OVERLAY_DEBUG_OVERLAY_HPP_
 
 #include <libcgp/defines.hpp>
+#include <libcgp/intf.hpp>
+#include <libcgp/serialization/scene_serializer.hpp>
 #include <libcgp/utils/files.hpp>
 
 #include <ImGuiFileDialog.h>
@@ -14,6 +16,12 @@ class DebugOverlay
     static constexpr int kPointLightRadioIdx = 0;
     static constexpr int kSpotLightRadioIdx  = 1;
 
+    static constexpr const char *kTraceExportPath     = "profiler_trace.json";
+    static constexpr const char *kTelemetryCsvPath    = "frame_telemetry.csv";
+    static constexpr const char *kTelemetryJsonPath   = "frame_telemetry.json";
+    static constexpr const char *kTelemetryStreamPath = "frame_telemetry_stream.csv";
+    static constexpr const char *kMemoryBreakdownPath = "memory_breakdown.csv";
+
     public:
     // ------------------------------
     // Object creation
@@ -65,6 +73,10 @@ class DebugOverlay
 
     void DrawInfoWindow_();
 
+    void DrawProfilerWindow_();
+
+    void DrawRenderStatsWindow_();
+
     void DrawGlobalLightEditorWindow_();
 
     void DrawGlobalLightEditSection_();
@@ -111,6 +123,10 @@ class DebugOverlay
 
     void DrawLightHighlights_();
 
+    void BindSceneSerializer_(const std::string &file_path);
+
+    void MarkSceneDirty_(SceneSerialized::Section section);
+
     template <class FuncT>
     static void DisplayFileDialog_(
         const std::string &key, const std::string &title, const std::string &extensions, FuncT &&func
@@ -187,6 +203,11 @@ class DebugOverlay
     int global_light_idx_{-1};
     std::vector<std::string> global_light_names_{};
 
+    /* Scene bound to the last save or load, used for incremental saves */
+    std::unique_ptr<SceneSerializer> scene_serializer_{};
+    std::string scene_path_{};
+    float partition_cell_size_{64.0f};
+
     /* Window info */
     GLFWwindow *window_{};
     std::shared_ptr<Shader> shader_{};
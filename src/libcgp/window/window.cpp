@@ -1,4 +1,5 @@
 #include <libcgp/engine/engine.hpp>
+#include <libcgp/engine/startup_timeline.hpp>
 #include <libcgp/window/window.hpp>
 
 #include <libcgp/utils/macros.hpp>
@@ -22,32 +23,45 @@ LibGcp::Window::~Window()
     glfwTerminate();
 }
 
-void LibGcp::Window::Init()
+void LibGcp::Window::Init(const bool is_hidden)
 {
-    glfwInit();
+    {
+        const StartupTimeline::Scope phase(StartupTimeline::Phase::kGlfwInit);
+        glfwInit();
+    }
+
+    GLFWwindow *window{};
+    {
+        const StartupTimeline::Scope phase(StartupTimeline::Phase::kContextCreation);
 
-    /* setup initial config */
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-    glfwWindowHint(GLFW_DEPTH_BITS, 32);
+        /* setup initial config */
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_DEPTH_BITS, 32);
+        glfwWindowHint(GLFW_VISIBLE, is_hidden ? GLFW_FALSE : GLFW_TRUE);
 
-    /* create window */
-    GLFWwindow *window = glfwCreateWindow(kWidth, kHeight, "RenderEngine", nullptr, nullptr);
-    window_            = window;
-    R_ASSERT(window != nullptr);
+        /* create window */
+        window  = glfwCreateWindow(kWidth, kHeight, "RenderEngine", nullptr, nullptr);
+        window_ = window;
+        R_ASSERT(window != nullptr);
 
-    glfwMakeContextCurrent(window);
+        glfwMakeContextCurrent(window);
+    }
 
     /* setup window options */
-    SwitchMouseLock(true);
+    SwitchMouseLock(!is_hidden);
 
     /* setup callbacks */
     glfwSetKeyCallback(window, KeyCallback);
     glfwSetFramebufferSizeCallback(window, FrameBufferSizeCallback);
     glfwSetCursorPosCallback(window, MouseCallback);
 
-    const auto version = gladLoadGL(glfwGetProcAddress);
+    int version{};
+    {
+        const StartupTimeline::Scope phase(StartupTimeline::Phase::kGladLoad);
+        version = gladLoadGL(glfwGetProcAddress);
+    }
     R_ASSERT(version);
     TRACE("Loaded OpenGL " << GLAD_VERSION_MAJOR(version) << "." << GLAD_VERSION_MINOR(version));
 
@@ -57,7 +71,9 @@ void LibGcp::Window::Init()
     glEnable(GL_DEPTH_TEST);
 
     /* disable vsync */
-    // glfwSwapInterval(0);
+    if (is_hidden) {
+        glfwSwapInterval(0);
+    }
 
     SyncMousePositionWithWindow_();
 }
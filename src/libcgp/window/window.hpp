@@ -3,6 +3,7 @@
 
 #include <CxxUtils/singleton.hpp>
 #include <libcgp/defines.hpp>
+#include <libcgp/utils/profiler.hpp>
 #include <libcgp/window/mouse.hpp>
 #include <libcgp/window/overlay/app_overlay.hpp>
 #include <libcgp/window/overlay/debug_overlay.hpp>
@@ -40,7 +41,8 @@ class Window : public CxxUtils::Singleton<Window>
     // Class interaction
     // ------------------------------
 
-    void Init();
+    /* Hidden window is used for offscreen rendering, vsync is disabled there */
+    void Init(bool is_hidden = false);
 
     FAST_CALL void InitDebug() { debug_overlay_.Init(window_); }
     FAST_CALL void DestroyDebug() { debug_overlay_.Destroy(); }
@@ -59,6 +61,7 @@ class Window : public CxxUtils::Singleton<Window>
     {
         // Game loop
         while (glfwWindowShouldClose(window_) == 0) {
+            PROFILE_SCOPE("Frame");
             glfwPollEvents();
 
             /* call function processing progress of app*/
@@ -75,6 +78,13 @@ class Window : public CxxUtils::Singleton<Window>
         }
     }
 
+    /* Presents the frame when frames are driven outside of RunLoop */
+    FAST_CALL void SwapBuffers()
+    {
+        glfwPollEvents();
+        glfwSwapBuffers(window_);
+    }
+
     NDSCRD FAST_CALL float GetAspectRatio() const
     {
         const auto [width, height] = GetWindowSize();
@@ -0,0 +1,88 @@
+#include <libcgp/main.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+static constexpr size_t kDefaultFrames       = 1000;
+static constexpr size_t kDefaultWarmupFrames = 60;
+static constexpr uint64_t kDefaultDeltaUs    = 16667;
+static constexpr const char *kDefaultReport  = "bench_report.json";
+
+using namespace LibGcp;
+
+static void PrintUsage(const char *name)
+{
+    std::cerr << "Usage: " << name << " <path to scene> [options]\n"
+              << "  --frames <count>       measured frames, default: " << kDefaultFrames << "\n"
+              << "  --warmup <count>       frames rendered before measuring, default: " << kDefaultWarmupFrames << "\n"
+              << "  --delta-us <micros>    clock delta of every frame, default: " << kDefaultDeltaUs << "\n"
+              << "  --camera-path <file>   keyframes 'px py pz tx ty tz' per line, default: orbit\n"
+              << "  --replay <file>        recorded input replayed instead of the camera path, with the recorded\n"
+              << "                         deltas unless --delta-us is given\n"
+              << "  --report <file>        JSON report, default: " << kDefaultReport << "\n"
+              << "  --software             use Mesa software rasterizer\n"
+              << "The window stays hidden but still needs a display, run under 'xvfb-run -a' on headless machines"
+              << std::endl;
+}
+
+/* Mesa reads these at context creation, values set by the user win */
+static void UseSoftwareRenderer()
+{
+    setenv("LIBGL_ALWAYS_SOFTWARE", "1", 0);
+    setenv("GALLIUM_DRIVER", "llvmpipe", 0);
+    setenv("MESA_GL_VERSION_OVERRIDE", "4.6", 0);
+    setenv("MESA_GLSL_VERSION_OVERRIDE", "460", 0);
+}
+
+int main(const int argc, const char *argv[])
+{
+    if (argc < 2) {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    BenchConfig config{
+        .scene_path         = argv[1],
+        .camera_path        = {},
+        .input_capture_path = {},
+        .report_path        = kDefaultReport,
+        .frames             = kDefaultFrames,
+        .warmup_frames      = kDefaultWarmupFrames,
+        .delta_us           = kDefaultDeltaUs,
+    };
+
+    bool has_delta = false;
+    for (int idx = 2; idx < argc; ++idx) {
+        const std::string_view arg = argv[idx];
+        const bool has_value       = idx + 1 < argc;
+
+        if (arg == "--software") {
+            UseSoftwareRenderer();
+        } else if (arg == "--frames" && has_value) {
+            config.frames = std::strtoull(argv[++idx], nullptr, 10);
+        } else if (arg == "--warmup" && has_value) {
+            config.warmup_frames = std::strtoull(argv[++idx], nullptr, 10);
+        } else if (arg == "--delta-us" && has_value) {
+            config.delta_us = std::strtoull(argv[++idx], nullptr, 10);
+            has_delta       = true;
+        } else if (arg == "--camera-path" && has_value) {
+            config.camera_path = argv[++idx];
+        } else if (arg == "--replay" && has_value) {
+            config.input_capture_path = argv[++idx];
+        } else if (arg == "--report" && has_value) {
+            config.report_path = argv[++idx];
+        } else {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    /* recorded deltas keep the replay frame exact */
+    if (!config.input_capture_path.empty() && !has_delta) {
+        config.delta_us = 0;
+    }
+
+    return RenderEngineBenchMain(config);
+}
@@ -1,9 +1,8 @@
 #include <libcgp/main.hpp>
-#include <libcgp/serialization/scene_serializer.hpp>
-#include <libcgp/utils/files.hpp>
 
 #include <cstdlib>
 #include <iostream>
+#include <string>
 
 using namespace LibGcp;
 
@@ -14,17 +13,6 @@ int main(const int argc, const char *argv[])
         return EXIT_FAILURE;
     }
 
-    const std::string scene_path = argv[1];
-    const std::string dir        = GetDirFromFile(scene_path);
-    const std::string scene_name = GetFileName(scene_path);
-
-    SceneSerializer scene_serializer(dir);
-    const auto [rc, scene] = scene_serializer.LoadScene(scene_name, SerializationType::kShallow);
-
-    if (IsFailure(rc)) {
-        std::cerr << "Failed to load scene: " << scene_path << " caused by: " << GetRcDescription(rc) << std::endl;
-        return EXIT_FAILURE;
-    }
-
-    return RenderEngineMain(scene);
+    /* scene is parsed while the window is created */
+    return RenderEngineMain(std::string(argv[1]));
 }
@@ -31,8 +31,13 @@ struct GBuffer {
     sampler2D albedo_spec;
 };
 
+#ifndef MAX_LIGHTS
 #define MAX_LIGHTS 32
+#endif
+
+#ifndef MAX_GLOBAL_LIGHTS
 #define MAX_GLOBAL_LIGHTS 8
+#endif
 
 struct Lightning {
     uint num_point_lights;
@@ -45,7 +50,22 @@ struct Lightning {
     LightInfo global_lights[MAX_GLOBAL_LIGHTS];
 };
 
+#ifndef SHININESS
 #define SHININESS 32.0 // TODO: Change to material property
+#endif
+
+/* Permutations fix light counts at compile time, so loops get unrolled or removed */
+#ifdef NUM_POINT_LIGHTS
+#define POINT_LIGHTS_COUNT NUM_POINT_LIGHTS
+#else
+#define POINT_LIGHTS_COUNT un_lightning.num_point_lights
+#endif
+
+#ifdef NUM_SPOT_LIGHTS
+#define SPOT_LIGHTS_COUNT NUM_SPOT_LIGHTS
+#else
+#define SPOT_LIGHTS_COUNT un_lightning.num_spot_lights
+#endif
 
 uniform vec3 un_view_pos;
 uniform Lightning un_lightning;
@@ -76,12 +96,12 @@ void main()
     }
 
     /* Point Lights */
-    for (uint i = 0; i < un_lightning.num_point_lights; i++) {
+    for (uint i = 0; i < POINT_LIGHTS_COUNT; i++) {
         result += CalcPointLight(un_lightning.point_lights[i], normal, diffuse, specular, frag_pos, view_dir);
     }
 
     /* Spot Lights */
-    for (uint i = 0; i < un_lightning.num_spot_lights; i++) {
+    for (uint i = 0; i < SPOT_LIGHTS_COUNT; i++) {
         result += CalcSpotLight(un_lightning.spot_lights[i], normal, diffuse, specular, frag_pos, view_dir);
     }
 
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <libcgp/utils/chunk_codec.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+using LibGcp::ChunkCodec;
+
+/* Smooth float array, so every filter has something to compress */
+static std::vector<std::byte> MakePayload(const size_t float_count)
+{
+    std::vector<float> values(float_count);
+    for (size_t idx = 0; idx < float_count; ++idx) {
+        values[idx] = std::sin(static_cast<float>(idx) * 0.01f) * 100.0f;
+    }
+
+    std::vector<std::byte> payload(values.size() * sizeof(float));
+    std::memcpy(payload.data(), values.data(), payload.size());
+
+    return payload;
+}
+
+static void ExpectRoundTrip(const std::vector<std::byte> &raw, const ChunkCodec::Filter filter, const uint32_t stride)
+{
+    const auto chunk = ChunkCodec::Encode(raw, filter, stride);
+    ASSERT_EQ(ChunkCodec::GetDecodedSize(chunk), raw.size());
+
+    std::vector<std::byte> decoded(raw.size());
+    ASSERT_TRUE(ChunkCodec::Decode(chunk, decoded));
+    EXPECT_EQ(decoded, raw);
+}
+
+TEST(ChunkCodecTest, RoundTripEachFilter)
+{
+    const auto raw = MakePayload(100'000);
+
+    for (const auto filter : {ChunkCodec::Filter::kNone, ChunkCodec::Filter::kShuffle, ChunkCodec::Filter::kDelta}) {
+        SCOPED_TRACE(static_cast<int>(filter));
+        ExpectRoundTrip(raw, filter, sizeof(float));
+    }
+}
+
+TEST(ChunkCodecTest, RoundTripIncompleteElement)
+{
+    /* size is not a multiple of the stride and the last block is partial */
+    auto raw = MakePayload(70'001);
+    raw.resize(raw.size() - 3);
+
+    for (const auto filter : {ChunkCodec::Filter::kNone, ChunkCodec::Filter::kShuffle, ChunkCodec::Filter::kDelta}) {
+        SCOPED_TRACE(static_cast<int>(filter));
+        ExpectRoundTrip(raw, filter, 12);
+    }
+}
+
+TEST(ChunkCodecTest, RoundTripLargeChunk)
+{
+    /* large enough to be decoded by several workers */
+    const auto raw = MakePayload(4 * 1024 * 1024);
+
+    ExpectRoundTrip(raw, ChunkCodec::Filter::kShuffle, sizeof(float));
+}
+
+TEST(ChunkCodecTest, RejectsMalformedChunk)
+{
+    const auto raw   = MakePayload(100'000);
+    const auto chunk = ChunkCodec::Encode(raw, ChunkCodec::Filter::kShuffle, sizeof(float));
+
+    std::vector<std::byte> decoded(raw.size());
+
+    /* output of a different size */
+    std::vector<std::byte> shorter(raw.size() - 1);
+    EXPECT_FALSE(ChunkCodec::Decode(chunk, shorter));
+
+    /* truncated blocks */
+    EXPECT_FALSE(ChunkCodec::Decode(std::span(chunk).first(chunk.size() - 1), decoded));
+
+    /* broken header */
+    auto broken = chunk;
+    broken[0]   = std::byte{0};
+    EXPECT_EQ(ChunkCodec::GetDecodedSize(broken), 0);
+    EXPECT_FALSE(ChunkCodec::Decode(broken, decoded));
+}
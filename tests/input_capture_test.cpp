@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <libcgp/engine/input_capture.hpp>
+#include <libcgp/mgr/settings_mgr.hpp>
+#include <libcgp/rc.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using LibGcp::InputCapture;
+
+class InputCaptureTest : public ::testing::Test
+{
+    protected:
+    static constexpr int kKey         = 87;
+    static constexpr size_t kFrames   = 100;
+    static constexpr size_t kFovFrame = 10;
+
+    std::string path_{};
+
+    static void SetUpTestSuite() { LibGcp::SettingsMgr::InitInstance(); }
+
+    static void TearDownTestSuite() { LibGcp::SettingsMgr::DeleteInstance(); }
+
+    void SetUp() override
+    {
+        path_ = (std::filesystem::temp_directory_path() / "libgcp_input_capture_test").string() +
+                InputCapture::kFileExtension;
+        std::filesystem::remove(path_);
+    }
+
+    void TearDown() override { std::filesystem::remove(path_); }
+
+    /* Key and mouse turn in every frame, one setting changed from the overlay */
+    static InputCapture Record()
+    {
+        LibGcp::InputRecorder recorder{};
+        recorder.Start({
+            .camera_position     = {1.0f, 2.0f, 3.0f},
+            .camera_front        = {0.0f, 0.0f, -1.0f},
+            .camera_up           = {0.0f, 1.0f, 0.0f},
+            .camera_yaw          = -90.0,
+            .camera_pitch        = 5.0,
+            .flow_count          = 1.5,
+            .word_tick_remainder = 42,
+        });
+
+        for (size_t frame = 0; frame < kFrames; ++frame) {
+            recorder.RecordKey(kKey);
+            recorder.RecordMouseTurn(static_cast<double>(frame) * 0.5, -static_cast<double>(frame));
+
+            if (frame == kFovFrame) {
+                LibGcp::SettingsMgr::GetInstance().SetSetting<uint64_t>(LibGcp::Setting::kFov, 12345);
+            }
+            recorder.RecordSettingChanges();
+
+            recorder.EndFrame(16000 + frame, frame * 7);
+        }
+        recorder.Stop();
+
+        return recorder.GetCapture();
+    }
+
+    void PatchHeader(const InputCapture::Header &header) const
+    {
+        std::fstream file(path_, std::ios::binary | std::ios::in | std::ios::out);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(InputCapture::Header));
+    }
+
+    InputCapture::Header ReadHeader() const
+    {
+        InputCapture::Header header{};
+
+        std::ifstream file(path_, std::ios::binary);
+        file.read(reinterpret_cast<char *>(&header), sizeof(InputCapture::Header));
+
+        return header;
+    }
+};
+
+TEST_F(InputCaptureTest, SaveAndLoadRoundTrip)
+{
+    const auto recorded = Record();
+    ASSERT_EQ(recorded.GetFrames().size(), kFrames);
+    ASSERT_EQ(recorded.Save(path_), LibGcp::Rc::kSuccess);
+
+    InputCapture loaded{};
+    ASSERT_EQ(loaded.Load(path_), LibGcp::Rc::kSuccess);
+
+    EXPECT_EQ(loaded.GetSettings(), recorded.GetSettings());
+    EXPECT_EQ(loaded.GetState().camera_position, recorded.GetState().camera_position);
+    EXPECT_EQ(loaded.GetState().camera_yaw, recorded.GetState().camera_yaw);
+    EXPECT_EQ(loaded.GetState().word_tick_remainder, recorded.GetState().word_tick_remainder);
+
+    ASSERT_EQ(loaded.GetFrames().size(), recorded.GetFrames().size());
+    for (size_t frame = 0; frame < kFrames; ++frame) {
+        EXPECT_EQ(loaded.GetFrames()[frame].delta_us, 16000 + frame);
+        EXPECT_EQ(loaded.GetFrames()[frame].state_hash, frame * 7);
+    }
+
+    ASSERT_EQ(loaded.GetEvents().size(), recorded.GetEvents().size());
+    for (size_t idx = 0; idx < recorded.GetEvents().size(); ++idx) {
+        const auto &expected = recorded.GetEvents()[idx];
+        const auto &actual   = loaded.GetEvents()[idx];
+
+        EXPECT_EQ(actual.frame, expected.frame);
+        EXPECT_EQ(actual.type, expected.type);
+        EXPECT_EQ(actual.code, expected.code);
+        EXPECT_EQ(actual.value, expected.value);
+        EXPECT_EQ(actual.x_offset, expected.x_offset);
+        EXPECT_EQ(actual.y_offset, expected.y_offset);
+    }
+
+    /* setting changed from the overlay is recorded with the events of its frame */
+    bool has_fov = false;
+    for (const auto &event : loaded.GetFrameEvents(kFovFrame)) {
+        EXPECT_EQ(event.frame, kFovFrame);
+        if (event.type == InputCapture::EventType::kSetting) {
+            EXPECT_EQ(event.code, static_cast<uint16_t>(LibGcp::Setting::kFov));
+            EXPECT_EQ(event.value, 12345);
+            has_fov = true;
+        }
+    }
+    EXPECT_TRUE(has_fov);
+}
+
+TEST_F(InputCaptureTest, RejectsCorruptedFile)
+{
+    ASSERT_EQ(Record().Save(path_), LibGcp::Rc::kSuccess);
+    const auto header = ReadHeader();
+
+    InputCapture capture{};
+
+    auto broken  = header;
+    broken.magic = 0;
+    PatchHeader(broken);
+    EXPECT_EQ(capture.Load(path_), LibGcp::Rc::kCorruptedFile);
+
+    broken         = header;
+    broken.version = InputCapture::kVersion + 1;
+    PatchHeader(broken);
+    EXPECT_EQ(capture.Load(path_), LibGcp::Rc::kOutdatedProtocol);
+
+    /* chunk sizes must match the file exactly */
+    broken                   = header;
+    broken.events_chunk_size = header.events_chunk_size + 1;
+    PatchHeader(broken);
+    EXPECT_EQ(capture.Load(path_), LibGcp::Rc::kCorruptedFile);
+
+    PatchHeader(header);
+    std::filesystem::resize_file(path_, std::filesystem::file_size(path_) - 1);
+    EXPECT_EQ(capture.Load(path_), LibGcp::Rc::kCorruptedFile);
+
+    /* failed load leaves the capture empty */
+    EXPECT_TRUE(capture.GetFrames().empty());
+    EXPECT_TRUE(capture.GetEvents().empty());
+}
+
+TEST_F(InputCaptureTest, FailsOnMissingFile)
+{
+    InputCapture capture{};
+    EXPECT_EQ(capture.Load(path_), LibGcp::Rc::kFailedToOpenFile);
+}
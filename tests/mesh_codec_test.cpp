@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+
+#include <libcgp/intf.hpp>
+#include <libcgp/mgr/resource_mgr.hpp>
+#include <libcgp/mgr/settings_mgr.hpp>
+#include <libcgp/primitives/model.hpp>
+#include <libcgp/rc.hpp>
+#include <libcgp/serialization/mesh_codec.hpp>
+#include <open_gl_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+using LibGcp::MeshCodec;
+using LibGcp::Vertex;
+
+/* Octahedral mapping with 16-bit components keeps unit vectors within this distance */
+static constexpr float kDirectionTolerance = 2e-4f;
+
+struct TestMesh {
+    std::vector<Vertex> vertices;
+    std::vector<GLuint> indices;
+};
+
+/* Wavy grid with a few vertices not referenced by any triangle */
+static TestMesh MakeGrid(const int size)
+{
+    TestMesh mesh{};
+
+    for (int z = 0; z <= size; ++z) {
+        for (int x = 0; x <= size; ++x) {
+            const float fx     = static_cast<float>(x);
+            const float fz     = static_cast<float>(z);
+            const glm::vec3 n  = {std::sin(fx * 0.3f) * 0.5f, 1.0f, std::cos(fz * 0.2f) * 0.5f};
+            const float length = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+
+            /* unit tangent perpendicular to the normal */
+            const float tangent_length = std::sqrt(n.x * n.x + n.y * n.y);
+
+            mesh.vertices.push_back({
+                .position   = {fx * 0.37f - 20.0f, std::sin(fx * 0.1f) * std::cos(fz * 0.1f) * 3.0f, fz * 0.41f},
+                .normal     = {n.x / length, n.y / length, n.z / length},
+                .tex_coords = {fx / static_cast<float>(size), fz / static_cast<float>(size) * 2.0f},
+                .tangent    = {n.y / tangent_length, -n.x / tangent_length, 0.0f},
+            });
+        }
+    }
+
+    /* last row stays unused */
+    for (int z = 0; z < size - 1; ++z) {
+        for (int x = 0; x < size; ++x) {
+            const auto corner = static_cast<GLuint>(z * (size + 1) + x);
+            const auto above  = static_cast<GLuint>(corner + size + 1);
+
+            mesh.indices.insert(mesh.indices.end(), {corner, above, corner + 1, corner + 1, above, above + 1});
+        }
+    }
+
+    return mesh;
+}
+
+/* Vertices are reordered by the codec, so they are compared through the index buffers */
+static void ExpectWithinQuantizationError(
+    const TestMesh &source, const std::vector<Vertex> &vertices, const std::vector<GLuint> &indices
+)
+{
+    ASSERT_EQ(vertices.size(), source.vertices.size());
+    ASSERT_EQ(indices.size(), source.indices.size());
+
+    glm::vec3 min = source.vertices[0].position;
+    glm::vec3 max = source.vertices[0].position;
+    for (const auto &vertex : source.vertices) {
+        min = glm::min(min, vertex.position);
+        max = glm::max(max, vertex.position);
+    }
+
+    /* half of the quantization step, with some room for the float arithmetic */
+    const glm::vec3 extent = max - min;
+    const auto step_error  = [](const float range) {
+        return range / 65535.0f * 0.5f + range * 1e-6f;
+    };
+
+    for (size_t idx = 0; idx < indices.size(); ++idx) {
+        ASSERT_LT(indices[idx], vertices.size());
+
+        const Vertex &expected = source.vertices[source.indices[idx]];
+        const Vertex &actual   = vertices[indices[idx]];
+
+        for (int axis = 0; axis < 3; ++axis) {
+            EXPECT_NEAR(actual.position[axis], expected.position[axis], step_error(extent[axis]));
+            EXPECT_NEAR(actual.normal[axis], expected.normal[axis], kDirectionTolerance);
+            EXPECT_NEAR(actual.tangent[axis], expected.tangent[axis], kDirectionTolerance);
+        }
+
+        EXPECT_NEAR(actual.tex_coords.x, expected.tex_coords.x, step_error(1.0f));
+        EXPECT_NEAR(actual.tex_coords.y, expected.tex_coords.y, step_error(2.0f));
+    }
+}
+
+TEST(MeshCodecTest, RoundTripWithinQuantizationError)
+{
+    const auto mesh    = MakeGrid(64);
+    const auto encoded = MeshCodec::Encode(mesh.vertices, mesh.indices);
+    ASSERT_FALSE(encoded.empty());
+
+    MeshCodec::Header header{};
+    ASSERT_TRUE(MeshCodec::ReadHeader(encoded, header));
+    ASSERT_EQ(header.vertex_count, mesh.vertices.size());
+    ASSERT_EQ(header.index_count, mesh.indices.size());
+
+    std::vector<Vertex> vertices(header.vertex_count);
+    std::vector<GLuint> indices(header.index_count);
+    ASSERT_TRUE(MeshCodec::Decode(encoded, vertices, indices));
+
+    ExpectWithinQuantizationError(mesh, vertices, indices);
+
+    /* bounds come from the header, without decoding */
+    const auto bounds = MeshCodec::GetBoundingBox(header);
+    EXPECT_FLOAT_EQ(bounds.min.x, -20.0f);
+    EXPECT_FLOAT_EQ(bounds.max.z, 64 * 0.41f);
+}
+
+TEST(MeshCodecTest, EncodesSmallerThanRawMesh)
+{
+    const auto mesh    = MakeGrid(64);
+    const auto encoded = MeshCodec::Encode(mesh.vertices, mesh.indices);
+
+    EXPECT_LT(encoded.size(), (mesh.vertices.size() * sizeof(Vertex) + mesh.indices.size() * sizeof(GLuint)) / 2);
+}
+
+TEST(MeshCodecTest, RejectsMalformedInput)
+{
+    auto mesh = MakeGrid(8);
+
+    /* index out of the vertex range */
+    auto broken_indices = mesh.indices;
+    broken_indices[3]   = static_cast<GLuint>(mesh.vertices.size());
+    EXPECT_TRUE(MeshCodec::Encode(mesh.vertices, broken_indices).empty());
+
+    const auto encoded = MeshCodec::Encode(mesh.vertices, mesh.indices);
+    MeshCodec::Header header{};
+
+    EXPECT_FALSE(MeshCodec::ReadHeader(std::span(encoded).first(encoded.size() - 1), header));
+
+    /* outputs must match the counts of the header */
+    std::vector<Vertex> vertices(mesh.vertices.size() - 1);
+    std::vector<GLuint> indices(mesh.indices.size());
+    EXPECT_FALSE(MeshCodec::Decode(encoded, vertices, indices));
+}
+
+class InternalModelTest : public OpenGLTest
+{
+    protected:
+    static void SetUpTestSuite()
+    {
+        LibGcp::SettingsMgr::InitInstance();
+        LibGcp::ResourceMgr::InitInstance();
+    }
+
+    static void TearDownTestSuite()
+    {
+        LibGcp::ResourceMgr::DeleteInstance();
+        LibGcp::SettingsMgr::DeleteInstance();
+    }
+};
+
+TEST_F(InternalModelTest, DumpAndLoadRoundTrip)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "libgcp_internal_model_test").string() +
+                             LibGcp::ModelSerializer::kInternalExtension;
+    const auto mesh = MakeGrid(32);
+
+    {
+        auto geometry = LibGcp::ResourceMgr::GetInstance().GetMeshGeometry(
+            std::span<const Vertex>(mesh.vertices), std::span<const GLuint>(mesh.indices)
+        );
+
+        std::vector<std::shared_ptr<LibGcp::Texture> > textures{};
+        std::vector<std::shared_ptr<LibGcp::Mesh> > meshes{};
+        meshes.push_back(std::make_shared<LibGcp::Mesh>(std::move(geometry), std::move(textures)));
+        meshes[0]->GetShininess() = 16.0;
+
+        const LibGcp::Model model(std::move(meshes));
+        LibGcp::ModelSerializer serializer{};
+        ASSERT_EQ(serializer.DumpModelToInternalFormat(model, path), LibGcp::Rc::kSuccess);
+    }
+
+    LibGcp::ModelSerializer serializer{};
+    const auto model = serializer.LoadModelFromInternalFormat(path);
+    std::filesystem::remove(path);
+
+    ASSERT_NE(model, nullptr);
+    ASSERT_EQ(model->GetMeshesCount(), 1);
+    EXPECT_EQ(model->GetMesh(0)->GetShininess(), 16.0);
+
+    std::vector<Vertex> vertices{};
+    std::vector<GLuint> indices{};
+    model->GetMesh(0)->GetGeometry()->ReadBack(vertices, indices);
+
+    ExpectWithinQuantizationError(mesh, vertices, indices);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <libcgp/serialization/placement_codec.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+using LibGcp::PlacementCodec;
+
+static std::vector<PlacementCodec::Placement> MakeScatter()
+{
+    std::vector<PlacementCodec::Placement> placements{};
+
+    /* few prefabs scattered over several cells, including negative ones and cell borders */
+    for (int idx = 0; idx < 500; ++idx) {
+        const auto name    = static_cast<size_t>(idx % 3);
+        const float spread = static_cast<float>(idx) * 0.731f;
+        const float yaw    = static_cast<float>(idx % 2) * 1.5f;
+        const float scale  = 1.0f + static_cast<float>(name) * 0.5f;
+        const float x      = -200.0f + spread;
+        const float z      = idx % 7 == 0 ? PlacementCodec::kCellSize * 2 : 150.0f - spread * 0.5f;
+
+        placements.push_back({
+            .name     = name,
+            .position = {.position = {x, 0.25f * static_cast<float>(idx % 5), z},
+                         .rotation = {0.0f, yaw, 0.0f},
+                         .scale    = {scale, scale, scale}},
+        });
+    }
+
+    return placements;
+}
+
+static void SortPlacements(std::vector<PlacementCodec::Placement> &placements)
+{
+    std::ranges::sort(placements, [](const auto &lhs, const auto &rhs) {
+        const auto &[lhs_pos, lhs_rot, lhs_scale] = lhs.position;
+        const auto &[rhs_pos, rhs_rot, rhs_scale] = rhs.position;
+
+        return std::tie(lhs.name, lhs_rot.y, lhs_pos.x, lhs_pos.y, lhs_pos.z) <
+               std::tie(rhs.name, rhs_rot.y, rhs_pos.x, rhs_pos.y, rhs_pos.z);
+    });
+}
+
+TEST(PlacementCodecTest, RoundTrip)
+{
+    auto placements    = MakeScatter();
+    const auto encoded = PlacementCodec::Encode(placements);
+
+    std::vector<PlacementCodec::Placement> decoded{};
+    ASSERT_TRUE(PlacementCodec::Decode(encoded, decoded));
+    ASSERT_EQ(decoded.size(), placements.size());
+
+    /* order of the objects is not preserved */
+    SortPlacements(placements);
+    SortPlacements(decoded);
+
+    for (size_t idx = 0; idx < placements.size(); ++idx) {
+        EXPECT_EQ(decoded[idx].name, placements[idx].name);
+        EXPECT_EQ(decoded[idx].position.rotation, placements[idx].position.rotation);
+        EXPECT_EQ(decoded[idx].position.scale, placements[idx].position.scale);
+
+        for (int axis = 0; axis < 3; ++axis) {
+            EXPECT_NEAR(
+                decoded[idx].position.position[axis], placements[idx].position.position[axis],
+                PlacementCodec::kPositionStep
+            );
+        }
+    }
+}
+
+TEST(PlacementCodecTest, EncodesPlacementsCompactly)
+{
+    const auto placements = MakeScatter();
+    const auto encoded    = PlacementCodec::Encode(placements);
+
+    /* prefab table is tiny, so a placement takes a few bytes */
+    EXPECT_LT(encoded.size(), placements.size() * 8);
+}
+
+TEST(PlacementCodecTest, EmptyRoundTrip)
+{
+    const auto encoded = PlacementCodec::Encode({});
+
+    std::vector<PlacementCodec::Placement> decoded{};
+    ASSERT_TRUE(PlacementCodec::Decode(encoded, decoded));
+    EXPECT_TRUE(decoded.empty());
+}
+
+TEST(PlacementCodecTest, RejectsTruncatedStream)
+{
+    const auto encoded = PlacementCodec::Encode(MakeScatter());
+
+    for (const size_t size : {size_t{0}, size_t{1}, encoded.size() / 2, encoded.size() - 1}) {
+        std::vector<PlacementCodec::Placement> decoded{};
+        EXPECT_FALSE(PlacementCodec::Decode(std::span(encoded).first(size), decoded)) << "size: " << size;
+    }
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <libcgp/intf.hpp>
+#include <libcgp/mgr/object_mgr.hpp>
+#include <libcgp/mgr/resource_mgr.hpp>
+#include <libcgp/mgr/settings_mgr.hpp>
+#include <libcgp/rc.hpp>
+#include <libcgp/serialization/scene_serializer.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <tuple>
+
+class SceneSerializerTest : public ::testing::Test
+{
+    protected:
+    static constexpr const char *kSceneName = "test.libgcp_scene";
+
+    std::string dir_{};
+
+    static void SetUpTestSuite()
+    {
+        LibGcp::SettingsMgr::InitInstance();
+        LibGcp::ResourceMgr::InitInstance();
+        LibGcp::ObjectMgr::InitInstance();
+    }
+
+    static void TearDownTestSuite()
+    {
+        LibGcp::ObjectMgr::DeleteInstance();
+        LibGcp::ResourceMgr::DeleteInstance();
+        LibGcp::SettingsMgr::DeleteInstance();
+    }
+
+    void SetUp() override
+    {
+        dir_ = (std::filesystem::temp_directory_path() / "libgcp_scene_serializer_test").string();
+        std::filesystem::remove_all(dir_);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir_); }
+
+    static void SetWordTime(const uint64_t value)
+    {
+        LibGcp::SettingsMgr::GetInstance().SetSetting<LibGcp::Setting::kCurrentWordTime>(value);
+    }
+
+    LibGcp::SceneSerialized::ChunkedSceneHeader ReadHeader() const
+    {
+        LibGcp::SceneSerialized::ChunkedSceneHeader header{};
+
+        std::ifstream file(dir_ + "/" + kSceneName, std::ios::binary);
+        file.read(reinterpret_cast<char *>(&header), sizeof(LibGcp::SceneSerialized::ChunkedSceneHeader));
+
+        return header;
+    }
+
+    static uint64_t LoadWordTime(LibGcp::SceneSerializer &serializer)
+    {
+        auto [rc, scene] = serializer.LoadScene(kSceneName, LibGcp::SerializationType::kShallow);
+        EXPECT_EQ(rc, LibGcp::Rc::kSuccess);
+
+        for (auto &[setting, container] : scene.settings) {
+            if (setting == LibGcp::Setting::kCurrentWordTime) {
+                return container.GetSetting<uint64_t>();
+            }
+        }
+
+        ADD_FAILURE() << "Saved scene has no word time setting";
+        return 0;
+    }
+};
+
+TEST_F(SceneSerializerTest, SaveAndLoad)
+{
+    LibGcp::SceneSerializer serializer(dir_);
+
+    SetWordTime(1234);
+    ASSERT_EQ(serializer.SerializeScene(kSceneName, LibGcp::SerializationType::kShallow), LibGcp::Rc::kSuccess);
+
+    const auto header = ReadHeader();
+    EXPECT_EQ(header.base_header.magic, LibGcp::SceneSerialized::kMagic);
+    EXPECT_EQ(header.base_header.scene_version, LibGcp::kSceneVersion);
+    EXPECT_EQ(header.num_chunks, LibGcp::SceneSerializer::kSectionsCount);
+
+    EXPECT_EQ(LoadWordTime(serializer), 1234);
+}
+
+TEST_F(SceneSerializerTest, IncrementalSaveAppendsChangedSections)
+{
+    LibGcp::SceneSerializer serializer(dir_);
+
+    SetWordTime(1);
+    ASSERT_EQ(serializer.SerializeScene(kSceneName, LibGcp::SerializationType::kShallow), LibGcp::Rc::kSuccess);
+    const auto full = ReadHeader();
+
+    /* nothing changed, nothing is appended */
+    ASSERT_EQ(serializer.SerializeSceneIncremental(kSceneName), LibGcp::Rc::kSuccess);
+    EXPECT_EQ(ReadHeader().num_chunks, full.num_chunks);
+
+    SetWordTime(2);
+    ASSERT_EQ(serializer.SerializeSceneIncremental(kSceneName), LibGcp::Rc::kSuccess);
+
+    const auto appended       = ReadHeader();
+    const auto settings_index = static_cast<size_t>(LibGcp::SceneSerialized::Section::kSettings);
+    EXPECT_EQ(appended.num_chunks, full.num_chunks + 1);
+    EXPECT_GT(appended.section_offsets[settings_index], full.section_offsets[settings_index]);
+
+    EXPECT_EQ(LoadWordTime(serializer), 2);
+}
+
+TEST_F(SceneSerializerTest, CompactionKeepsLatestChunks)
+{
+    LibGcp::SceneSerializer serializer(dir_);
+    const std::string path = dir_ + "/" + kSceneName;
+
+    SetWordTime(0);
+    ASSERT_EQ(serializer.SerializeScene(kSceneName, LibGcp::SerializationType::kShallow), LibGcp::Rc::kSuccess);
+
+    for (uint64_t value = 1; value <= 3; ++value) {
+        SetWordTime(value);
+        ASSERT_EQ(serializer.SerializeSceneIncremental(kSceneName), LibGcp::Rc::kSuccess);
+    }
+
+    const auto size_before = std::filesystem::file_size(path);
+    ASSERT_EQ(ReadHeader().num_chunks, LibGcp::SceneSerializer::kSectionsCount + 3);
+
+    serializer.CompactAsync(kSceneName);
+    serializer.WaitForCompaction();
+
+    EXPECT_EQ(ReadHeader().num_chunks, LibGcp::SceneSerializer::kSectionsCount);
+    EXPECT_LT(std::filesystem::file_size(path), size_before);
+    EXPECT_EQ(LoadWordTime(serializer), 3);
+}
+
+TEST_F(SceneSerializerTest, CompactionKeepsTruncatedFile)
+{
+    LibGcp::SceneSerializer serializer(dir_);
+    const std::string path = dir_ + "/" + kSceneName;
+
+    SetWordTime(0);
+    ASSERT_EQ(serializer.SerializeScene(kSceneName, LibGcp::SerializationType::kShallow), LibGcp::Rc::kSuccess);
+    SetWordTime(1);
+    ASSERT_EQ(serializer.SerializeSceneIncremental(kSceneName), LibGcp::Rc::kSuccess);
+
+    /* payload of the appended settings chunk is cut */
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    const auto size_before = std::filesystem::file_size(path);
+
+    serializer.CompactAsync(kSceneName);
+    serializer.WaitForCompaction();
+
+    EXPECT_EQ(std::filesystem::file_size(path), size_before);
+    EXPECT_EQ(ReadHeader().num_chunks, LibGcp::SceneSerializer::kSectionsCount + 1);
+    EXPECT_EQ(std::distance(std::filesystem::directory_iterator(dir_), std::filesystem::directory_iterator{}), 1);
+}
+
+TEST_F(SceneSerializerTest, IncrementalSavesTriggerCompaction)
+{
+    LibGcp::SceneSerializer serializer(dir_);
+
+    SetWordTime(0);
+    ASSERT_EQ(serializer.SerializeScene(kSceneName, LibGcp::SerializationType::kShallow), LibGcp::Rc::kSuccess);
+
+    for (uint64_t value = 1; value <= LibGcp::SceneSerializer::kCompactionThreshold; ++value) {
+        SetWordTime(value);
+        ASSERT_EQ(serializer.SerializeSceneIncremental(kSceneName), LibGcp::Rc::kSuccess);
+    }
+
+    serializer.WaitForCompaction();
+
+    EXPECT_EQ(ReadHeader().num_chunks, LibGcp::SceneSerializer::kSectionsCount);
+    EXPECT_EQ(LoadWordTime(serializer), LibGcp::SceneSerializer::kCompactionThreshold);
+}
+
+TEST_F(SceneSerializerTest, RejectsCorruptedFile)
+{
+    LibGcp::SceneSerializer serializer(dir_);
+    ASSERT_EQ(serializer.SerializeScene(kSceneName, LibGcp::SerializationType::kShallow), LibGcp::Rc::kSuccess);
+
+    auto header              = ReadHeader();
+    header.base_header.magic = 0;
+    {
+        std::fstream file(dir_ + "/" + kSceneName, std::ios::binary | std::ios::in | std::ios::out);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(LibGcp::SceneSerialized::ChunkedSceneHeader));
+    }
+
+    EXPECT_EQ(
+        std::get<0>(serializer.LoadScene(kSceneName, LibGcp::SerializationType::kShallow)),
+        LibGcp::Rc::kCorruptedFile
+    );
+}
+
+TEST_F(SceneSerializerTest, RejectsTruncatedFile)
+{
+    LibGcp::SceneSerializer serializer(dir_);
+    ASSERT_EQ(serializer.SerializeScene(kSceneName, LibGcp::SerializationType::kShallow), LibGcp::Rc::kSuccess);
+
+    /* the last chunk ends with the file, so its payload is cut */
+    const std::string path = dir_ + "/" + kSceneName;
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+
+    EXPECT_EQ(
+        std::get<0>(serializer.LoadScene(kSceneName, LibGcp::SerializationType::kShallow)),
+        LibGcp::Rc::kCorruptedFile
+    );
+}
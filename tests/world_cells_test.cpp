@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+
+#include <libcgp/intf.hpp>
+#include <libcgp/rc.hpp>
+#include <libcgp/serialization/placement_codec.hpp>
+#include <libcgp/serialization/scene_serializer.hpp>
+#include <libcgp/version.hpp>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <tuple>
+
+/* Exposes writing and merging of the cells file, which is otherwise reached only through saved scenes */
+class CellsSerializer : public LibGcp::SceneSerializer
+{
+    public:
+    using SceneSerializer::MergeWorldCells_;
+    using SceneSerializer::SceneSerializer;
+    using SceneSerializer::WriteWorldCells_;
+};
+
+class WorldCellsTest : public ::testing::Test
+{
+    protected:
+    static constexpr float kCellSize = 32.0f;
+
+    std::string dir_{};
+    std::string path_{};
+
+    void SetUp() override
+    {
+        dir_  = (std::filesystem::temp_directory_path() / "libgcp_world_cells_test").string();
+        path_ = dir_ + "/test.libgcp_scene" + LibGcp::SceneSerializer::kWorldCellsExtension;
+
+        std::filesystem::remove_all(dir_);
+        std::filesystem::create_directories(dir_);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir_); }
+
+    static LibGcp::ResourceSpec MakeModel(const std::string &name)
+    {
+        return {
+            .paths     = {name, ""},
+            .type      = LibGcp::ResourceType::kModel,
+            .load_type = LibGcp::LoadType::kExternal,
+        };
+    }
+
+    static LibGcp::StaticObjectSpec MakeObject(const std::string &name, const glm::vec3 &position)
+    {
+        return {
+            .position = {.position = position, .rotation = {0.0f, 1.0f, 0.0f}, .scale = {1.0f, 1.0f, 1.0f}},
+            .name     = name,
+        };
+    }
+
+    static LibGcp::PointLightSpec MakePointLight(const std::string &model_name)
+    {
+        return {
+            .model_name  = model_name,
+            .light_info  = {},
+            .point_light = {.constant = 1.0f, .linear = 0.1f, .quadratic = 0.01f},
+        };
+    }
+
+    LibGcp::Rc WriteCells(const LibGcp::world_cells_t &cells)
+    {
+        CellsSerializer serializer(dir_);
+        return serializer.WriteWorldCells_(path_, cells, kCellSize);
+    }
+
+    void PatchHeader(const LibGcp::WorldCellsSerialized::Header &header) const
+    {
+        std::fstream file(path_, std::ios::binary | std::ios::in | std::ios::out);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(LibGcp::WorldCellsSerialized::Header));
+    }
+
+    LibGcp::WorldCellsSerialized::Header ReadHeader() const
+    {
+        LibGcp::WorldCellsSerialized::Header header{};
+
+        std::ifstream file(path_, std::ios::binary);
+        file.read(reinterpret_cast<char *>(&header), sizeof(LibGcp::WorldCellsSerialized::Header));
+
+        return header;
+    }
+};
+
+TEST_F(WorldCellsTest, IndexAndCellsRoundTrip)
+{
+    const LibGcp::world_cells_t cells{
+        {
+            .x              = 0,
+            .z              = 0,
+            .resources      = {MakeModel("tree")},
+            .static_objects = {MakeObject("tree", {1.5f, 0.0f, 2.25f})},
+            .point_lights   = {MakePointLight("tree")},
+            .spot_lights    = {},
+        },
+        {
+            .x              = -1,
+            .z              = 3,
+            .resources      = {MakeModel("rock")},
+            .static_objects = {MakeObject("rock", {-10.0f, 4.0f, 100.0f})},
+            .point_lights   = {},
+            .spot_lights    = {},
+        },
+    };
+    ASSERT_EQ(WriteCells(cells), LibGcp::Rc::kSuccess);
+
+    const auto [rc, index] = LibGcp::SceneSerializer::LoadWorldCellsIndex(path_);
+    ASSERT_EQ(rc, LibGcp::Rc::kSuccess);
+    EXPECT_EQ(index.cell_size, kCellSize);
+    ASSERT_EQ(index.cells.size(), cells.size());
+
+    for (size_t idx = 0; idx < cells.size(); ++idx) {
+        const auto &expected = cells[idx];
+        EXPECT_EQ(index.cells[idx].x, expected.x);
+        EXPECT_EQ(index.cells[idx].z, expected.z);
+
+        const auto [cell_rc, cell] = LibGcp::SceneSerializer::LoadWorldCell(path_, index.cells[idx]);
+        ASSERT_EQ(cell_rc, LibGcp::Rc::kSuccess);
+        EXPECT_EQ(cell.x, expected.x);
+        EXPECT_EQ(cell.z, expected.z);
+
+        ASSERT_EQ(cell.resources.size(), 1);
+        EXPECT_EQ(cell.resources[0].paths[0], expected.resources[0].paths[0]);
+        EXPECT_EQ(cell.resources[0].type, LibGcp::ResourceType::kModel);
+
+        ASSERT_EQ(cell.static_objects.size(), 1);
+        const auto &object = cell.static_objects[0];
+        EXPECT_EQ(object.name, expected.static_objects[0].name);
+        EXPECT_EQ(object.position.rotation, expected.static_objects[0].position.rotation);
+        EXPECT_EQ(object.position.scale, expected.static_objects[0].position.scale);
+
+        for (int axis = 0; axis < 3; ++axis) {
+            EXPECT_NEAR(
+                object.position.position[axis], expected.static_objects[0].position.position[axis],
+                LibGcp::PlacementCodec::kPositionStep
+            );
+        }
+
+        ASSERT_EQ(cell.point_lights.size(), expected.point_lights.size());
+        if (!cell.point_lights.empty()) {
+            EXPECT_EQ(cell.point_lights[0].model_name, expected.point_lights[0].model_name);
+            EXPECT_EQ(cell.point_lights[0].point_light, expected.point_lights[0].point_light);
+        }
+        EXPECT_TRUE(cell.spot_lights.empty());
+    }
+}
+
+TEST_F(WorldCellsTest, RejectsCellCountExceedingFile)
+{
+    ASSERT_EQ(WriteCells({{.x = 0, .z = 0}}), LibGcp::Rc::kSuccess);
+
+    auto header      = ReadHeader();
+    header.num_cells = size_t{1} << 40;
+    PatchHeader(header);
+
+    EXPECT_EQ(std::get<0>(LibGcp::SceneSerializer::LoadWorldCellsIndex(path_)), LibGcp::Rc::kCorruptedFile);
+}
+
+TEST_F(WorldCellsTest, ChecksVersion)
+{
+    ASSERT_EQ(WriteCells({{.x = 0, .z = 0}}), LibGcp::Rc::kSuccess);
+    const auto [rc, index] = LibGcp::SceneSerializer::LoadWorldCellsIndex(path_);
+    ASSERT_EQ(rc, LibGcp::Rc::kSuccess);
+
+    auto header = ReadHeader();
+
+    /* cells written with an older chunked version stay readable */
+    header.scene_version = LibGcp::SceneVersion::V0_1_2;
+    PatchHeader(header);
+    EXPECT_EQ(std::get<0>(LibGcp::SceneSerializer::LoadWorldCellsIndex(path_)), LibGcp::Rc::kSuccess);
+    EXPECT_EQ(std::get<0>(LibGcp::SceneSerializer::LoadWorldCell(path_, index.cells[0])), LibGcp::Rc::kSuccess);
+
+    header.scene_version = LibGcp::SceneVersion::V0_1_1;
+    PatchHeader(header);
+    EXPECT_EQ(std::get<0>(LibGcp::SceneSerializer::LoadWorldCellsIndex(path_)), LibGcp::Rc::kOutdatedProtocol);
+    EXPECT_EQ(
+        std::get<0>(LibGcp::SceneSerializer::LoadWorldCell(path_, index.cells[0])), LibGcp::Rc::kOutdatedProtocol
+    );
+
+    header.scene_version = LibGcp::SceneVersion::kLast;
+    PatchHeader(header);
+    EXPECT_EQ(std::get<0>(LibGcp::SceneSerializer::LoadWorldCellsIndex(path_)), LibGcp::Rc::kTooOldSoftware);
+}
+
+TEST_F(WorldCellsTest, MergeKeepsSharedModelLightsOnce)
+{
+    /* model shared by two cells is listed with its lights in both of them */
+    const LibGcp::world_cells_t cells{
+        {
+            .x              = 0,
+            .z              = 0,
+            .resources      = {MakeModel("lamp")},
+            .static_objects = {MakeObject("lamp", {1.0f, 0.0f, 1.0f})},
+            .point_lights   = {MakePointLight("lamp")},
+            .spot_lights    = {},
+        },
+        {
+            .x              = 1,
+            .z              = 0,
+            .resources      = {MakeModel("lamp")},
+            .static_objects = {MakeObject("lamp", {40.0f, 0.0f, 1.0f})},
+            .point_lights   = {MakePointLight("lamp")},
+            .spot_lights    = {},
+        },
+    };
+    ASSERT_EQ(WriteCells(cells), LibGcp::Rc::kSuccess);
+
+    LibGcp::Scene scene{};
+    scene.world_cells = path_;
+    ASSERT_EQ(CellsSerializer::MergeWorldCells_(scene), LibGcp::Rc::kSuccess);
+
+    EXPECT_TRUE(scene.world_cells.empty());
+    EXPECT_EQ(scene.resources.size(), 1);
+    EXPECT_EQ(scene.static_objects.size(), 2);
+    EXPECT_EQ(scene.point_lights.size(), 1);
+}